@@ -28,6 +28,7 @@
 #include <gp_Sphere.hxx>
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_NotImplemented.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Adaptor3d_Surface, Standard_Transient)
@@ -313,6 +314,43 @@ void Adaptor3d_Surface::D3(const Standard_Real , const Standard_Real , gp_Pnt& ,
 }
 
 
+//=======================================================================
+//function : D0Batch
+//purpose  : 
+//=======================================================================
+void Adaptor3d_Surface::D0Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                 TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionMismatch_Raise_if (thePoints.Length() != theUVs.Length(),
+                                       "Adaptor3d_Surface::D0Batch: wrong size of the output array");
+  for (Standard_Integer i = 0; i < theUVs.Length(); ++i)
+  {
+    const gp_Pnt2d& aUV = theUVs (theUVs.Lower() + i);
+    D0 (aUV.X(), aUV.Y(), thePoints (thePoints.Lower() + i));
+  }
+}
+
+//=======================================================================
+//function : D1Batch
+//purpose  : 
+//=======================================================================
+void Adaptor3d_Surface::D1Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                 TColgp_Array1OfPnt&         thePoints,
+                                 TColgp_Array1OfVec&         theD1U,
+                                 TColgp_Array1OfVec&         theD1V) const
+{
+  Standard_DimensionMismatch_Raise_if (thePoints.Length() != theUVs.Length() ||
+                                       theD1U.Length()    != theUVs.Length() ||
+                                       theD1V.Length()    != theUVs.Length(),
+                                       "Adaptor3d_Surface::D1Batch: wrong size of the output arrays");
+  for (Standard_Integer i = 0; i < theUVs.Length(); ++i)
+  {
+    const gp_Pnt2d& aUV = theUVs (theUVs.Lower() + i);
+    D1 (aUV.X(), aUV.Y(), thePoints (thePoints.Lower() + i),
+        theD1U (theD1U.Lower() + i), theD1V (theD1V.Lower() + i));
+  }
+}
+
 //=======================================================================
 //function : DN
 //purpose  : 
@@ -29,6 +29,9 @@
 #include <Standard.hxx>
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Handle.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
 class Geom_BezierSurface;
@@ -139,6 +142,26 @@ public:
   //! Raised  if   the   continuity   of the current
   //! intervals is not C3.
   Standard_EXPORT virtual void D3 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV, gp_Vec& D3U, gp_Vec& D3V, gp_Vec& D3UUV, gp_Vec& D3UVV) const;
+
+  //! Computes the points of the surface for the array of parameters.
+  //! The default implementation calls D0() for each point,
+  //! descendants may redefine it to share the evaluation data between the points.
+  //! @param theUVs    [in]  parameters of the points
+  //! @param thePoints [out] points of the surface, should have the same length as theUVs
+  Standard_EXPORT virtual void D0Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                        TColgp_Array1OfPnt&         thePoints) const;
+
+  //! Computes the points and the first derivatives of the surface for the array of parameters.
+  //! The default implementation calls D1() for each point,
+  //! descendants may redefine it to share the evaluation data between the points.
+  //! @param theUVs    [in]  parameters of the points
+  //! @param thePoints [out] points of the surface, should have the same length as theUVs
+  //! @param theD1U    [out] first derivatives in U direction, should have the same length as theUVs
+  //! @param theD1V    [out] first derivatives in V direction, should have the same length as theUVs
+  Standard_EXPORT virtual void D1Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                        TColgp_Array1OfPnt&         thePoints,
+                                        TColgp_Array1OfVec&         theD1U,
+                                        TColgp_Array1OfVec&         theD1V) const;
   
   //! Computes the derivative of order Nu in the direction U and Nv
   //! in the direction V at the point P(U, V).
@@ -144,4 +144,7 @@ DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertShapeIsNotPeriodic)
 //! Unable to make closed edge on face (to make a seam)
 DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertUnableToMakeClosedEdgeOnFace)
 
+//! The face has no triangulation
+DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertFaceWithoutTriangulation)
+
 #endif // _BOPAlgo_Alerts_HeaderFile
@@ -21,11 +21,18 @@
 #include <BOPDS_DS.hxx>
 #include <BOPTools_AlgoTools.hxx>
 #include <BOPTools_AlgoTools3D.hxx>
+#include <BOPTools_BoxTree.hxx>
 #include <BOPTools_IndexedDataMapOfSetShape.hxx>
+#include <BOPTools_Parallel.hxx>
 #include <BOPTools_Set.hxx>
+#include <Bnd_Box.hxx>
+#include <Bnd_Tools.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <Precision.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -66,7 +73,9 @@ static
 //purpose  : 
 //=======================================================================
 BOPAlgo_BOP::BOPAlgo_BOP()
-: BOPAlgo_ToolsProvider()
+: BOPAlgo_ToolsProvider(),
+  myBatchMode(Standard_False),
+  myIsBatchPerformed(Standard_False)
 {
   Clear();
 }
@@ -75,7 +84,9 @@ BOPAlgo_BOP::BOPAlgo_BOP()
 //purpose  : 
 //=======================================================================
 BOPAlgo_BOP::BOPAlgo_BOP(const Handle(NCollection_BaseAllocator)& theAllocator)
-: BOPAlgo_ToolsProvider(theAllocator)
+: BOPAlgo_ToolsProvider(theAllocator),
+  myBatchMode(Standard_False),
+  myIsBatchPerformed(Standard_False)
 {
   Clear();
 }
@@ -95,6 +106,7 @@ void BOPAlgo_BOP::Clear()
   myOperation=BOPAlgo_UNKNOWN;
   myDims[0]=-1;
   myDims[1]=-1;
+  myIsBatchPerformed=Standard_False;
 
   BOPAlgo_ToolsProvider::Clear();
 }
@@ -348,6 +360,364 @@ void BOPAlgo_BOP::BuildResult(const TopAbs_ShapeEnum theType)
     }
   }
 }
+//=======================================================================
+//class    : BOPAlgo_BOPGroup
+//purpose  : Boolean operation on the group of interacting shapes
+//           in the batch mode
+//=======================================================================
+class BOPAlgo_BOPGroup : public BOPAlgo_BOP
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Sets the range for a single run
+  void SetProgressRange(const Message_ProgressRange& theRange)
+  {
+    myProgressRange = theRange;
+  }
+
+  //! Performs the operation in the given range
+  virtual void Perform(const Message_ProgressRange& = Message_ProgressRange()) Standard_OVERRIDE
+  {
+    BOPAlgo_BOP::Perform(myProgressRange);
+  }
+
+protected:
+  Message_ProgressRange myProgressRange;
+};
+//
+typedef NCollection_Vector<BOPAlgo_BOPGroup> BOPAlgo_VectorOfBOPGroup;
+
+//=======================================================================
+//function : CollectBatchUnits
+//purpose  : Explodes the compounds on the shapes to be distributed
+//           into the groups
+//=======================================================================
+static void CollectBatchUnits(const TopoDS_Shape& theS,
+                              TopTools_ListOfShape& theUnits)
+{
+  if (theS.ShapeType() != TopAbs_COMPOUND)
+  {
+    theUnits.Append(theS);
+    return;
+  }
+  for (TopoDS_Iterator aIt(theS); aIt.More(); aIt.Next())
+  {
+    CollectBatchUnits(aIt.Value(), theUnits);
+  }
+}
+
+//=======================================================================
+//function : FindGroupRoot
+//purpose  : Returns the root of the group of the element (union-find)
+//=======================================================================
+static Standard_Integer FindGroupRoot(NCollection_Vector<Standard_Integer>& theParents,
+                                      Standard_Integer theI)
+{
+  while (theParents(theI) != theI)
+  {
+    // path halving
+    theParents(theI) = theParents(theParents(theI));
+    theI = theParents(theI);
+  }
+  return theI;
+}
+
+//=======================================================================
+//function : MakeBatchGroups
+//purpose  : Distributes the Objects and Tools into the groups of
+//           interacting shapes. Returns FALSE if the arguments cannot
+//           be split on several groups to be cut
+//=======================================================================
+static Standard_Boolean MakeBatchGroups(const TopTools_ListOfShape& theObjects,
+                                        const TopTools_ListOfShape& theTools,
+                                        const Standard_Real theFuzzyValue,
+                                        NCollection_Vector<TopoDS_Shape>& theUnits,
+                                        Standard_Integer& theNbObj,
+                                        NCollection_Vector<TopTools_ListOfShape> theGroups[2],
+                                        NCollection_Vector<Standard_Integer>& theUnitGroup)
+{
+  // 1. Explode the arguments on the units
+  TopTools_ListOfShape aLUnits[2];
+  for (Standard_Integer i = 0; i < 2; ++i)
+  {
+    const TopTools_ListOfShape& aLS = !i ? theObjects : theTools;
+    for (TopTools_ListOfShape::Iterator aItLS(aLS); aItLS.More(); aItLS.Next())
+    {
+      const TopoDS_Shape& aS = aItLS.Value();
+      if (aS.IsNull() || BOPTools_AlgoTools3D::IsEmptyShape(aS))
+      {
+        // Let the usual algorithm treat the empty shapes
+        return Standard_False;
+      }
+      CollectBatchUnits(aS, aLUnits[i]);
+    }
+  }
+  //
+  theNbObj = aLUnits[0].Extent();
+  const Standard_Integer aNbUnits = theNbObj + aLUnits[1].Extent();
+  if (aLUnits[1].Extent() < 2)
+  {
+    return Standard_False;
+  }
+  //
+  for (Standard_Integer i = 0; i < 2; ++i)
+  {
+    for (TopTools_ListOfShape::Iterator aItLS(aLUnits[i]); aItLS.More(); aItLS.Next())
+    {
+      theUnits.Append(aItLS.Value());
+    }
+  }
+  //
+  // 2. Distribute the units into the groups of interacting shapes
+  //    using the pairs of units with interfering bounding boxes
+  const Standard_Real aTolAdd = theFuzzyValue + Precision::Confusion();
+  BOPTools_BoxTree aBBTree;
+  aBBTree.SetSize(aNbUnits);
+  for (Standard_Integer i = 0; i < aNbUnits; ++i)
+  {
+    Bnd_Box aBox;
+    BRepBndLib::Add(theUnits(i), aBox);
+    aBox.Enlarge(aTolAdd);
+    aBBTree.Add(i, Bnd_Tools::Bnd2BVH(aBox));
+  }
+  aBBTree.Build();
+  //
+  BOPTools_BoxPairSelector aPairSelector;
+  aPairSelector.SetBVHSets(&aBBTree, &aBBTree);
+  aPairSelector.SetSame(Standard_True);
+  aPairSelector.Select();
+  //
+  NCollection_Vector<Standard_Integer> aParents;
+  for (Standard_Integer i = 0; i < aNbUnits; ++i)
+  {
+    aParents.Append(i);
+  }
+  //
+  const std::vector<BOPTools_BoxPairSelector::PairIDs>& aPairs = aPairSelector.Pairs();
+  const Standard_Integer aNbPairs = static_cast<Standard_Integer>(aPairs.size());
+  for (Standard_Integer iPair = 0; iPair < aNbPairs; ++iPair)
+  {
+    Standard_Integer aR1 = FindGroupRoot(aParents, aPairs[iPair].ID1);
+    Standard_Integer aR2 = FindGroupRoot(aParents, aPairs[iPair].ID2);
+    if (aR1 != aR2)
+    {
+      // keep the smallest index as the root to order the groups
+      // by the first unit
+      if (aR1 < aR2)
+        aParents(aR2) = aR1;
+      else
+        aParents(aR1) = aR2;
+    }
+  }
+  //
+  // 3. Make the groups: the groups with Objects and Tools are to be
+  //    cut, the single Objects are passed into result, the Tools not
+  //    interacting with the Objects are removed
+  NCollection_DataMap<Standard_Integer, Standard_Integer> aMRootGroup;
+  for (Standard_Integer i = 0; i < aNbUnits; ++i)
+  {
+    const Standard_Integer aRoot = FindGroupRoot(aParents, i);
+    Standard_Integer* pGroup = aMRootGroup.ChangeSeek(aRoot);
+    if (!pGroup)
+    {
+      pGroup = aMRootGroup.Bound(aRoot, theGroups[0].Length());
+      theGroups[0].Appended();
+      theGroups[1].Appended();
+    }
+    theGroups[i < theNbObj ? 0 : 1].ChangeValue(*pGroup).Append(theUnits(i));
+    theUnitGroup.Append(*pGroup);
+  }
+  //
+  Standard_Integer aNbToCut = 0;
+  const Standard_Integer aNbGroups = theGroups[0].Length();
+  for (Standard_Integer i = 0; i < aNbGroups; ++i)
+  {
+    const Standard_Integer aNbO = theGroups[0](i).Extent();
+    const Standard_Integer aNbT = theGroups[1](i).Extent();
+    if (aNbO > 1 && !aNbT)
+    {
+      // The interacting Objects have to be split by each other,
+      // which is not done in the groups without Tools
+      return Standard_False;
+    }
+    if (aNbO && aNbT)
+    {
+      ++aNbToCut;
+    }
+  }
+  //
+  // Nothing to gain from the batch mode for a single group
+  return aNbToCut > 1;
+}
+
+//=======================================================================
+//function : IsBatchApplicable
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPAlgo_BOP::IsBatchApplicable() const
+{
+  if (myOperation != BOPAlgo_CUT)
+  {
+    return Standard_False;
+  }
+  NCollection_Vector<TopoDS_Shape> aUnits;
+  Standard_Integer aNbObj = 0;
+  NCollection_Vector<TopTools_ListOfShape> aGroups[2];
+  NCollection_Vector<Standard_Integer> aUnitGroup;
+  return MakeBatchGroups(myArguments, myTools, myFuzzyValue,
+                         aUnits, aNbObj, aGroups, aUnitGroup);
+}
+
+//=======================================================================
+//function : PerformBatch
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPAlgo_BOP::PerformBatch(const Message_ProgressRange& theRange)
+{
+  if (myOperation != BOPAlgo_CUT)
+  {
+    return Standard_False;
+  }
+  //
+  NCollection_Vector<TopoDS_Shape> aUnits;
+  Standard_Integer aNbObj = 0;
+  NCollection_Vector<TopTools_ListOfShape> aGroups[2];
+  NCollection_Vector<Standard_Integer> aUnitGroup;
+  if (!MakeBatchGroups(myArguments, myTools, myFuzzyValue,
+                       aUnits, aNbObj, aGroups, aUnitGroup))
+  {
+    return Standard_False;
+  }
+  //
+  const Standard_Integer aNbUnits = aUnits.Length();
+  const Standard_Integer aNbGroups = aGroups[0].Length();
+  Standard_Integer aNbToCut = 0;
+  for (Standard_Integer i = 0; i < aNbGroups; ++i)
+  {
+    if (!aGroups[0](i).IsEmpty() && !aGroups[1](i).IsEmpty())
+    {
+      ++aNbToCut;
+    }
+  }
+  //
+  // 4. Cut the groups
+  myShape.Nullify();
+  myHistory.Nullify();
+  //
+  Message_ProgressScope aPS(theRange, "Performing Boolean operation by groups", aNbToCut);
+  BOPAlgo_VectorOfBOPGroup aVBOP;
+  NCollection_Vector<Standard_Integer> aGroupBOP;
+  for (Standard_Integer i = 0; i < aNbGroups; ++i)
+  {
+    Standard_Integer iBOP = -1;
+    if (!aGroups[0](i).IsEmpty() && !aGroups[1](i).IsEmpty())
+    {
+      iBOP = aVBOP.Length();
+      BOPAlgo_BOPGroup& aBOP = aVBOP.Appended();
+      aBOP.SetArguments(aGroups[0](i));
+      aBOP.SetTools(aGroups[1](i));
+      aBOP.SetOperation(myOperation);
+      aBOP.SetRunParallel(myRunParallel);
+      aBOP.SetFuzzyValue(myFuzzyValue);
+      aBOP.SetNonDestructive(myNonDestructive);
+      aBOP.SetGlue(myGlue);
+      aBOP.SetUseOBB(myUseOBB);
+      aBOP.SetUseTriangulationFilter(myUseTriangulationFilter);
+      aBOP.SetCheckInverted(myCheckInverted);
+      aBOP.SetToFillHistory(myFillHistory);
+      aBOP.SetFaceFaceCache(myFaceFaceCache);
+      aBOP.SetProgressRange(aPS.Next());
+    }
+    aGroupBOP.Append(iBOP);
+  }
+  //
+  // The groups share the cache of Face/Face intersection results,
+  // keep the entries used by any group till the end of the whole operation
+  BOPAlgo_FaceFaceCache::OperationSentry aCacheSentry(myFaceFaceCache);
+  //======================================================
+  BOPTools_Parallel::Perform (myRunParallel, aVBOP);
+  //======================================================
+  //
+  Standard_Boolean bHasErrors = Standard_False;
+  const Standard_Integer aNbBOP = aVBOP.Length();
+  for (Standard_Integer i = 0; i < aNbBOP; ++i)
+  {
+    const BOPAlgo_BOPGroup& aBOP = aVBOP(i);
+    GetReport()->Merge(aBOP.GetReport());
+    bHasErrors = bHasErrors || aBOP.HasErrors();
+  }
+  if (bHasErrors || UserBreak(aPS))
+  {
+    return Standard_True;
+  }
+  aCacheSentry.SetCompleted();
+  //
+  // 5. Combine the results and the history of the groups
+  //    in the order of the Objects
+  BRep_Builder aBB;
+  TopoDS_Compound aResult;
+  aBB.MakeCompound(aResult);
+  //
+  if (myFillHistory)
+  {
+    myHistory = new BRepTools_History();
+  }
+  //
+  NCollection_Vector<Standard_Boolean> aGroupAdded;
+  for (Standard_Integer i = 0; i < aNbGroups; ++i)
+  {
+    aGroupAdded.Append(Standard_False);
+  }
+  //
+  for (Standard_Integer i = 0; i < aNbUnits; ++i)
+  {
+    const Standard_Integer iG = aUnitGroup(i);
+    const Standard_Integer iBOP = aGroupBOP(iG);
+    if (iBOP < 0)
+    {
+      if (i < aNbObj)
+      {
+        // Object not interacting with any Tool
+        aBB.Add(aResult, aUnits(i));
+      }
+      else if (myFillHistory)
+      {
+        // Tool not interacting with any Object
+        TopTools_IndexedMapOfShape aMS;
+        TopExp::MapShapes(aUnits(i), aMS);
+        for (Standard_Integer j = 1; j <= aMS.Extent(); ++j)
+        {
+          if (BRepTools_History::IsSupportedType(aMS(j)))
+          {
+            myHistory->Remove(aMS(j));
+          }
+        }
+      }
+      continue;
+    }
+    //
+    if (aGroupAdded(iG))
+    {
+      continue;
+    }
+    aGroupAdded(iG) = Standard_True;
+    //
+    BOPAlgo_BOPGroup& aBOP = aVBOP.ChangeValue(iBOP);
+    for (TopoDS_Iterator aIt(aBOP.Shape()); aIt.More(); aIt.Next())
+    {
+      aBB.Add(aResult, aIt.Value());
+    }
+    if (myFillHistory)
+    {
+      myHistory->Merge(aBOP.History());
+    }
+  }
+  //
+  myShape = aResult;
+  return Standard_True;
+}
+
 //=======================================================================
 //function : Perform
 //purpose  : 
@@ -367,6 +737,12 @@ void BOPAlgo_BOP::Perform(const Message_ProgressRange& theRange)
     }
   }
   //
+  myIsBatchPerformed = Standard_False;
+  if (myBatchMode && PerformBatch(theRange)) {
+    myIsBatchPerformed = Standard_True;
+    return;
+  }
+  //
   aAllocator=
     NCollection_BaseAllocator::CommonBaseAllocator();
   TopTools_ListOfShape aLS(aAllocator);
@@ -392,6 +768,8 @@ void BOPAlgo_BOP::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetUseTriangulationFilter(myUseTriangulationFilter);
+  pPF->SetFaceFaceCache(myFaceFaceCache);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -60,6 +60,10 @@ class BOPAlgo_PaveFiller;
 //! - *BOPAlgo_AlertSolidBuilderFailed* - in case the BuilderSolid algorithm failed to
 //!                          produce the Fused solid.
 //!
+//! For the *CUT* operation the algorithm provides the batch mode (see SetBatchMode()),
+//! in which the arguments are split on the groups of spatially separated shapes,
+//! which are then processed independently and in parallel.<br>
+//!
 class BOPAlgo_BOP  : public BOPAlgo_ToolsProvider
 {
 public:
@@ -82,6 +86,54 @@ public:
   
   Standard_EXPORT virtual void Perform(const Message_ProgressRange& theRange = Message_ProgressRange()) Standard_OVERRIDE;
 
+public: //! @name Batch mode
+
+  //! Sets the batch mode for the *CUT* operation.<br>
+  //! In this mode the Objects and Tools are exploded on the non-compound shapes,
+  //! which are then distributed into the groups of interacting shapes using the
+  //! BVH tree of their bounding boxes. The groups containing both Objects and Tools
+  //! are cut independently and in parallel (if parallel mode is on), the Objects
+  //! not interacting with any Tool are passed into the result as is.<br>
+  //! The mode is useful for cutting the large sets of Objects by the large sets
+  //! of small Tools (e.g. patterns of holes in multiple parts), for which the global
+  //! intersection is replaced by the set of small local ones.<br>
+  //! The mode is applied in the Perform() method only, the intersection results
+  //! of the whole operation (PDS) are not available in this mode. In case the
+  //! arguments form a single group the usual algorithm is performed
+  //! (see IsBatchApplicable(), IsBatchPerformed()).<br>
+  //! Note that the Tools interacting with the same Object always fall into the group
+  //! of this Object, so that a single Object cut by many disjoint Tools is not split
+  //! on groups and is processed by the usual algorithm.
+  void SetBatchMode(const Standard_Boolean theFlag)
+  {
+    myBatchMode = theFlag;
+  }
+
+  //! Returns the flag of the batch mode.
+  Standard_Boolean BatchMode() const
+  {
+    return myBatchMode;
+  }
+
+  //! Returns TRUE if the current arguments of the *CUT* operation are split on
+  //! several groups of interacting shapes to be cut, i.e. if the operation
+  //! would be performed by groups in the batch mode.
+  Standard_EXPORT Standard_Boolean IsBatchApplicable() const;
+
+  //! Returns TRUE if the last operation has been performed in the batch mode,
+  //! i.e. by the groups of interacting shapes.
+  Standard_Boolean IsBatchPerformed() const
+  {
+    return myIsBatchPerformed;
+  }
+
+protected:
+
+  //! Performs the *CUT* operation by groups of interacting shapes in the batch mode.
+  //! Returns FALSE if the arguments cannot be split on several groups,
+  //! so that the usual algorithm has to be performed.
+  Standard_EXPORT Standard_Boolean PerformBatch(const Message_ProgressRange& theRange);
+
 protected:
   
   Standard_EXPORT virtual void CheckData() Standard_OVERRIDE;
@@ -127,6 +179,8 @@ protected:
   BOPAlgo_Operation myOperation;
   Standard_Integer  myDims[2];
   TopoDS_Shape      myRC;
+  Standard_Boolean  myBatchMode;
+  Standard_Boolean  myIsBatchPerformed;
 };
 
 #endif // _BOPAlgo_BOP_HeaderFile
@@ -199,6 +199,8 @@ void BOPAlgo_Builder::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetUseTriangulationFilter(myUseTriangulationFilter);
+  pPF->SetFaceFaceCache(myFaceFaceCache);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -217,6 +219,8 @@ void BOPAlgo_Builder::PerformWithFiller(const BOPAlgo_PaveFiller& theFiller, con
   myFuzzyValue = theFiller.FuzzyValue();
   myGlue = theFiller.Glue();
   myUseOBB = theFiller.UseOBB();
+  myUseTriangulationFilter = theFiller.UseTriangulationFilter();
+  myFaceFaceCache = theFiller.FaceFaceCache();
   PerformInternal(theFiller, theRange);
 }
 //=======================================================================
@@ -24,6 +24,7 @@
 
 #include <BOPAlgo_PPaveFiller.hxx>
 #include <BOPAlgo_BuilderShape.hxx>
+#include <BOPAlgo_FaceFaceCache.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
 #include <BOPAlgo_Operation.hxx>
 #include <BOPDS_PDS.hxx>
@@ -161,6 +162,20 @@ public: //! @name Options
     return myCheckInverted;
   }
 
+  //! Sets the cache of Face/Face intersection results, allowing to reuse
+  //! the results of intersection of unmodified faces in the consequent runs
+  //! of the algorithm on the modified arguments (see BOPAlgo_FaceFaceCache).
+  void SetFaceFaceCache(const Handle(BOPAlgo_FaceFaceCache)& theCache)
+  {
+    myFaceFaceCache = theCache;
+  }
+
+  //! Returns the cache of Face/Face intersection results
+  const Handle(BOPAlgo_FaceFaceCache)& FaceFaceCache() const
+  {
+    return myFaceFaceCache;
+  }
+
 
 public: //! @name Performing the operation
 
@@ -533,6 +548,7 @@ protected: //! @name Fields
   Standard_Boolean myNonDestructive;            //!< Safe processing option allows avoiding modification of the input shapes
   BOPAlgo_GlueEnum myGlue;                      //!< Gluing option allows speeding up the intersection of the input shapes
   Standard_Boolean myCheckInverted;             //!< Check inverted option allows disabling the check of input solids on inverted status
+  Handle(BOPAlgo_FaceFaceCache) myFaceFaceCache; //!< Cache of Face/Face intersection results to be passed to the Pave Filler
 
 };
 
@@ -30,6 +30,7 @@
 #include <IntTools_Context.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_List.hxx>
+#include <NCollection_Vector.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -62,6 +63,120 @@ static
   void MakeInternalShells(const TopTools_IndexedMapOfShape& ,
                           TopTools_ListOfShape& );
 
+//=======================================================================
+//class    : BOPAlgo_HoleShell
+//purpose  : Checks if the shell is a hole, i.e. if the infinite point
+//           is classified as IN relatively it
+//=======================================================================
+class BOPAlgo_HoleShell : public BOPAlgo_ParallelAlgo {
+
+ public:
+  DEFINE_STANDARD_ALLOC
+
+  BOPAlgo_HoleShell() :
+    BOPAlgo_ParallelAlgo(),
+    myIsHole(Standard_False) {
+  }
+  //
+  virtual ~BOPAlgo_HoleShell() {
+  }
+  //
+  void SetShell(const TopoDS_Shape& theShell) {
+    myShell = theShell;
+  }
+  //
+  const TopoDS_Shape& Shell() const {
+    return myShell;
+  }
+  //
+  Standard_Boolean IsHole() const {
+    return myIsHole;
+  }
+  //
+  void SetContext(const Handle(IntTools_Context)& theContext) {
+    myContext = theContext;
+  }
+  //
+  virtual void Perform() {
+    Message_ProgressScope aPS(myProgressRange, NULL, 1);
+    if (UserBreak(aPS))
+    {
+      return;
+    }
+    myIsHole = ::IsHole(myShell, myContext);
+  }
+  //
+ protected:
+  TopoDS_Shape myShell;
+  Standard_Boolean myIsHole;
+  Handle(IntTools_Context) myContext;
+};
+//
+typedef NCollection_Vector<BOPAlgo_HoleShell> BOPAlgo_VectorOfHoleShell;
+
+//=======================================================================
+//class    : BOPAlgo_SolidHoles
+//purpose  : Finds the hole shells located inside the solid
+//           among the given candidates
+//=======================================================================
+class BOPAlgo_SolidHoles : public BOPAlgo_ParallelAlgo {
+
+ public:
+  DEFINE_STANDARD_ALLOC
+
+  BOPAlgo_SolidHoles() :
+    BOPAlgo_ParallelAlgo() {
+  }
+  //
+  virtual ~BOPAlgo_SolidHoles() {
+  }
+  //
+  void SetSolid(const TopoDS_Shape& theSolid) {
+    mySolid = theSolid;
+  }
+  //
+  const TopoDS_Shape& Solid() const {
+    return mySolid;
+  }
+  //
+  void AddCandidate(const TopoDS_Shape& theHole) {
+    myCandidates.Append(theHole);
+  }
+  //
+  //! Returns the holes located inside the solid,
+  //! in the order of the candidates
+  const TopTools_ListOfShape& Holes() const {
+    return myHoles;
+  }
+  //
+  void SetContext(const Handle(IntTools_Context)& theContext) {
+    myContext = theContext;
+  }
+  //
+  virtual void Perform() {
+    Message_ProgressScope aPS(myProgressRange, NULL, 1);
+    if (UserBreak(aPS))
+    {
+      return;
+    }
+    TopTools_ListIteratorOfListOfShape aIt(myCandidates);
+    for (; aIt.More(); aIt.Next())
+    {
+      const TopoDS_Shape& aHole = aIt.Value();
+      if (IsInside(aHole, mySolid, myContext))
+        myHoles.Append(aHole);
+    }
+  }
+  //
+ protected:
+  TopoDS_Shape mySolid;
+  TopTools_ListOfShape myCandidates;
+  TopTools_ListOfShape myHoles;
+  Handle(IntTools_Context) myContext;
+};
+//
+typedef NCollection_Vector<BOPAlgo_SolidHoles> BOPAlgo_VectorOfSolidHoles;
+
 //=======================================================================
 //function : 
 //purpose  : 
@@ -393,20 +508,49 @@ void BOPAlgo_BuilderSolid::PerformAreas(const Message_ProgressRange& theRange)
 
   // Analyze the shells
   Message_ProgressScope aPSClass(aMainScope.Next(5), "Classify solids", myLoops.Size());
-  TopTools_ListIteratorOfListOfShape aItLL(myLoops);
-  for (; aItLL.More(); aItLL.Next(), aPSClass.Next())
+
+  // In parallel mode, classify all shells in advance. The classification
+  // result is not needed for the shells recognized as growths by the fast
+  // check below, but the fast check depends on the previously found holes,
+  // so it cannot be performed in advance. In sequential mode the shells
+  // are classified only when the fast check does not give the result.
+  BOPAlgo_VectorOfHoleShell aVHS;
+  if (myRunParallel)
   {
+    TopTools_ListIteratorOfListOfShape aItLL(myLoops);
+    for (; aItLL.More(); aItLL.Next())
+    {
+      BOPAlgo_HoleShell& aHS = aVHS.Appended();
+      aHS.SetShell(aItLL.Value());
+      aHS.SetRunParallel(myRunParallel);
+      aHS.SetProgressRange(aPSClass.Next());
+    }
+    BOPTools_Parallel::Perform (myRunParallel, aVHS, myContext);
     if (UserBreak (aPSClass))
     {
       return;
     }
+  }
+
+  TopTools_ListIteratorOfListOfShape aItLL(myLoops);
+  for (Standard_Integer iHS = 0; aItLL.More(); aItLL.Next(), ++iHS)
+  {
+    if (!myRunParallel)
+    {
+      if (UserBreak (aPSClass))
+      {
+        return;
+      }
+      aPSClass.Next();
+    }
     const TopoDS_Shape& aShell = aItLL.Value();
 
     Standard_Boolean bIsGrowth = IsGrowthShell(aShell, aMHF);
     if (!bIsGrowth)
     {
       // Fast check did not give the result, run classification
-      bIsGrowth = !IsHole(aShell, myContext);
+      // or use its result obtained in advance
+      bIsGrowth = myRunParallel ? !aVHS(iHS).IsHole() : !IsHole(aShell, myContext);
     }
 
     // Save the solid
@@ -460,17 +604,13 @@ void BOPAlgo_BuilderSolid::PerformAreas(const Message_ProgressRange& theRange)
   // Build BVH
   aBBTree.Build();
 
-  // Find outer growth shell that is most close to each hole shell
-  TopTools_IndexedDataMapOfShapeShape aHoleSolidMap;
+  // Find the hole shells located inside each solid (in parallel)
+  Message_ProgressScope aPSH(aMainScope.Next(4), "Adding holes", 2);
 
-  Message_ProgressScope aPSH(aMainScope.Next(4), "Adding holes", aNewSolids.Size());
+  BOPAlgo_VectorOfSolidHoles aVSH;
   TopTools_ListIteratorOfListOfShape aItLS(aNewSolids);
-  for (; aItLS.More(); aItLS.Next(), aPSH.Next())
+  for (; aItLS.More(); aItLS.Next())
   {
-    if (UserBreak (aPSH))
-    {
-      return;
-    }
     const TopoDS_Shape& aSolid = aItLS.Value();
 
     // Build box
@@ -485,14 +625,45 @@ void BOPAlgo_BuilderSolid::PerformAreas(const Message_ProgressRange& theRange)
     aSelector.Select();
 
     const TColStd_ListOfInteger& aLI = aSelector.Indices();
+    if (aLI.IsEmpty())
+      continue;
+
+    BOPAlgo_SolidHoles& aSH = aVSH.Appended();
+    aSH.SetSolid(aSolid);
+    aSH.SetRunParallel(myRunParallel);
     TColStd_ListIteratorOfListOfInteger aItLI(aLI);
     for (; aItLI.More(); aItLI.Next())
+      aSH.AddCandidate(aHoleShells(aItLI.Value()));
+  }
+  //
+  const Standard_Integer aNbSH = aVSH.Length();
+  Message_ProgressScope aPSSH(aPSH.Next(), NULL, aNbSH);
+  for (Standard_Integer iSH = 0; iSH < aNbSH; ++iSH)
+  {
+    aVSH.ChangeValue(iSH).SetProgressRange(aPSSH.Next());
+  }
+  BOPTools_Parallel::Perform (myRunParallel, aVSH, myContext);
+  if (UserBreak (aPSH))
+  {
+    return;
+  }
+
+  // Find outer growth shell that is most close to each hole shell
+  TopTools_IndexedDataMapOfShapeShape aHoleSolidMap;
+
+  Message_ProgressScope aPSRel(aPSH.Next(), NULL, aNbSH);
+  for (Standard_Integer iSH = 0; iSH < aNbSH; ++iSH, aPSRel.Next())
+  {
+    if (UserBreak (aPSRel))
     {
-      Standard_Integer k = aItLI.Value();
-      const TopoDS_Shape& aHole = aHoleShells(k);
-      // Check if it is inside
-      if (!IsInside(aHole, aSolid, myContext))
-        continue;
+      return;
+    }
+    const TopoDS_Shape& aSolid = aVSH(iSH).Solid();
+
+    TopTools_ListIteratorOfListOfShape aItLH(aVSH(iSH).Holes());
+    for (; aItLH.More(); aItLH.Next())
+    {
+      const TopoDS_Shape& aHole = aItLH.Value();
 
       // Save the relation
       TopoDS_Shape* pSolidWas = aHoleSolidMap.ChangeSeek(aHole);
@@ -155,7 +155,7 @@ void BOPAlgo_CheckerSI::Init(const Message_ProgressRange& /*theRange*/)
   // 3.myIterator 
   BOPDS_PIteratorSI theIterSI=new BOPDS_IteratorSI(myAllocator);
   theIterSI->SetDS(myDS);
-  theIterSI->Prepare(myContext, myUseOBB, myFuzzyValue);
+  theIterSI->Prepare(myContext, myUseOBB, myFuzzyValue, myUseTriangulationFilter);
   theIterSI->UpdateByLevelOfCheck(myLevelOfCheck);
   //
   myIterator=theIterSI;
@@ -0,0 +1,244 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_FaceFaceCache.hxx>
+
+#include <IntSurf_PntOn2S.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BOPAlgo_FaceFaceCache, Standard_Transient)
+
+namespace
+{
+  //=======================================================================
+  //function : isSameBox
+  //purpose  : Checks if the boxes are exactly the same
+  //=======================================================================
+  static Standard_Boolean isSameBox (const Bnd_Box& theBox1,
+                                     const Bnd_Box& theBox2)
+  {
+    if (theBox1.IsVoid() || theBox2.IsVoid())
+    {
+      return theBox1.IsVoid() == theBox2.IsVoid();
+    }
+    Standard_Real aMin1[3], aMax1[3], aMin2[3], aMax2[3];
+    theBox1.Get (aMin1[0], aMin1[1], aMin1[2], aMax1[0], aMax1[1], aMax1[2]);
+    theBox2.Get (aMin2[0], aMin2[1], aMin2[2], aMax2[0], aMax2[1], aMax2[2]);
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      if (aMin1[i] != aMin2[i] || aMax1[i] != aMax2[i])
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+
+  //=======================================================================
+  //function : isSamePoints
+  //purpose  : Checks if the lists of starting points are exactly the same
+  //=======================================================================
+  static Standard_Boolean isSamePoints (const IntSurf_ListOfPntOn2S& theList1,
+                                        const IntSurf_ListOfPntOn2S& theList2)
+  {
+    if (theList1.Extent() != theList2.Extent())
+    {
+      return Standard_False;
+    }
+    IntSurf_ListOfPntOn2S::Iterator anIt1 (theList1), anIt2 (theList2);
+    for (; anIt1.More(); anIt1.Next(), anIt2.Next())
+    {
+      Standard_Real aPar1[4], aPar2[4];
+      anIt1.Value().Parameters (aPar1[0], aPar1[1], aPar1[2], aPar1[3]);
+      anIt2.Value().Parameters (aPar2[0], aPar2[1], aPar2[2], aPar2[3]);
+      for (Standard_Integer i = 0; i < 4; ++i)
+      {
+        if (aPar1[i] != aPar2[i])
+        {
+          return Standard_False;
+        }
+      }
+    }
+    return Standard_True;
+  }
+}
+
+//=======================================================================
+//function : IsSameInput
+//purpose  :
+//=======================================================================
+Standard_Boolean BOPAlgo_FaceFaceCache::Entry::IsSameInput (const Entry& theOther) const
+{
+  return Face1.IsEqual (theOther.Face1)
+      && Face2.IsEqual (theOther.Face2)
+      && TolF1 == theOther.TolF1
+      && TolF2 == theOther.TolF2
+      && TolFF == theOther.TolFF
+      && FuzzyValue == theOther.FuzzyValue
+      && ApproxTol == theOther.ApproxTol
+      && Approx == theOther.Approx
+      && PCurveOnS1 == theOther.PCurveOnS1
+      && PCurveOnS2 == theOther.PCurveOnS2
+      && isSameBox (Box1, theOther.Box1)
+      && isSameBox (Box2, theOther.Box2)
+      && isSamePoints (StartPoints, theOther.StartPoints);
+}
+
+//=======================================================================
+//function : BOPAlgo_FaceFaceCache
+//purpose  :
+//=======================================================================
+BOPAlgo_FaceFaceCache::BOPAlgo_FaceFaceCache()
+: myNbReused (0),
+  myNbComputed (0),
+  myNbRunning (0)
+{
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BOPAlgo_FaceFaceCache::Clear()
+{
+  myEntries.Clear();
+  myNbReused = 0;
+  myNbComputed = 0;
+}
+
+//=======================================================================
+//function : Size
+//purpose  :
+//=======================================================================
+Standard_Integer BOPAlgo_FaceFaceCache::Size() const
+{
+  Standard_Integer aNb = 0;
+  for (DataMapOfFaceEntries::Iterator anIt (myEntries); anIt.More(); anIt.Next())
+  {
+    aNb += anIt.Value().Extent();
+  }
+  return aNb;
+}
+
+//=======================================================================
+//function : BeginOperation
+//purpose  :
+//=======================================================================
+void BOPAlgo_FaceFaceCache::BeginOperation()
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  if (myNbRunning++ > 0)
+  {
+    return;
+  }
+  myNbReused = 0;
+  myNbComputed = 0;
+  for (DataMapOfFaceEntries::Iterator anIt (myEntries); anIt.More(); anIt.Next())
+  {
+    for (ListOfEntry::Iterator anItE (anIt.ChangeValue()); anItE.More(); anItE.Next())
+    {
+      anItE.ChangeValue().myIsUsed = Standard_False;
+    }
+  }
+}
+
+//=======================================================================
+//function : Find
+//purpose  :
+//=======================================================================
+const BOPAlgo_FaceFaceCache::Entry* BOPAlgo_FaceFaceCache::Find (const Entry& theRequest)
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  ListOfEntry* aList = myEntries.ChangeSeek (theRequest.Face1);
+  if (aList != NULL)
+  {
+    for (ListOfEntry::Iterator anIt (*aList); anIt.More(); anIt.Next())
+    {
+      Entry& anEntry = anIt.ChangeValue();
+      if (anEntry.IsSameInput (theRequest))
+      {
+        anEntry.myIsUsed = Standard_True;
+        ++myNbReused;
+        return &anEntry;
+      }
+    }
+  }
+  ++myNbComputed;
+  return NULL;
+}
+
+//=======================================================================
+//function : Add
+//purpose  :
+//=======================================================================
+void BOPAlgo_FaceFaceCache::Add (const Entry& theEntry)
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  ListOfEntry* aList = myEntries.ChangeSeek (theEntry.Face1);
+  if (aList == NULL)
+  {
+    aList = myEntries.Bound (theEntry.Face1, ListOfEntry());
+  }
+  for (ListOfEntry::Iterator anIt (*aList); anIt.More(); )
+  {
+    // Replace outdated results for the same pair of faces
+    if (anIt.Value().Face1.IsEqual (theEntry.Face1)
+     && anIt.Value().Face2.IsEqual (theEntry.Face2))
+    {
+      aList->Remove (anIt);
+    }
+    else
+    {
+      anIt.Next();
+    }
+  }
+  Entry& anEntry = aList->Append (theEntry);
+  anEntry.myIsUsed = Standard_True;
+}
+
+//=======================================================================
+//function : EndOperation
+//purpose  :
+//=======================================================================
+void BOPAlgo_FaceFaceCache::EndOperation (const Standard_Boolean theToRemoveUnused)
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  if ((myNbRunning > 0 && --myNbRunning > 0)
+   || !theToRemoveUnused)
+  {
+    return;
+  }
+  NCollection_List<TopoDS_Shape> anEmptyKeys;
+  for (DataMapOfFaceEntries::Iterator anIt (myEntries); anIt.More(); anIt.Next())
+  {
+    ListOfEntry& aList = anIt.ChangeValue();
+    for (ListOfEntry::Iterator anItE (aList); anItE.More(); )
+    {
+      if (!anItE.Value().myIsUsed)
+      {
+        aList.Remove (anItE);
+      }
+      else
+      {
+        anItE.Next();
+      }
+    }
+    if (aList.IsEmpty())
+    {
+      anEmptyKeys.Append (anIt.Key());
+    }
+  }
+  for (NCollection_List<TopoDS_Shape>::Iterator anIt (anEmptyKeys); anIt.More(); anIt.Next())
+  {
+    myEntries.UnBind (anIt.Value());
+  }
+}
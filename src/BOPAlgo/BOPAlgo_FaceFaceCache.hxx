@@ -0,0 +1,181 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_FaceFaceCache_HeaderFile
+#define _BOPAlgo_FaceFaceCache_HeaderFile
+
+#include <Bnd_Box.hxx>
+#include <IntSurf_ListOfPntOn2S.hxx>
+#include <IntTools_SequenceOfCurves.hxx>
+#include <IntTools_SequenceOfPntOn2Faces.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+//! Cache of the Face/Face intersection results to be shared between
+//! several runs of the Intersection algorithm (BOPAlgo_PaveFiller).
+//!
+//! Face/Face intersection is usually the most time consuming step of the Boolean operations.
+//! In workflows re-running the same operation after a local modification of the arguments
+//! (e.g. parametric modeling with modification of a single feature) most of the pairs
+//! of faces remain untouched, so their intersection results may be reused.
+//!
+//! Results are stored for the pair of faces together with all the input data of the
+//! intersection (faces with their locations and orientations, tolerances, bounding boxes,
+//! intersection options and starting points), and are reused only if all these data
+//! are the same. Thus, any modification of the face (its geometry or location) or of its
+//! boundary affecting the intersection leads to recomputation of the intersection.
+//! Note, that modified geometry should be represented by the new TShape of the face, as
+//! the faces are compared by TShape pointer (shapes keep the cached TShapes alive).
+//!
+//! Only the pairs requested during the last operation are kept in the cache,
+//! so that the cache does not grow in the loop of modifications.
+//! The cache can be shared between the operations performed concurrently on disjoint
+//! sets of faces (e.g. groups of the batch mode of BOPAlgo_BOP). Such operations should be
+//! nested into the outer BeginOperation()/EndOperation() pair, so that the entries used by
+//! any of them are kept till the end of the outer operation.
+class BOPAlgo_FaceFaceCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BOPAlgo_FaceFaceCache, Standard_Transient)
+public:
+
+  //! Input data and results of intersection of the pair of faces.
+  struct Entry
+  {
+    // Input data
+    TopoDS_Face           Face1;        //!< First face (possibly shifted)
+    TopoDS_Face           Face2;        //!< Second face (possibly shifted)
+    Standard_Real         TolF1;        //!< Tolerance of the first face
+    Standard_Real         TolF2;        //!< Tolerance of the second face
+    Standard_Real         TolFF;        //!< Tolerance of the intersection
+    Standard_Real         FuzzyValue;   //!< Additional tolerance
+    Standard_Real         ApproxTol;    //!< Approximation tolerance
+    Standard_Boolean      Approx;       //!< Approximation flag
+    Standard_Boolean      PCurveOnS1;   //!< Flag for building 2D curves on the first face
+    Standard_Boolean      PCurveOnS2;   //!< Flag for building 2D curves on the second face
+    Bnd_Box               Box1;         //!< Bounding box of the first face
+    Bnd_Box               Box2;         //!< Bounding box of the second face
+    IntSurf_ListOfPntOn2S StartPoints;  //!< Starting points for intersection
+    // Results
+    Standard_Boolean               TangentFaces; //!< Tangent faces flag
+    IntTools_SequenceOfCurves      Curves;       //!< Intersection curves (already post-treated)
+    IntTools_SequenceOfPntOn2Faces Points;       //!< Intersection points
+
+    Entry()
+    : TolF1 (0.0), TolF2 (0.0), TolFF (0.0), FuzzyValue (0.0), ApproxTol (0.0),
+      Approx (Standard_False), PCurveOnS1 (Standard_False), PCurveOnS2 (Standard_False),
+      TangentFaces (Standard_False), myIsUsed (Standard_False) {}
+
+    //! Checks if the input data of this entry is the same as of the other one.
+    Standard_EXPORT Standard_Boolean IsSameInput (const Entry& theOther) const;
+
+  private:
+    friend class BOPAlgo_FaceFaceCache;
+    Standard_Boolean myIsUsed; //!< Flag indicating that the entry has been requested during the last operation
+  };
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT BOPAlgo_FaceFaceCache();
+
+  //! Removes all cached results.
+  Standard_EXPORT void Clear();
+
+  //! Returns the number of cached pairs of faces.
+  Standard_EXPORT Standard_Integer Size() const;
+
+  //! Returns the number of pairs which intersection results
+  //! have been reused during the last operation.
+  Standard_Integer NbReused() const { return myNbReused; }
+
+  //! Returns the number of pairs which have been intersected
+  //! during the last operation.
+  Standard_Integer NbComputed() const { return myNbComputed; }
+
+public: //! @name Methods used by the Intersection algorithm
+
+  //! Starts new operation: resets the statistics and usage flags of the entries.
+  //! Nested calls only increment the counter of running operations.
+  Standard_EXPORT void BeginOperation();
+
+  //! Looks for the cached results for the given input data.
+  //! Marks the found entry as used in the current operation.
+  //! @param[in] theRequest  input data of intersection
+  //! @return cached entry or NULL if the pair has to be intersected
+  Standard_EXPORT const Entry* Find (const Entry& theRequest);
+
+  //! Adds the intersection results to the cache, replacing the entry with the same faces.
+  Standard_EXPORT void Add (const Entry& theEntry);
+
+  //! Ends the operation: removes all entries not used during the operation.
+  //! The entries are removed on ending the outermost operation only.
+  //! @param[in] theToRemoveUnused  flag to remove the unused entries;
+  //!                               should be FALSE for the interrupted operation
+  Standard_EXPORT void EndOperation (const Standard_Boolean theToRemoveUnused = Standard_True);
+
+  //! Auxiliary tool starting the operation of the cache (if defined) in constructor
+  //! and ending it in destructor. All entries are kept in case the operation
+  //! has not been completed (e.g. interrupted by user).
+  class OperationSentry
+  {
+  public:
+    OperationSentry (const Handle(BOPAlgo_FaceFaceCache)& theCache)
+    : myCache (theCache),
+      myIsCompleted (Standard_False)
+    {
+      if (!myCache.IsNull())
+      {
+        myCache->BeginOperation();
+      }
+    }
+
+    ~OperationSentry()
+    {
+      if (!myCache.IsNull())
+      {
+        myCache->EndOperation (myIsCompleted);
+      }
+    }
+
+    //! Marks the operation as completed.
+    void SetCompleted() { myIsCompleted = Standard_True; }
+
+  private:
+    OperationSentry (const OperationSentry& );
+    OperationSentry& operator= (const OperationSentry& );
+
+  private:
+    Handle(BOPAlgo_FaceFaceCache) myCache;
+    Standard_Boolean myIsCompleted;
+  };
+
+protected:
+
+  typedef NCollection_List<Entry> ListOfEntry;
+  typedef NCollection_DataMap<TopoDS_Shape, ListOfEntry, TopTools_ShapeMapHasher> DataMapOfFaceEntries;
+
+  DataMapOfFaceEntries myEntries;    //!< Cached entries, bound to the first face of the pair
+  Standard_Integer     myNbReused;   //!< Number of reused results in the last operation
+  Standard_Integer     myNbComputed; //!< Number of computed pairs in the last operation
+  Standard_Integer     myNbRunning;  //!< Number of running (nested) operations
+  Standard_Mutex       myMutex;      //!< Protects the entries accessed by concurrent operations
+
+};
+
+DEFINE_STANDARD_HANDLE(BOPAlgo_FaceFaceCache, Standard_Transient)
+
+#endif // _BOPAlgo_FaceFaceCache_HeaderFile
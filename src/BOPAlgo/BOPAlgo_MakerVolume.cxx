@@ -93,6 +93,7 @@ void BOPAlgo_MakerVolume::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetUseTriangulationFilter(myUseTriangulationFilter);
   pPF->Perform(aPS.Next(anInterPart));
   //
   myEntryPoint = 1;
@@ -0,0 +1,1064 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_MeshBoolean.hxx>
+
+#include <BOPAlgo_Alerts.hxx>
+#include <BOPTools_BoxTree.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_XY.hxx>
+#include <math_BullardGenerator.hxx>
+#include <math_RobustPredicates.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <TColStd_ListOfInteger.hxx>
+
+namespace
+{
+  //! Maximal number of parts of the single triangle split by the other mesh
+  static const Standard_Integer THE_MAX_NB_PARTS = 512;
+
+  //! Maximal number of rays cast from the point to classify it
+  static const Standard_Integer THE_MAX_NB_RAYS = 16;
+
+  //! Returns the sign of the value.
+  inline Standard_Integer signOf (const double theValue)
+  {
+    return theValue > 0.0 ? 1 : (theValue < 0.0 ? -1 : 0);
+  }
+
+  //! Returns the projection of the point on the coordinate plane
+  //! orthogonal to the given axis, keeping the orientation.
+  inline gp_XY project (const gp_XYZ& thePnt, const Standard_Integer theAxis)
+  {
+    switch (theAxis)
+    {
+      case 1:  return gp_XY (thePnt.Y(), thePnt.Z());
+      case 2:  return gp_XY (thePnt.Z(), thePnt.X());
+      default: return gp_XY (thePnt.X(), thePnt.Y());
+    }
+  }
+
+  //! Checks if the points are collinear (exactly).
+  static Standard_Boolean isCollinear (const gp_XYZ& theP1, const gp_XYZ& theP2, const gp_XYZ& theP3)
+  {
+    for (Standard_Integer anAxis = 1; anAxis <= 3; ++anAxis)
+    {
+      if (math_RobustPredicates::Orient2d (project (theP1, anAxis), project (theP2, anAxis), project (theP3, anAxis)) != 0.0)
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+
+  //! State of the point relatively the closed mesh
+  enum MeshState
+  {
+    MeshState_Out,
+    MeshState_In,
+    MeshState_OnSame,    //!< On the triangle with the same direction of normal
+    MeshState_OnOpposite //!< On the triangle with the opposite direction of normal
+  };
+
+  //! Triangle of the mesh
+  struct MeshTriangle
+  {
+    Standard_Integer Nodes[3]; //!< Indices of nodes (zero-based)
+    gp_XYZ           Normal;   //!< Unit normal (approximate, used for orientation only)
+    Standard_Integer Axis;     //!< Coordinate axis of the maximal component of normal
+    gp_XYZ           Min;      //!< Min corner of the box of triangle
+    gp_XYZ           Max;      //!< Max corner of the box of triangle
+  };
+
+  //! Vertex of the part of the split triangle
+  struct PartVertex
+  {
+    gp_XYZ           Point;     //!< Point of the vertex
+    Standard_Integer Planes[2]; //!< Cutting triangles of the other mesh containing the vertex by construction (or -1)
+  };
+
+  //! Part of the split triangle
+  struct MeshPart
+  {
+    gp_XYZ Nodes[3];
+  };
+
+  //! Mesh prepared for the operation
+  struct MeshData
+  {
+    NCollection_Vector<gp_XYZ>       Nodes;
+    NCollection_Vector<MeshTriangle> Triangles;
+    BOPTools_BoxTree                 Tree;
+    gp_XYZ                           Min;
+    gp_XYZ                           Max;
+
+    //! Returns the node of the triangle
+    const gp_XYZ& Node (const MeshTriangle& theTri, const Standard_Integer theIndex) const
+    {
+      return Nodes (theTri.Nodes[theIndex]);
+    }
+
+    //! Returns the orientation of the point relatively the plane of the triangle
+    double Orient (const MeshTriangle& theTri, const gp_XYZ& thePnt) const
+    {
+      return math_RobustPredicates::Orient3d (Node (theTri, 0), Node (theTri, 1), Node (theTri, 2), thePnt);
+    }
+
+    //! Returns the side of the plane of the triangle on which the point lies
+    Standard_Integer Side (const MeshTriangle& theTri, const gp_XYZ& thePnt) const
+    {
+      return signOf (Orient (theTri, thePnt));
+    }
+  };
+
+  //=======================================================================
+  //function : isCoplanar
+  //purpose  : Checks if the triangle lies in the plane of the other one (exactly)
+  //=======================================================================
+  static Standard_Boolean isCoplanar (const MeshData& thePlaneMesh,
+                                      const MeshTriangle& thePlane,
+                                      const MeshData& theMesh,
+                                      const MeshTriangle& theTri)
+  {
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      if (thePlaneMesh.Side (thePlane, theMesh.Node (theTri, i)) != 0)
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+
+  //=======================================================================
+  //function : isInTriangle
+  //purpose  : Checks if the point lying in the plane of triangle is inside
+  //           it or on its boundary
+  //=======================================================================
+  static Standard_Boolean isInTriangle (const MeshData& theMesh,
+                                        const MeshTriangle& theTri,
+                                        const gp_XYZ& thePnt)
+  {
+    const gp_XY aPnt = project (thePnt, theTri.Axis);
+    Standard_Boolean hasPos = Standard_False, hasNeg = Standard_False;
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      const Standard_Integer aSign =
+        signOf (math_RobustPredicates::Orient2d (project (theMesh.Node (theTri, i), theTri.Axis),
+                                                 project (theMesh.Node (theTri, (i + 1) % 3), theTri.Axis),
+                                                 aPnt));
+      hasPos |= (aSign > 0);
+      hasNeg |= (aSign < 0);
+    }
+    return !(hasPos && hasNeg);
+  }
+
+  //! Result of the check of the line crossing the triangle
+  enum LineCrossing
+  {
+    LineCrossing_None,     //!< The line does not cross the triangle
+    LineCrossing_Interior, //!< The line crosses the interior of the triangle
+    LineCrossing_Boundary  //!< The line passes through the edge or vertex of the triangle
+  };
+
+  //=======================================================================
+  //function : lineCrossing
+  //purpose  : Checks if the line passing through the points crosses the
+  //           triangle, not coplanar with the line
+  //=======================================================================
+  static LineCrossing lineCrossing (const gp_XYZ& theP1,
+                                    const gp_XYZ& theP2,
+                                    const MeshData& theMesh,
+                                    const MeshTriangle& theTri)
+  {
+    Standard_Boolean hasPos = Standard_False, hasNeg = Standard_False, hasZero = Standard_False;
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      const Standard_Integer aSign =
+        signOf (math_RobustPredicates::Orient3d (theP1, theP2,
+                                                 theMesh.Node (theTri, i),
+                                                 theMesh.Node (theTri, (i + 1) % 3)));
+      hasPos  |= (aSign > 0);
+      hasNeg  |= (aSign < 0);
+      hasZero |= (aSign == 0);
+    }
+    if (hasPos && hasNeg)
+    {
+      return LineCrossing_None;
+    }
+    return hasZero ? LineCrossing_Boundary : LineCrossing_Interior;
+  }
+
+  //=======================================================================
+  //function : prepareMesh
+  //purpose  : Copies the nodes and non-degenerated triangles of the
+  //           triangulation and builds the BVH tree of triangles
+  //=======================================================================
+  static void prepareMesh (const Handle(Poly_Triangulation)& theTris,
+                           MeshData& theMesh)
+  {
+    const Standard_Integer aNbNodes = theTris->NbNodes();
+    for (Standard_Integer i = 1; i <= aNbNodes; ++i)
+    {
+      theMesh.Nodes.Append (theTris->Node (i).XYZ());
+    }
+
+    const Standard_Integer aNbTris = theTris->NbTriangles();
+    for (Standard_Integer i = 1; i <= aNbTris; ++i)
+    {
+      MeshTriangle aTri;
+      theTris->Triangle (i).Get (aTri.Nodes[0], aTri.Nodes[1], aTri.Nodes[2]);
+      const gp_XYZ& aP1 = theMesh.Nodes (--aTri.Nodes[0]);
+      const gp_XYZ& aP2 = theMesh.Nodes (--aTri.Nodes[1]);
+      const gp_XYZ& aP3 = theMesh.Nodes (--aTri.Nodes[2]);
+      aTri.Normal = (aP2 - aP1).Crossed (aP3 - aP1);
+      const Standard_Real aMod = aTri.Normal.Modulus();
+      if (aMod == 0.0 || isCollinear (aP1, aP2, aP3))
+      {
+        // degenerated triangle
+        continue;
+      }
+      aTri.Normal /= aMod;
+      aTri.Axis = 1;
+      for (Standard_Integer j = 2; j <= 3; ++j)
+      {
+        if (Abs (aTri.Normal.Coord (j)) > Abs (aTri.Normal.Coord (aTri.Axis)))
+        {
+          aTri.Axis = j;
+        }
+      }
+      for (Standard_Integer j = 1; j <= 3; ++j)
+      {
+        aTri.Min.SetCoord (j, Min (aP1.Coord (j), Min (aP2.Coord (j), aP3.Coord (j))));
+        aTri.Max.SetCoord (j, Max (aP1.Coord (j), Max (aP2.Coord (j), aP3.Coord (j))));
+      }
+      theMesh.Triangles.Append (aTri);
+    }
+
+    const Standard_Integer aNbValid = theMesh.Triangles.Length();
+    theMesh.Min = gp_XYZ (RealLast(), RealLast(), RealLast());
+    theMesh.Max = gp_XYZ (RealFirst(), RealFirst(), RealFirst());
+    theMesh.Tree.SetSize (aNbValid);
+    for (Standard_Integer i = 0; i < aNbValid; ++i)
+    {
+      const MeshTriangle& aTri = theMesh.Triangles (i);
+      theMesh.Min.SetCoord (Min (theMesh.Min.X(), aTri.Min.X()),
+                            Min (theMesh.Min.Y(), aTri.Min.Y()),
+                            Min (theMesh.Min.Z(), aTri.Min.Z()));
+      theMesh.Max.SetCoord (Max (theMesh.Max.X(), aTri.Max.X()),
+                            Max (theMesh.Max.Y(), aTri.Max.Y()),
+                            Max (theMesh.Max.Z(), aTri.Max.Z()));
+      theMesh.Tree.Add (i, BVH_Box<Standard_Real, 3> (BVH_Vec3d (aTri.Min.X(), aTri.Min.Y(), aTri.Min.Z()),
+                                                      BVH_Vec3d (aTri.Max.X(), aTri.Max.Y(), aTri.Max.Z())));
+    }
+    theMesh.Tree.Build();
+  }
+
+  //=======================================================================
+  //function : isStraddling
+  //purpose  : Checks if the sides of the vertices have both signs
+  //=======================================================================
+  static Standard_Boolean isStraddling (const Standard_Integer theSides[3])
+  {
+    Standard_Boolean hasPos = Standard_False, hasNeg = Standard_False;
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      hasPos |= (theSides[i] > 0);
+      hasNeg |= (theSides[i] < 0);
+    }
+    return hasPos && hasNeg;
+  }
+
+  //=======================================================================
+  //function : isEdgeCrossing
+  //purpose  : Checks if some edge of the first triangle meets the second one.
+  //           theSides are the sides of the vertices of the first triangle
+  //           relatively the plane of the second one.
+  //=======================================================================
+  static Standard_Boolean isEdgeCrossing (const MeshData& theMesh1,
+                                          const MeshTriangle& theTri1,
+                                          const Standard_Integer theSides[3],
+                                          const MeshData& theMesh2,
+                                          const MeshTriangle& theTri2)
+  {
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      const Standard_Integer j = (i + 1) % 3;
+      if (theSides[i] * theSides[j] > 0
+       || (theSides[i] == 0 && theSides[j] == 0))
+      {
+        // The edge does not reach the plane or lies in it
+        continue;
+      }
+      if (lineCrossing (theMesh1.Node (theTri1, i), theMesh1.Node (theTri1, j), theMesh2, theTri2) != LineCrossing_None)
+      {
+        return Standard_True;
+      }
+    }
+    return Standard_False;
+  }
+
+  //=======================================================================
+  //class    : MeshIntersector
+  //purpose  : Checks the pairs of triangles of two meshes on intersection
+  //           and defines which triangles of the pair have to be split
+  //=======================================================================
+  class MeshIntersector
+  {
+  public:
+    MeshIntersector (const MeshData* theMeshes,
+                     const std::vector<BOPTools_BoxPairSelector::PairIDs>& thePairs,
+                     NCollection_Array1<Standard_Integer>& theFlags)
+    : myMeshes (theMeshes), myPairs (thePairs), myFlags (theFlags) {}
+
+    //! Sets the flags for the pair: 1 - the first triangle is to be split, 2 - the second one.
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const MeshTriangle& aT1 = myMeshes[0].Triangles (myPairs[theIndex].ID1);
+      const MeshTriangle& aT2 = myMeshes[1].Triangles (myPairs[theIndex].ID2);
+      Standard_Integer aS1[3], aS2[3];
+      for (Standard_Integer i = 0; i < 3; ++i)
+      {
+        aS1[i] = myMeshes[1].Side (aT2, myMeshes[0].Node (aT1, i));
+        aS2[i] = myMeshes[0].Side (aT1, myMeshes[1].Node (aT2, i));
+      }
+      const Standard_Boolean isCut1 = isStraddling (aS1);
+      const Standard_Boolean isCut2 = isStraddling (aS2);
+      if (!isCut1 && !isCut2)
+      {
+        // The triangles are coplanar, touching or do not intersect at all,
+        // they do not need splitting.
+        return;
+      }
+      if ((!isCut1 && aS1[0] != 0 && aS1[1] != 0 && aS1[2] != 0)
+       || (!isCut2 && aS2[0] != 0 && aS2[1] != 0 && aS2[2] != 0))
+      {
+        // One of the triangles is fully on one side of the plane of the other
+        return;
+      }
+      if (!isEdgeCrossing (myMeshes[0], aT1, aS1, myMeshes[1], aT2)
+       && !isEdgeCrossing (myMeshes[1], aT2, aS2, myMeshes[0], aT1))
+      {
+        // The lines of intersection with the plane of other triangle do not overlap
+        return;
+      }
+      myFlags (theIndex) = (isCut1 ? 1 : 0) | (isCut2 ? 2 : 0);
+    }
+
+  private:
+    const MeshData* myMeshes;
+    const std::vector<BOPTools_BoxPairSelector::PairIDs>& myPairs;
+    NCollection_Array1<Standard_Integer>& myFlags;
+  };
+
+  //=======================================================================
+  //function : isBoxOut
+  //purpose  : Checks if the box of the polygon is out of the box of triangle
+  //=======================================================================
+  static Standard_Boolean isBoxOut (const NCollection_Vector<PartVertex>& thePolygon,
+                                    const MeshTriangle& theTri)
+  {
+    for (Standard_Integer j = 1; j <= 3; ++j)
+    {
+      Standard_Real aMin = RealLast(), aMax = RealFirst();
+      for (NCollection_Vector<PartVertex>::Iterator anIt (thePolygon); anIt.More(); anIt.Next())
+      {
+        aMin = Min (aMin, anIt.Value().Point.Coord (j));
+        aMax = Max (aMax, anIt.Value().Point.Coord (j));
+      }
+      if (aMax < theTri.Min.Coord (j) || aMin > theTri.Max.Coord (j))
+      {
+        return Standard_True;
+      }
+    }
+    return Standard_False;
+  }
+
+  //=======================================================================
+  //class    : MeshSplitter
+  //purpose  : Splits the triangles by the planes of the crossing
+  //           triangles of the other mesh
+  //=======================================================================
+  class MeshSplitter
+  {
+  public:
+    MeshSplitter (const MeshData& theMesh,
+                  const MeshData& theOther,
+                  const NCollection_Vector<Standard_Integer>& theTriangles,
+                  const NCollection_Array1<TColStd_ListOfInteger>& theCutters,
+                  NCollection_Array1<NCollection_Vector<MeshPart> >& theParts)
+    : myMesh (theMesh), myOther (theOther), myTriangles (theTriangles),
+      myCutters (theCutters), myParts (theParts) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Standard_Integer aTriIndex = myTriangles (theIndex);
+      const MeshTriangle& aTri = myMesh.Triangles (aTriIndex);
+
+      NCollection_Vector<NCollection_Vector<PartVertex> > aPolygons;
+      NCollection_Vector<PartVertex>& aFirst = aPolygons.Appended();
+      for (Standard_Integer i = 0; i < 3; ++i)
+      {
+        PartVertex& aVertex = aFirst.Appended();
+        aVertex.Point = myMesh.Node (aTri, i);
+        aVertex.Planes[0] = aVertex.Planes[1] = -1;
+      }
+
+      for (TColStd_ListOfInteger::Iterator anIt (myCutters (aTriIndex)); anIt.More(); anIt.Next())
+      {
+        const Standard_Integer aCutter = anIt.Value();
+        NCollection_Vector<NCollection_Vector<PartVertex> > aSplit;
+        for (NCollection_Vector<NCollection_Vector<PartVertex> >::Iterator aItP (aPolygons); aItP.More(); aItP.Next())
+        {
+          const NCollection_Vector<PartVertex>& aPolygon = aItP.Value();
+          if (aPolygons.Length() + aSplit.Length() < THE_MAX_NB_PARTS
+          && !isBoxOut (aPolygon, myOther.Triangles (aCutter)))
+          {
+            NCollection_Vector<PartVertex> aPos, aNeg;
+            if (splitPolygon (aPolygon, aCutter, aPos, aNeg))
+            {
+              aSplit.Append (aPos);
+              aSplit.Append (aNeg);
+              continue;
+            }
+          }
+          aSplit.Append (aPolygon);
+        }
+        aPolygons = aSplit;
+      }
+
+      // Triangulate the convex polygons by fans
+      NCollection_Vector<MeshPart>& aParts = myParts (theIndex);
+      for (NCollection_Vector<NCollection_Vector<PartVertex> >::Iterator aItP (aPolygons); aItP.More(); aItP.Next())
+      {
+        const NCollection_Vector<PartVertex>& aPolygon = aItP.Value();
+        for (Standard_Integer i = 1; i + 1 < aPolygon.Length(); ++i)
+        {
+          const gp_XYZ& aP1 = aPolygon (0).Point;
+          const gp_XYZ& aP2 = aPolygon (i).Point;
+          const gp_XYZ& aP3 = aPolygon (i + 1).Point;
+          if (math_RobustPredicates::Orient2d (project (aP1, aTri.Axis), project (aP2, aTri.Axis), project (aP3, aTri.Axis)) == 0.0)
+          {
+            // degenerated part
+            continue;
+          }
+          MeshPart& aPart = aParts.Appended();
+          aPart.Nodes[0] = aP1;
+          aPart.Nodes[1] = aP2;
+          aPart.Nodes[2] = aP3;
+        }
+      }
+    }
+
+  private:
+
+    //! Returns the orientation of the vertex relatively the plane of the cutting triangle.
+    //! The vertex built on the plane coinciding with the plane of cutting triangle
+    //! is considered lying on it, though its computed point may deviate from the plane.
+    double orient (const PartVertex& theVertex, const Standard_Integer theCutter) const
+    {
+      const MeshTriangle& aCutter = myOther.Triangles (theCutter);
+      for (Standard_Integer i = 0; i < 2; ++i)
+      {
+        const Standard_Integer aPlane = theVertex.Planes[i];
+        if (aPlane == theCutter
+        || (aPlane >= 0 && isCoplanar (myOther, myOther.Triangles (aPlane), myOther, aCutter)))
+        {
+          return 0.0;
+        }
+      }
+      return myOther.Orient (aCutter, theVertex.Point);
+    }
+
+    //! Splits the convex polygon by the plane of the cutting triangle.
+    //! Returns false if the polygon is not crossed by the plane.
+    Standard_Boolean splitPolygon (const NCollection_Vector<PartVertex>& thePolygon,
+                                   const Standard_Integer theCutter,
+                                   NCollection_Vector<PartVertex>& thePos,
+                                   NCollection_Vector<PartVertex>& theNeg) const
+    {
+      const Standard_Integer aNb = thePolygon.Length();
+      NCollection_Vector<Standard_Real> aValues;
+      Standard_Boolean hasPos = Standard_False, hasNeg = Standard_False;
+      for (Standard_Integer i = 0; i < aNb; ++i)
+      {
+        const Standard_Real aValue = orient (thePolygon (i), theCutter);
+        hasPos |= (aValue > 0.);
+        hasNeg |= (aValue < 0.);
+        aValues.Append (aValue);
+      }
+      if (!hasPos || !hasNeg)
+      {
+        return Standard_False;
+      }
+
+      for (Standard_Integer i = 0; i < aNb; ++i)
+      {
+        const PartVertex& aV1 = thePolygon (i);
+        const Standard_Real aD1 = aValues (i);
+        if (aD1 >= 0.)
+        {
+          thePos.Append (aV1);
+        }
+        if (aD1 <= 0.)
+        {
+          theNeg.Append (aV1);
+        }
+        const Standard_Integer j = (i + 1) % aNb;
+        const Standard_Real aD2 = aValues (j);
+        if ((aD1 > 0. && aD2 < 0.) || (aD1 < 0. && aD2 > 0.))
+        {
+          // orientation is an affine function of the point, so that it is
+          // interpolated linearly along the edge
+          const PartVertex& aV2 = thePolygon (j);
+          PartVertex aVInt;
+          aVInt.Point = aV1.Point + (aV2.Point - aV1.Point) * (aD1 / (aD1 - aD2));
+          aVInt.Planes[0] = theCutter;
+          aVInt.Planes[1] = -1;
+          for (Standard_Integer k = 0; k < 2; ++k)
+          {
+            if (aV1.Planes[k] >= 0
+             && (aV1.Planes[k] == aV2.Planes[0] || aV1.Planes[k] == aV2.Planes[1]))
+            {
+              // the edge lies on the plane of previous cut
+              aVInt.Planes[1] = aV1.Planes[k];
+            }
+          }
+          thePos.Append (aVInt);
+          theNeg.Append (aVInt);
+        }
+      }
+      return thePos.Length() > 2 && theNeg.Length() > 2;
+    }
+
+  private:
+    const MeshData& myMesh;
+    const MeshData& myOther;
+    const NCollection_Vector<Standard_Integer>& myTriangles;
+    const NCollection_Array1<TColStd_ListOfInteger>& myCutters;
+    NCollection_Array1<NCollection_Vector<MeshPart> >& myParts;
+  };
+
+  //! Point to be classified relatively the mesh
+  struct ClassifiedPoint
+  {
+    Standard_Integer Mesh;     //!< Index of the mesh to which the point belongs
+    Standard_Integer Triangle; //!< Index of the triangle containing the point
+    gp_XYZ           Point;    //!< Point to classify
+    MeshState        State;    //!< State of the point relatively the other mesh
+  };
+
+  //=======================================================================
+  //function : isOnMesh
+  //purpose  : Checks if the point of the triangle is on the coplanar
+  //           triangle of the other mesh
+  //=======================================================================
+  static Standard_Boolean isOnMesh (MeshData& theMesh,
+                                    const MeshData& theSource,
+                                    const MeshTriangle& theSourceTri,
+                                    const gp_XYZ& thePnt,
+                                    MeshState& theState)
+  {
+    BOPTools_BoxTreeSelector aSelector;
+    aSelector.SetBVHSet (&theMesh.Tree);
+    aSelector.SetBox (BVH_Box<Standard_Real, 3> (BVH_Vec3d (thePnt.X(), thePnt.Y(), thePnt.Z()),
+                                                 BVH_Vec3d (thePnt.X(), thePnt.Y(), thePnt.Z())));
+    aSelector.Select();
+    for (TColStd_ListOfInteger::Iterator anIt (aSelector.Indices()); anIt.More(); anIt.Next())
+    {
+      const MeshTriangle& aTri = theMesh.Triangles (anIt.Value());
+      if (!isCoplanar (theMesh, aTri, theSource, theSourceTri)
+       || !isInTriangle (theMesh, aTri, thePnt))
+      {
+        continue;
+      }
+      theState = aTri.Normal.Dot (theSourceTri.Normal) > 0. ? MeshState_OnSame : MeshState_OnOpposite;
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+  //=======================================================================
+  //function : rayParity
+  //purpose  : Counts the intersections of the ray from the point with the mesh.
+  //           Returns false if the ray passes through the edges or vertices of mesh,
+  //           or lies in the plane of some triangle.
+  //=======================================================================
+  static Standard_Boolean rayParity (MeshData& theMesh,
+                                     const gp_XYZ& thePnt,
+                                     const gp_XYZ& theDir,
+                                     Standard_Integer& theNbHits)
+  {
+    // The ray is replaced by the segment ending out of the box of the mesh
+    const Standard_Real aLength = 2.0 * ((theMesh.Max - theMesh.Min).Modulus() + (thePnt - theMesh.Min).Modulus());
+    const gp_XYZ anEnd = thePnt + theDir * (aLength / theDir.Modulus());
+
+    BOPTools_BoxTreeSelector aSelector;
+    aSelector.SetBVHSet (&theMesh.Tree);
+    aSelector.SetBox (BVH_Box<Standard_Real, 3> (BVH_Vec3d (Min (thePnt.X(), anEnd.X()), Min (thePnt.Y(), anEnd.Y()), Min (thePnt.Z(), anEnd.Z())),
+                                                 BVH_Vec3d (Max (thePnt.X(), anEnd.X()), Max (thePnt.Y(), anEnd.Y()), Max (thePnt.Z(), anEnd.Z()))));
+    aSelector.Select();
+
+    theNbHits = 0;
+    Standard_Boolean isAmbiguous = Standard_False;
+    for (TColStd_ListOfInteger::Iterator anIt (aSelector.Indices()); anIt.More(); anIt.Next())
+    {
+      const MeshTriangle& aTri = theMesh.Triangles (anIt.Value());
+      const Standard_Integer aSide1 = theMesh.Side (aTri, thePnt);
+      const Standard_Integer aSide2 = theMesh.Side (aTri, anEnd);
+      if (aSide1 * aSide2 > 0)
+      {
+        continue;
+      }
+      if (aSide1 == 0 && aSide2 == 0)
+      {
+        // The ray is in the plane of triangle
+        isAmbiguous = Standard_True;
+        continue;
+      }
+      const LineCrossing aCrossing = lineCrossing (thePnt, anEnd, theMesh, aTri);
+      if (aCrossing == LineCrossing_None)
+      {
+        continue;
+      }
+      if (aCrossing == LineCrossing_Boundary || aSide1 == 0)
+      {
+        // The ray hits the edge or vertex, or starts on the triangle
+        isAmbiguous = Standard_True;
+        continue;
+      }
+      ++theNbHits;
+    }
+    return !isAmbiguous;
+  }
+
+  //=======================================================================
+  //class    : MeshClassifier
+  //purpose  : Classifies the points relatively the other mesh
+  //=======================================================================
+  class MeshClassifier
+  {
+  public:
+    MeshClassifier (MeshData* theMeshes,
+                    NCollection_Vector<ClassifiedPoint>& thePoints)
+    : myMeshes (theMeshes), myPoints (thePoints) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      ClassifiedPoint& aCP = myPoints (theIndex);
+      const MeshData& aSource = myMeshes[aCP.Mesh];
+      MeshData& anOther = myMeshes[1 - aCP.Mesh];
+      if (anOther.Triangles.IsEmpty())
+      {
+        aCP.State = MeshState_Out;
+        return;
+      }
+      if (isOnMesh (anOther, aSource, aSource.Triangles (aCP.Triangle), aCP.Point, aCP.State))
+      {
+        return;
+      }
+
+      // Try the rays along the axes (cheap for selection by boxes) and then
+      // the rays in perturbed directions until the ray misses edges and vertices
+      math_BullardGenerator aRandom (static_cast<unsigned int> (theIndex) + 1);
+      Standard_Integer aNbHits = 0;
+      for (Standard_Integer i = 0; i < THE_MAX_NB_RAYS; ++i)
+      {
+        gp_XYZ aDir;
+        if (i >= 6)
+        {
+          aDir.SetCoord (aRandom.NextReal() - 0.5, aRandom.NextReal() - 0.5, aRandom.NextReal() - 0.5);
+        }
+        else
+        {
+          aDir.SetCoord (i / 2 + 1, (i % 2) ? -1. : 1.);
+        }
+        if (rayParity (anOther, aCP.Point, aDir, aNbHits))
+        {
+          break;
+        }
+      }
+      aCP.State = (aNbHits % 2) ? MeshState_In : MeshState_Out;
+    }
+
+  private:
+    MeshData* myMeshes; //!< Meshes with built BVH trees, used for reading only
+    NCollection_Vector<ClassifiedPoint>& myPoints;
+  };
+
+  //=======================================================================
+  //function : findRoot
+  //purpose  : Finds the root of the group in the union-find structure
+  //=======================================================================
+  static Standard_Integer findRoot (NCollection_Array1<Standard_Integer>& theParents,
+                                    Standard_Integer theIndex)
+  {
+    while (theParents (theIndex) != theIndex)
+    {
+      theParents (theIndex) = theParents (theParents (theIndex));
+      theIndex = theParents (theIndex);
+    }
+    return theIndex;
+  }
+
+  //=======================================================================
+  //function : toKeep
+  //purpose  : Checks if the triangle with given state has to be kept in the
+  //           result of the operation and if it has to be reversed
+  //=======================================================================
+  static Standard_Boolean toKeep (const BOPAlgo_Operation theOperation,
+                                  const Standard_Integer theMesh,
+                                  const MeshState theState,
+                                  Standard_Boolean& theToReverse)
+  {
+    theToReverse = Standard_False;
+    switch (theOperation)
+    {
+      case BOPAlgo_FUSE:
+        return theState == MeshState_Out
+           || (theMesh == 0 && theState == MeshState_OnSame);
+      case BOPAlgo_COMMON:
+        return theState == MeshState_In
+           || (theMesh == 0 && theState == MeshState_OnSame);
+      case BOPAlgo_CUT:
+      case BOPAlgo_CUT21:
+      {
+        const Standard_Boolean isObject = (theMesh == 0) == (theOperation == BOPAlgo_CUT);
+        if (isObject)
+        {
+          return theState == MeshState_Out || theState == MeshState_OnOpposite;
+        }
+        theToReverse = Standard_True;
+        return theState == MeshState_In;
+      }
+      default:
+        break;
+    }
+    return Standard_False;
+  }
+
+  //! Tool for gathering the triangles of the result with merging of the coinciding nodes
+  class ResultBuilder
+  {
+  public:
+    void Add (const gp_XYZ& theP1, const gp_XYZ& theP2, const gp_XYZ& theP3,
+              const Standard_Boolean theToReverse)
+    {
+      const Standard_Integer aN1 = addNode (theP1);
+      const Standard_Integer aN2 = addNode (theP2);
+      const Standard_Integer aN3 = addNode (theP3);
+      if (theToReverse)
+      {
+        myTriangles.Append (Poly_Triangle (aN1, aN3, aN2));
+      }
+      else
+      {
+        myTriangles.Append (Poly_Triangle (aN1, aN2, aN3));
+      }
+    }
+
+    Handle(Poly_Triangulation) Result() const
+    {
+      if (myTriangles.IsEmpty())
+      {
+        return new Poly_Triangulation();
+      }
+      Handle(Poly_Triangulation) aResult =
+        new Poly_Triangulation (myNodes.Length(), myTriangles.Length(), Standard_False);
+      for (Standard_Integer i = 0; i < myNodes.Length(); ++i)
+      {
+        aResult->SetNode (i + 1, myNodes (i));
+      }
+      for (Standard_Integer i = 0; i < myTriangles.Length(); ++i)
+      {
+        aResult->SetTriangle (i + 1, myTriangles (i));
+      }
+      return aResult;
+    }
+
+  private:
+    Standard_Integer addNode (const gp_XYZ& thePnt)
+    {
+      const gp_Pnt aP (thePnt);
+      if (const Standard_Integer* anIndex = myNodesMap.Seek (aP))
+      {
+        return *anIndex;
+      }
+      myNodes.Append (aP);
+      myNodesMap.Bind (aP, myNodes.Length());
+      return myNodes.Length();
+    }
+
+  private:
+    NCollection_DataMap<gp_Pnt, Standard_Integer> myNodesMap;
+    NCollection_Vector<gp_Pnt>                    myNodes;
+    NCollection_Vector<Poly_Triangle>             myTriangles;
+  };
+}
+
+//=======================================================================
+//function : BOPAlgo_MeshBoolean
+//purpose  :
+//=======================================================================
+BOPAlgo_MeshBoolean::BOPAlgo_MeshBoolean()
+: BOPAlgo_Algo(),
+  myOperation (BOPAlgo_UNKNOWN),
+  myNbSplit (0)
+{
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BOPAlgo_MeshBoolean::Clear()
+{
+  BOPAlgo_Algo::Clear();
+  myResult.Nullify();
+  myNbSplit = 0;
+}
+
+//=======================================================================
+//function : CheckData
+//purpose  :
+//=======================================================================
+void BOPAlgo_MeshBoolean::CheckData()
+{
+  if (myObject.IsNull() || myTool.IsNull()
+   || myObject->NbTriangles() == 0 || myTool->NbTriangles() == 0)
+  {
+    AddError (new BOPAlgo_AlertTooFewArguments);
+    return;
+  }
+
+  if (myOperation != BOPAlgo_FUSE && myOperation != BOPAlgo_COMMON
+   && myOperation != BOPAlgo_CUT  && myOperation != BOPAlgo_CUT21)
+  {
+    AddError (new BOPAlgo_AlertBOPNotSet);
+  }
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BOPAlgo_MeshBoolean::Perform (const Message_ProgressRange& theRange)
+{
+  Clear();
+  CheckData();
+  if (HasErrors())
+  {
+    return;
+  }
+
+  Message_ProgressScope aPS (theRange, "Performing Boolean operation on meshes", 4);
+
+  // Prepare the meshes
+  MeshData aMeshes[2];
+  prepareMesh (myObject, aMeshes[0]);
+  prepareMesh (myTool,   aMeshes[1]);
+  aPS.Next();
+  if (UserBreak (aPS))
+  {
+    return;
+  }
+
+  // Find the pairs of interfering triangles
+  BOPTools_BoxPairSelector aPairSelector;
+  aPairSelector.SetBVHSets (&aMeshes[0].Tree, &aMeshes[1].Tree);
+  aPairSelector.SetSame (Standard_False);
+  aPairSelector.Select();
+  const std::vector<BOPTools_BoxPairSelector::PairIDs>& aPairs = aPairSelector.Pairs();
+  const Standard_Integer aNbPairs = static_cast<Standard_Integer>(aPairs.size());
+
+  NCollection_Array1<Standard_Integer> aFlags (0, Max (aNbPairs, 1) - 1);
+  aFlags.Init (0);
+  OSD_Parallel::For (0, aNbPairs, MeshIntersector (aMeshes, aPairs, aFlags), !myRunParallel);
+
+  // Collect the cutting triangles and mark the triangles
+  // located close to the other mesh
+  NCollection_Array1<TColStd_ListOfInteger> aCutters[2];
+  NCollection_Array1<Standard_Boolean> aNear[2];
+  for (Standard_Integer k = 0; k < 2; ++k)
+  {
+    const Standard_Integer aNbT = Max (aMeshes[k].Triangles.Length(), 1);
+    aCutters[k].Resize (0, aNbT - 1, Standard_False);
+    aNear[k].Resize (0, aNbT - 1, Standard_False);
+    aNear[k].Init (Standard_False);
+  }
+  for (Standard_Integer i = 0; i < aNbPairs; ++i)
+  {
+    const Standard_Integer anID[2] = { aPairs[i].ID1, aPairs[i].ID2 };
+    aNear[0] (anID[0]) = Standard_True;
+    aNear[1] (anID[1]) = Standard_True;
+    for (Standard_Integer k = 0; k < 2; ++k)
+    {
+      if (aFlags (i) & (1 << k))
+      {
+        aCutters[k] (anID[k]).Append (anID[1 - k]);
+      }
+    }
+  }
+  aPS.Next();
+  if (UserBreak (aPS))
+  {
+    return;
+  }
+
+  // Split the crossed triangles
+  NCollection_Vector<Standard_Integer> aSplitTris[2];
+  NCollection_Array1<NCollection_Vector<MeshPart> > aParts[2];
+  for (Standard_Integer k = 0; k < 2; ++k)
+  {
+    for (Standard_Integer i = 0; i < aMeshes[k].Triangles.Length(); ++i)
+    {
+      if (!aCutters[k] (i).IsEmpty())
+      {
+        aSplitTris[k].Append (i);
+      }
+    }
+    myNbSplit += aSplitTris[k].Length();
+    aParts[k].Resize (0, Max (aSplitTris[k].Length(), 1) - 1, Standard_False);
+    OSD_Parallel::For (0, aSplitTris[k].Length(),
+                       MeshSplitter (aMeshes[k], aMeshes[1 - k], aSplitTris[k], aCutters[k], aParts[k]),
+                       !myRunParallel);
+  }
+  aPS.Next();
+  if (UserBreak (aPS))
+  {
+    return;
+  }
+
+  // Collect the points to classify:
+  // - one point for each connected group of triangles far from the other mesh;
+  // - centers of the other not split triangles;
+  // - centers of the parts of split triangles.
+  NCollection_Vector<ClassifiedPoint> aPoints;
+  NCollection_Array1<Standard_Integer> aTriPoint[2];
+  NCollection_Array1<Standard_Integer> aPartPoint[2];
+  for (Standard_Integer k = 0; k < 2; ++k)
+  {
+    const MeshData& aMesh = aMeshes[k];
+    const Standard_Integer aNbT = aMesh.Triangles.Length();
+    aTriPoint[k].Resize (0, Max (aNbT, 1) - 1, Standard_False);
+    aTriPoint[k].Init (-1);
+
+    // Group the far triangles by the shared nodes
+    NCollection_Array1<Standard_Integer> aParents (0, Max (aNbT, 1) - 1);
+    NCollection_Array1<Standard_Integer> aNodeTri (0, Max (aMesh.Nodes.Length(), 1) - 1);
+    aNodeTri.Init (-1);
+    for (Standard_Integer i = 0; i < aNbT; ++i)
+    {
+      aParents (i) = i;
+      if (aNear[k] (i))
+      {
+        continue;
+      }
+      for (Standard_Integer j = 0; j < 3; ++j)
+      {
+        const Standard_Integer aNode = aMesh.Triangles (i).Nodes[j];
+        if (aNodeTri (aNode) < 0)
+        {
+          aNodeTri (aNode) = i;
+          continue;
+        }
+        const Standard_Integer aR1 = findRoot (aParents, aNodeTri (aNode));
+        const Standard_Integer aR2 = findRoot (aParents, i);
+        if (aR1 != aR2)
+        {
+          aParents (Max (aR1, aR2)) = Min (aR1, aR2);
+        }
+      }
+    }
+
+    for (Standard_Integer i = 0; i < aNbT; ++i)
+    {
+      if (!aCutters[k] (i).IsEmpty())
+      {
+        continue;
+      }
+      const Standard_Integer aRoot = aNear[k] (i) ? i : findRoot (aParents, i);
+      if (aRoot != i)
+      {
+        aTriPoint[k] (i) = aTriPoint[k] (aRoot);
+        continue;
+      }
+      const MeshTriangle& aTri = aMesh.Triangles (i);
+      ClassifiedPoint& aCP = aPoints.Appended();
+      aCP.Mesh = k;
+      aCP.Triangle = i;
+      aCP.Point = (aMesh.Nodes (aTri.Nodes[0]) + aMesh.Nodes (aTri.Nodes[1]) + aMesh.Nodes (aTri.Nodes[2])) / 3.;
+      aCP.State = MeshState_Out;
+      aTriPoint[k] (i) = aPoints.Length() - 1;
+    }
+
+    aPartPoint[k].Resize (0, Max (aSplitTris[k].Length(), 1) - 1, Standard_False);
+    for (Standard_Integer i = 0; i < aSplitTris[k].Length(); ++i)
+    {
+      aPartPoint[k] (i) = aPoints.Length();
+      for (NCollection_Vector<MeshPart>::Iterator anIt (aParts[k] (i)); anIt.More(); anIt.Next())
+      {
+        const MeshPart& aPart = anIt.Value();
+        ClassifiedPoint& aCP = aPoints.Appended();
+        aCP.Mesh = k;
+        aCP.Triangle = aSplitTris[k] (i);
+        aCP.Point = (aPart.Nodes[0] + aPart.Nodes[1] + aPart.Nodes[2]) / 3.;
+        aCP.State = MeshState_Out;
+      }
+    }
+  }
+
+  OSD_Parallel::For (0, aPoints.Length(), MeshClassifier (aMeshes, aPoints), !myRunParallel);
+  aPS.Next();
+  if (UserBreak (aPS))
+  {
+    return;
+  }
+
+  // Gather the result
+  ResultBuilder aBuilder;
+  for (Standard_Integer k = 0; k < 2; ++k)
+  {
+    const MeshData& aMesh = aMeshes[k];
+    Standard_Boolean toReverse = Standard_False;
+    for (Standard_Integer i = 0; i < aMesh.Triangles.Length(); ++i)
+    {
+      if (aTriPoint[k] (i) < 0
+      || !toKeep (myOperation, k, aPoints (aTriPoint[k] (i)).State, toReverse))
+      {
+        continue;
+      }
+      const MeshTriangle& aTri = aMesh.Triangles (i);
+      aBuilder.Add (aMesh.Nodes (aTri.Nodes[0]), aMesh.Nodes (aTri.Nodes[1]), aMesh.Nodes (aTri.Nodes[2]), toReverse);
+    }
+
+    for (Standard_Integer i = 0; i < aSplitTris[k].Length(); ++i)
+    {
+      Standard_Integer aPointIndex = aPartPoint[k] (i);
+      for (NCollection_Vector<MeshPart>::Iterator anIt (aParts[k] (i)); anIt.More(); anIt.Next(), ++aPointIndex)
+      {
+        if (!toKeep (myOperation, k, aPoints (aPointIndex).State, toReverse))
+        {
+          continue;
+        }
+        const MeshPart& aPart = anIt.Value();
+        aBuilder.Add (aPart.Nodes[0], aPart.Nodes[1], aPart.Nodes[2], toReverse);
+      }
+    }
+  }
+  myResult = aBuilder.Result();
+}
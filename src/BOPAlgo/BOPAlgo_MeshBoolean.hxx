@@ -0,0 +1,142 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_MeshBoolean_HeaderFile
+#define _BOPAlgo_MeshBoolean_HeaderFile
+
+#include <BOPAlgo_Algo.hxx>
+#include <BOPAlgo_Operation.hxx>
+#include <Poly_Triangulation.hxx>
+
+//! The BOPAlgo_MeshBoolean is the algorithm for fast approximate Boolean
+//! operations on triangulations, intended for interactive previews of the
+//! Boolean operations (e.g. of CSG trees) while the exact Boolean operation
+//! on B-Rep shapes is being computed.
+//!
+//! The arguments of the operation (Object and Tool) are the triangulations
+//! bounding closed volumes, with consistently oriented triangles
+//! (normals pointing outside of the volume), such as the meshes of the solids
+//! built by BRepMesh. The nodes of the triangles sharing the edge are expected
+//! to be shared as well (see BRepAlgoAPI_MeshBoolean for preparation of such
+//! triangulation from the meshed shape).
+//!
+//! The algorithm performs the following steps:
+//! - Finds the pairs of intersecting triangles of the arguments using BVH trees
+//!   of the triangles boxes;
+//! - Splits the triangles crossing the triangles of the other argument by the
+//!   planes of the crossing triangles;
+//! - Classifies the triangles and the split parts relatively the other argument
+//!   (by parity of ray intersections), classifying the connected groups of triangles
+//!   located far from the other argument only once;
+//! - Gathers the triangles according to the type of the operation,
+//!   reversing the triangles of the Tool for CUT operation.
+//!
+//! All steps are performed in parallel when parallel mode is switched on.
+//! The geometric predicates (orientation of the point relatively the plane
+//! of triangle and of the projected points) use adaptive precision arithmetic
+//! giving the exact signs, so that the touching and coincident triangles are
+//! treated consistently without tolerance; the fuzzy value is not used.
+//! The rays classifying the points are re-cast in perturbed directions
+//! when they hit the edges or vertices of the other argument.
+//!
+//! The result is the triangulation suitable for visualization: it may contain
+//! the T-junctions on the intersection lines of the arguments, and it has no
+//! connection to the B-Rep of the arguments.
+//! Section operation is not supported.
+//!
+//! The algorithm returns the following errors:
+//! - *BOPAlgo_AlertTooFewArguments* - in case some of the arguments is not set or empty;
+//! - *BOPAlgo_AlertBOPNotSet* - in case the type of the operation is not supported.
+class BOPAlgo_MeshBoolean : public BOPAlgo_Algo
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Empty constructor
+  Standard_EXPORT BOPAlgo_MeshBoolean();
+
+public: //! @name Setting the arguments
+
+  //! Sets the Object triangulation
+  void SetObject (const Handle(Poly_Triangulation)& theObject)
+  {
+    myObject = theObject;
+  }
+
+  //! Returns the Object triangulation
+  const Handle(Poly_Triangulation)& Object() const
+  {
+    return myObject;
+  }
+
+  //! Sets the Tool triangulation
+  void SetTool (const Handle(Poly_Triangulation)& theTool)
+  {
+    myTool = theTool;
+  }
+
+  //! Returns the Tool triangulation
+  const Handle(Poly_Triangulation)& Tool() const
+  {
+    return myTool;
+  }
+
+  //! Sets the type of Boolean operation
+  void SetOperation (const BOPAlgo_Operation theOperation)
+  {
+    myOperation = theOperation;
+  }
+
+  //! Returns the type of Boolean operation
+  BOPAlgo_Operation Operation() const
+  {
+    return myOperation;
+  }
+
+public: //! @name Performing the operation
+
+  //! Performs the operation
+  Standard_EXPORT virtual void Perform (const Message_ProgressRange& theRange = Message_ProgressRange()) Standard_OVERRIDE;
+
+  //! Returns the resulting triangulation
+  const Handle(Poly_Triangulation)& Triangulation() const
+  {
+    return myResult;
+  }
+
+  //! Returns the number of triangles of the arguments split during the operation
+  Standard_Integer NbSplitTriangles() const
+  {
+    return myNbSplit;
+  }
+
+  //! Clears the contents of the algorithm
+  Standard_EXPORT virtual void Clear() Standard_OVERRIDE;
+
+protected:
+
+  //! Checks the input data
+  Standard_EXPORT virtual void CheckData() Standard_OVERRIDE;
+
+protected:
+
+  Handle(Poly_Triangulation) myObject;    //!< Object of the operation
+  Handle(Poly_Triangulation) myTool;      //!< Tool of the operation
+  BOPAlgo_Operation          myOperation; //!< Type of the operation
+  Handle(Poly_Triangulation) myResult;    //!< Resulting triangulation
+  Standard_Integer           myNbSplit;   //!< Number of split triangles
+
+};
+
+#endif // _BOPAlgo_MeshBoolean_HeaderFile
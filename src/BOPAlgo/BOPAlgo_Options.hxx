@@ -165,6 +165,25 @@ public:
     return myUseOBB;
   }
 
+public:
+  //!@name Usage of triangulations of the faces
+
+  //! Enables/Disables the additional filtering of the pairs of faces for intersection
+  //! using the triangulations of the faces. The pairs of faces with interfering bounding
+  //! boxes, the triangulations of which are far from each other, are not intersected.
+  //! Only the faces having the triangulations are checked, thus the arguments should
+  //! be meshed beforehand (e.g. by BRepMesh_IncrementalMesh) to benefit from the filter.
+  void SetUseTriangulationFilter(const Standard_Boolean theUseFilter)
+  {
+    myUseTriangulationFilter = theUseFilter;
+  }
+
+  //! Returns the flag defining usage of the triangulations of the faces
+  Standard_Boolean UseTriangulationFilter() const
+  {
+    return myUseTriangulationFilter;
+  }
+
 protected:
 
   //! Adds error to the report if the break signal was caught. Returns true in this case, false otherwise.
@@ -177,6 +196,7 @@ protected:
   Standard_Boolean myRunParallel;
   Standard_Real myFuzzyValue;
   Standard_Boolean myUseOBB;
+  Standard_Boolean myUseTriangulationFilter;
 
 };
 
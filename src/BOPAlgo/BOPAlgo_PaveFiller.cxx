@@ -25,6 +25,7 @@
 #include <NCollection_BaseAllocator.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
+#include <TopoDS.hxx>
 
 namespace
 {
@@ -223,12 +224,26 @@ void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
   //
   // 2 myContext
   myContext = new IntTools_Context;
+  if (myRunParallel)
+  {
+    // share the classifiers of the faces between the contexts of the threads
+    Handle(IntTools_SharedCache) aSharedCache = new IntTools_SharedCache;
+    const Standard_Integer aNbS = myDS->NbSourceShapes();
+    for (Standard_Integer i = 0; i < aNbS; ++i)
+    {
+      if (myDS->ShapeInfo (i).ShapeType() == TopAbs_FACE)
+      {
+        aSharedCache->AddFace (TopoDS::Face (myDS->Shape (i)));
+      }
+    }
+    myContext->SetSharedCache (aSharedCache);
+  }
   //
   // 3.myIterator 
   myIterator = new BOPDS_Iterator (myAllocator);
   myIterator->SetRunParallel (myRunParallel);
   myIterator->SetDS (myDS);
-  myIterator->Prepare (myContext, myUseOBB, myFuzzyValue);
+  myIterator->Prepare (myContext, myUseOBB, myFuzzyValue, myUseTriangulationFilter);
   //
   // 4 NonDestructive flag
   SetNonDestructive();
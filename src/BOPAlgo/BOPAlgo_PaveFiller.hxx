@@ -23,6 +23,7 @@
 #include <Standard_Handle.hxx>
 
 #include <BOPAlgo_Algo.hxx>
+#include <BOPAlgo_FaceFaceCache.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
 #include <BOPAlgo_SectionAttribute.hxx>
 #include <BOPDS_DataMapOfPaveBlockListOfPaveBlock.hxx>
@@ -176,6 +177,20 @@ public:
     return myAvoidBuildPCurve;
   }
 
+  //! Sets the cache of Face/Face intersection results to be reused by the consequent
+  //! runs of the algorithm on the modified arguments (see BOPAlgo_FaceFaceCache).
+  //! Cache is not used by default.
+  void SetFaceFaceCache(const Handle(BOPAlgo_FaceFaceCache)& theCache)
+  {
+    myFaceFaceCache = theCache;
+  }
+
+  //! Returns the cache of Face/Face intersection results
+  const Handle(BOPAlgo_FaceFaceCache)& FaceFaceCache() const
+  {
+    return myFaceFaceCache;
+  }
+
 protected:
 
   typedef NCollection_DataMap
@@ -647,6 +662,7 @@ protected: //! Fields
   Standard_Boolean myIsPrimary;
   Standard_Boolean myAvoidBuildPCurve;
   BOPAlgo_GlueEnum myGlue;
+  Handle(BOPAlgo_FaceFaceCache) myFaceFaceCache; //!< Optional cache of Face/Face intersection results
 
   BOPAlgo_DataMapOfIntegerMapOfPaveBlock myFPBDone; //!< Fence map of intersected faces and pave blocks
   TColStd_MapOfInteger myIncreasedSS; //!< Sub-shapes with increased tolerance during the operation
@@ -25,12 +25,14 @@
 #include <BOPDS_ShapeInfo.hxx>
 #include <BOPDS_VectorOfInterfVV.hxx>
 #include <BOPTools_AlgoTools.hxx>
+#include <BOPTools_Parallel.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_TVertex.hxx>
 #include <BRep_Tool.hxx>
 #include <gp_Pnt.hxx>
 #include <IntTools_Context.hxx>
 #include <NCollection_BaseAllocator.hxx>
+#include <NCollection_Vector.hxx>
 #include <Precision.hxx>
 #include <TColStd_DataMapOfIntegerInteger.hxx>
 #include <TopoDS.hxx>
@@ -38,6 +40,71 @@
 #include <TopoDS_Compound.hxx>
 #include <TopTools_ListOfShape.hxx>
 
+//=======================================================================
+//class    : BOPAlgo_VertexVertex
+//purpose  : Checks the pair of vertices for interference
+//=======================================================================
+class BOPAlgo_VertexVertex : public BOPAlgo_ParallelAlgo {
+
+ public:
+  DEFINE_STANDARD_ALLOC
+
+  BOPAlgo_VertexVertex() :
+    BOPAlgo_ParallelAlgo(),
+    myIV1(-1), myIV2(-1), myToCheck(Standard_True), myFlag(-1) {
+  };
+  //
+  virtual ~BOPAlgo_VertexVertex(){
+  };
+  //
+  void SetIndices(const Standard_Integer nV1,
+                  const Standard_Integer nV2) {
+    myIV1=nV1;
+    myIV2=nV2;
+  }
+  //
+  void Indices(Standard_Integer& nV1,
+               Standard_Integer& nV2) const {
+    nV1=myIV1;
+    nV2=myIV2;
+  }
+  //
+  void SetVertices(const TopoDS_Vertex& aV1,
+                   const TopoDS_Vertex& aV2) {
+    myV1=aV1;
+    myV2=aV2;
+  }
+  //
+  //! Marks the pair as already interfering, so that no check is needed
+  void SetInterfering() {
+    myToCheck=Standard_False;
+    myFlag=0;
+  }
+  //
+  Standard_Integer Flag()const {
+    return myFlag;
+  }
+  //
+  virtual void Perform() {
+    Message_ProgressScope aPS(myProgressRange, NULL, 1);
+    if (!myToCheck || UserBreak(aPS))
+    {
+      return;
+    }
+    myFlag=BOPTools_AlgoTools::ComputeVV(myV1, myV2, myFuzzyValue);
+  };
+  //
+ protected:
+  Standard_Integer myIV1;
+  Standard_Integer myIV2;
+  Standard_Boolean myToCheck;
+  Standard_Integer myFlag;
+  TopoDS_Vertex myV1;
+  TopoDS_Vertex myV2;
+};
+//=======================================================================
+typedef NCollection_Vector<BOPAlgo_VertexVertex> BOPAlgo_VectorOfVertexVertex;
+
 //=======================================================================
 // function: PerformVV
 // purpose: 
@@ -65,17 +132,21 @@ void BOPAlgo_PaveFiller::PerformVV(const Message_ProgressRange& theRange)
   //
   // 1. Map V/LV
   // Split progress range on intersection stage and making blocks. Display only intersection stage.
-  Message_ProgressScope aPSLoop(aPS.Next(1.), "Performing Vertex-Vertex intersection", aSize);
-  for (; myIterator->More(); myIterator->Next(), aPSLoop.Next()) {
+  // The pairs are checked in parallel, but the map is filled in the order
+  // of the iterator to keep the order of the vertices in the blocks.
+  BOPAlgo_VectorOfVertexVertex aVVV;
+  for (; myIterator->More(); myIterator->Next()) {
     if (UserBreak(aPS))
     {
       return;
     }
     myIterator->Value(n1, n2);
     //
+    BOPAlgo_VertexVertex& aVVSolver = aVVV.Appended();
+    aVVSolver.SetIndices(n1, n2);
     if (myDS->HasInterf(n1, n2))
     {
-      BOPAlgo_Tools::FillMap(n1, n2, aMILI, aAllocator);
+      aVVSolver.SetInterfering();
       continue;
     }
 
@@ -89,8 +160,28 @@ void BOPAlgo_PaveFiller::PerformVV(const Message_ProgressRange& theRange)
     const TopoDS_Vertex& aV1=(*(TopoDS_Vertex *)(&myDS->Shape(n1SD)));
     const TopoDS_Vertex& aV2=(*(TopoDS_Vertex *)(&myDS->Shape(n2SD)));
 
-    iFlag = BOPTools_AlgoTools::ComputeVV(aV1, aV2, myFuzzyValue);
+    aVVSolver.SetVertices(aV1, aV2);
+    aVVSolver.SetFuzzyValue(myFuzzyValue);
+  }
+  //
+  Standard_Integer i, aNbVV = aVVV.Length();
+  Message_ProgressScope aPSLoop(aPS.Next(1.), "Performing Vertex-Vertex intersection", aNbVV);
+  for (i = 0; i < aNbVV; ++i) {
+    aVVV.ChangeValue(i).SetProgressRange(aPSLoop.Next());
+  }
+  //=============================================================
+  BOPTools_Parallel::Perform (myRunParallel, aVVV);
+  //=============================================================
+  if (UserBreak(aPS))
+  {
+    return;
+  }
+  //
+  for (i = 0; i < aNbVV; ++i) {
+    const BOPAlgo_VertexVertex& aVVSolver = aVVV(i);
+    iFlag = aVVSolver.Flag();
     if (!iFlag) {
+      aVVSolver.Indices(n1, n2);
       BOPAlgo_Tools::FillMap(n1, n2, aMILI, aAllocator);
     }
   }
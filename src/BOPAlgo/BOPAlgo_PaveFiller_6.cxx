@@ -16,6 +16,7 @@
 // commercial license or contractual agreement.
 
 #include <BOPAlgo_PaveFiller.hxx>
+#include <BOPAlgo_FaceFaceCache.hxx>
 #include <Bnd_Box.hxx>
 #include <BOPAlgo_Alerts.hxx>
 #include <BOPAlgo_SectionAttribute.hxx>
@@ -80,6 +81,35 @@
 static Standard_Real ToleranceFF(const BRepAdaptor_Surface& aBAS1,
                                  const BRepAdaptor_Surface& aBAS2);
 
+//=======================================================================
+//function : CopyCurves
+//purpose  : Copies the intersection curves with their geometry, so that
+//           the results of different operations do not share the curves
+//           stored in the Face/Face cache
+//=======================================================================
+static void CopyCurves(const IntTools_SequenceOfCurves& theCurves,
+                       IntTools_SequenceOfCurves& theCopies)
+{
+  theCopies.Clear();
+  for (IntTools_SequenceOfCurves::Iterator aIt(theCurves); aIt.More(); aIt.Next())
+  {
+    IntTools_Curve aCopy = aIt.Value();
+    if (!aCopy.Curve().IsNull())
+    {
+      aCopy.SetCurve(Handle(Geom_Curve)::DownCast(aCopy.Curve()->Copy()));
+    }
+    if (!aCopy.FirstCurve2d().IsNull())
+    {
+      aCopy.SetFirstCurve2d(Handle(Geom2d_Curve)::DownCast(aCopy.FirstCurve2d()->Copy()));
+    }
+    if (!aCopy.SecondCurve2d().IsNull())
+    {
+      aCopy.SetSecondCurve2d(Handle(Geom2d_Curve)::DownCast(aCopy.SecondCurve2d()->Copy()));
+    }
+    theCopies.Append(aCopy);
+  }
+}
+
 /////////////////////////////////////////////////////////////////////////
 //=======================================================================
 //class    : BOPAlgo_FaceFace
@@ -95,7 +125,7 @@ class BOPAlgo_FaceFace :
   BOPAlgo_FaceFace() : 
     IntTools_FaceFace(),  
     BOPAlgo_ParallelAlgo(),
-    myIF1(-1), myIF2(-1), myTolFF(1.e-7) {
+    myIF1(-1), myIF2(-1), myTolFF(1.e-7), myCachedEntry(NULL) {
   }
   //
   virtual ~BOPAlgo_FaceFace() {
@@ -147,12 +177,31 @@ class BOPAlgo_FaceFace :
   //
   const gp_Trsf& Trsf() const { return myTrsf; }
   //
+  //! Sets the cached results of intersection to be used instead of computation
+  void SetCachedEntry(const BOPAlgo_FaceFaceCache::Entry* theEntry) {
+    myCachedEntry = theEntry;
+  }
+  //
+  //! Returns true if the results have been taken from cache
+  Standard_Boolean IsCached() const {
+    return myCachedEntry != NULL;
+  }
+  //
   virtual void Perform() {
     Message_ProgressScope aPS(myProgressRange, NULL, 1);
     if (UserBreak(aPS))
     {
       return;
     }
+    if (myCachedEntry)
+    {
+      // Take the already post-treated results from cache
+      CopyCurves (myCachedEntry->Curves, mySeqOfCurve);
+      myPnts = myCachedEntry->Points;
+      myTangentFaces = myCachedEntry->TangentFaces;
+      myIsDone = Standard_True;
+      return;
+    }
     try
     {
       OCC_CATCH_SIGNALS
@@ -220,11 +269,269 @@ class BOPAlgo_FaceFace :
   Bnd_Box myBox1;
   Bnd_Box myBox2;
   gp_Trsf myTrsf;
+  const BOPAlgo_FaceFaceCache::Entry* myCachedEntry;
 };
 //
 //=======================================================================
 typedef NCollection_Vector<BOPAlgo_FaceFace> BOPAlgo_VectorOfFaceFace;
 
+/////////////////////////////////////////////////////////////////////////
+//=======================================================================
+//class    : BOPAlgo_StickVertices
+//purpose  : Collects the new vertices created by the interferences
+//           of the sub-shapes of two faces (see GetStickVertices).
+//           The vertices are kept in the order of their collection,
+//           so that the maps filled from these lists are the same
+//           as if filled directly.
+//=======================================================================
+class BOPAlgo_StickVertices {
+
+ public:
+  DEFINE_STANDARD_ALLOC
+
+  BOPAlgo_StickVertices() :
+    myDS(NULL), myIF1(-1), myIF2(-1) {
+  }
+  //
+  void SetDS(const BOPDS_PDS& theDS) {
+    myDS = theDS;
+  }
+  //
+  void SetIndices(const Standard_Integer nF1,
+                  const Standard_Integer nF2) {
+    myIF1 = nF1;
+    myIF2 = nF2;
+  }
+  //
+  //! Returns all collected vertices
+  const TColStd_ListOfInteger& StickVertices() const {
+    return myLVStick;
+  }
+  //
+  //! Returns the vertices created by Edge/Face interferences
+  const TColStd_ListOfInteger& EFVertices() const {
+    return myLVEF;
+  }
+  //
+  void Perform() {
+    myLVStick.Clear();
+    myLVEF.Clear();
+    if (myIF1 < 0 || myIF2 < 0) {
+      return;
+    }
+    //
+    // collect indices of all shapes from nF1 and nF2
+    TColStd_MapOfInteger aMI;
+    for (Standard_Integer iF = 0; iF < 2; ++iF) {
+      const Standard_Integer nF = !iF ? myIF1 : myIF2;
+      aMI.Add(nF);
+      TColStd_ListIteratorOfListOfInteger aIt(myDS->ShapeInfo(nF).SubShapes());
+      for (; aIt.More(); aIt.Next()) {
+        aMI.Add(aIt.Value());
+      }
+    }
+    //
+    // collect VV, VE, EE, VF and EF interferences
+    TColStd_MapOfInteger aMVStick, aMVEF;
+    collect(myDS->InterfVV(), aMI, aMVStick, NULL);
+    collect(myDS->InterfVE(), aMI, aMVStick, NULL);
+    collect(myDS->InterfEE(), aMI, aMVStick, NULL);
+    collect(myDS->InterfVF(), aMI, aMVStick, NULL);
+    collect(myDS->InterfEF(), aMI, aMVStick, &aMVEF);
+  }
+  //
+ protected:
+  template <class TypeVectorOfInterf>
+  void collect(const TypeVectorOfInterf& theInterfs,
+               const TColStd_MapOfInteger& theMI,
+               TColStd_MapOfInteger& theMVStick,
+               TColStd_MapOfInteger* theMVEF) {
+    Standard_Integer nS1, nS2, nVNew;
+    const Standard_Integer aNb = theInterfs.Length();
+    for (Standard_Integer i = 0; i < aNb; ++i) {
+      const BOPDS_Interf& aInt = theInterfs(i);
+      if (aInt.HasIndexNew()) {
+        aInt.Indices(nS1, nS2);
+        if (theMI.Contains(nS1) && theMI.Contains(nS2)) {
+          nVNew = aInt.IndexNew();
+          myDS->HasShapeSD(nVNew, nVNew);
+          if (theMVStick.Add(nVNew)) {
+            myLVStick.Append(nVNew);
+          }
+          if (theMVEF && theMVEF->Add(nVNew)) {
+            myLVEF.Append(nVNew);
+          }
+        }
+      }
+    }
+  }
+  //
+ protected:
+  BOPDS_PDS myDS;
+  Standard_Integer myIF1;
+  Standard_Integer myIF2;
+  TColStd_ListOfInteger myLVStick;
+  TColStd_ListOfInteger myLVEF;
+};
+//
+//=======================================================================
+typedef NCollection_Vector<BOPAlgo_StickVertices> BOPAlgo_VectorOfStickVertices;
+
+//=======================================================================
+//function : collectStickVertices
+//purpose  : Collects the stick vertices for all Face/Face interferences,
+//           optionally skipping the interferences without results
+//=======================================================================
+static void collectStickVertices(const BOPDS_PDS& theDS,
+                                 const Standard_Boolean theRunParallel,
+                                 const Standard_Boolean theToSkipEmpty,
+                                 BOPAlgo_VectorOfStickVertices& theVSV)
+{
+  const BOPDS_VectorOfInterfFF& aFFs = theDS->InterfFF();
+  const Standard_Integer aNbFF = aFFs.Length();
+  for (Standard_Integer i = 0; i < aNbFF; ++i) {
+    BOPAlgo_StickVertices& aSV = theVSV.Appended();
+    aSV.SetDS(theDS);
+    const BOPDS_InterfFF& aFF = aFFs(i);
+    if (theToSkipEmpty && aFF.Points().IsEmpty() && aFF.Curves().IsEmpty()) {
+      continue;
+    }
+    Standard_Integer nF1, nF2;
+    aFF.Indices(nF1, nF2);
+    aSV.SetIndices(nF1, nF2);
+  }
+  //======================================================
+  BOPTools_Parallel::Perform (theRunParallel, theVSV);
+  //======================================================
+}
+
+//=======================================================================
+//class    : BOPAlgo_SharedVerticesOnCurves
+//purpose  : Checks which of the given shared vertices of two faces
+//           are located on the section curves of these faces
+//           (see UpdateBlocksWithSharedVertices)
+//=======================================================================
+class BOPAlgo_SharedVerticesOnCurves {
+
+ public:
+  DEFINE_STANDARD_ALLOC
+
+  BOPAlgo_SharedVerticesOnCurves() :
+    myCurves(NULL) {
+  }
+  //
+  void SetCurves(const BOPDS_VectorOfCurve* theCurves) {
+    myCurves = theCurves;
+  }
+  //
+  //! Adds the vertex to check
+  void AddVertex(const Standard_Integer nV,
+                 const TopoDS_Vertex& aV) {
+    if (myMV.Add(nV)) {
+      myVertices.Append(std::make_pair(nV, aV));
+    }
+  }
+  //
+  //! Returns true if the vertex has been checked
+  Standard_Boolean IsChecked(const Standard_Integer nV) const {
+    return myMV.Contains(nV);
+  }
+  //
+  //! Returns true if the vertex has been found on the curve
+  Standard_Boolean IsOnCurve(const Standard_Integer theCurve,
+                             const Standard_Integer nV) const {
+    return myMVOnCurves(theCurve).Contains(nV);
+  }
+  //
+  void SetContext(const Handle(IntTools_Context)& aContext) {
+    myContext = aContext;
+  }
+  //
+  const Handle(IntTools_Context)& Context() const {
+    return myContext;
+  }
+  //
+  void Perform() {
+    if (!myCurves) {
+      return;
+    }
+    const Standard_Integer aNbC = myCurves->Length();
+    for (Standard_Integer j = 0; j < aNbC; ++j) {
+      const BOPDS_Curve& aNC = myCurves->Value(j);
+      Standard_Real aTolR3D = Max(aNC.Tolerance(), aNC.TangentialTolerance());
+      TColStd_MapOfInteger& aMVOn = myMVOnCurves.Appended();
+      //
+      const Standard_Integer aNbV = myVertices.Length();
+      for (Standard_Integer k = 0; k < aNbV; ++k) {
+        Standard_Real aT;
+        const std::pair<Standard_Integer, TopoDS_Vertex>& aPair = myVertices(k);
+        if (myContext->IsVertexOnLine(aPair.second, aNC.Curve(), aTolR3D, aT)) {
+          aMVOn.Add(aPair.first);
+        }
+      }
+    }
+  }
+  //
+ protected:
+  const BOPDS_VectorOfCurve* myCurves;
+  TColStd_MapOfInteger myMV;
+  NCollection_Vector<std::pair<Standard_Integer, TopoDS_Vertex> > myVertices;
+  NCollection_Vector<TColStd_MapOfInteger> myMVOnCurves;
+  Handle(IntTools_Context) myContext;
+};
+//
+//=======================================================================
+typedef NCollection_Vector<BOPAlgo_SharedVerticesOnCurves> BOPAlgo_VectorOfSharedVerticesOnCurves;
+
+//=======================================================================
+//function : sharedVerticesCandidates
+//purpose  : Returns the old vertices which are or may become the vertices
+//           "On" or "In" of the face (see UpdateBlocksWithSharedVertices)
+//=======================================================================
+static const TColStd_MapOfInteger& sharedVerticesCandidates
+  (const BOPDS_PDS& theDS,
+   const Standard_Integer theF,
+   NCollection_DataMap<Standard_Integer, TColStd_MapOfInteger>& theDMFV)
+{
+  const TColStd_MapOfInteger* pMV = theDMFV.Seek(theF);
+  if (pMV) {
+    return *pMV;
+  }
+  //
+  TColStd_MapOfInteger aMV;
+  Standard_Integer nV[2];
+  TColStd_ListIteratorOfListOfInteger aIt(theDS->ShapeInfo(theF).SubShapes());
+  for (; aIt.More(); aIt.Next()) {
+    const Standard_Integer nS = aIt.Value();
+    const BOPDS_ShapeInfo& aSI = theDS->ShapeInfo(nS);
+    if (aSI.ShapeType() == TopAbs_VERTEX) {
+      aMV.Add(nS);
+    }
+    else if (aSI.ShapeType() == TopAbs_EDGE) {
+      BOPDS_ListIteratorOfListOfPaveBlock aItPB(theDS->PaveBlocks(nS));
+      for (; aItPB.More(); aItPB.Next()) {
+        aItPB.Value()->Indices(nV[0], nV[1]);
+        for (Standard_Integer k = 0; k < 2; ++k) {
+          if (!theDS->IsNewShape(nV[k])) {
+            aMV.Add(nV[k]);
+          }
+        }
+      }
+    }
+  }
+  //
+  if (theDS->HasFaceInfo(theF)) {
+    TColStd_MapIteratorOfMapOfInteger aItMV(theDS->FaceInfo(theF).VerticesIn());
+    for (; aItMV.More(); aItMV.Next()) {
+      if (!theDS->IsNewShape(aItMV.Value())) {
+        aMV.Add(aItMV.Value());
+      }
+    }
+  }
+  theDMFV.Bind(theF, aMV);
+  return theDMFV.Find(theF);
+}
+
 /////////////////////////////////////////////////////////////////////////
 //=======================================================================
 //function : PerformFF
@@ -237,6 +544,7 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
   // i.e. anyhow touched faces.
   myIterator->Initialize(TopAbs_FACE, TopAbs_FACE);
   Standard_Integer iSize = myIterator->ExpectedLength();
+  BOPAlgo_FaceFaceCache::OperationSentry aCacheSentry(myFaceFaceCache);
 
   // Collect faces from intersection pairs
   TColStd_MapOfInteger aMIFence;
@@ -263,6 +571,7 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
   if (!iSize)
   {
     // no intersection pairs found
+    aCacheSentry.SetCompleted();
     return;
   }
 
@@ -310,6 +619,8 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
 
   // Prepare the pairs of faces for intersection
   BOPAlgo_VectorOfFaceFace aVFaceFace;
+  // Requests to the cache of intersection results for the pairs to be intersected
+  NCollection_DataMap<Standard_Integer, BOPAlgo_FaceFaceCache::Entry> aMCacheRequests;
   myIterator->Initialize(TopAbs_FACE, TopAbs_FACE);
   for (; myIterator->More(); myIterator->Next()) {
     if (UserBreak(aPSOuter))
@@ -428,6 +739,35 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
       //
       aFaceFace.SetParameters(bApprox, bCompC2D1, bCompC2D2, anApproxTol);
       aFaceFace.SetFuzzyValue(myFuzzyValue);
+      //
+      if (!myFaceFaceCache.IsNull())
+      {
+        // Look for the results of intersection of the same faces with the same options
+        BOPAlgo_FaceFaceCache::Entry aRequest;
+        aRequest.Face1 = aFShifted1;
+        aRequest.Face2 = aFShifted2;
+        aRequest.TolF1 = BRep_Tool::Tolerance(aF1);
+        aRequest.TolF2 = BRep_Tool::Tolerance(aF2);
+        aRequest.TolFF = aTolFF;
+        aRequest.FuzzyValue = myFuzzyValue;
+        aRequest.ApproxTol = anApproxTol;
+        aRequest.Approx = bApprox;
+        aRequest.PCurveOnS1 = bCompC2D1;
+        aRequest.PCurveOnS2 = bCompC2D2;
+        aRequest.Box1 = myDS->ShapeInfo(nF1).Box();
+        aRequest.Box2 = myDS->ShapeInfo(nF2).Box();
+        aRequest.StartPoints = aListOfPnts;
+        //
+        const BOPAlgo_FaceFaceCache::Entry* aCached = myFaceFaceCache->Find(aRequest);
+        if (aCached)
+        {
+          aFaceFace.SetCachedEntry(aCached);
+        }
+        else
+        {
+          aMCacheRequests.Bind(aVFaceFace.Length() - 1, aRequest);
+        }
+      }
     }
     else {
       // for the Glue mode just add all interferences of that type
@@ -474,9 +814,22 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     Standard_Boolean bTangentFaces = aFaceFace.TangentFaces();
     Standard_Real aTolFF = aFaceFace.TolFF();
     //
-    aFaceFace.PrepareLines3D(bSplitCurve);
-    //
-    aFaceFace.ApplyTrsf();
+    if (!aFaceFace.IsCached())
+    {
+      aFaceFace.PrepareLines3D(bSplitCurve);
+      //
+      aFaceFace.ApplyTrsf();
+      //
+      BOPAlgo_FaceFaceCache::Entry* aRequest = aMCacheRequests.ChangeSeek(k);
+      if (aRequest)
+      {
+        // Save the results for the consequent operations
+        aRequest->TangentFaces = bTangentFaces;
+        CopyCurves(aFaceFace.Lines(), aRequest->Curves);
+        aRequest->Points = aFaceFace.Points();
+        myFaceFaceCache->Add(*aRequest);
+      }
+    }
     //
     const IntTools_SequenceOfCurves& aCvsX = aFaceFace.Lines();
     const IntTools_SequenceOfPntOn2Faces& aPntsX = aFaceFace.Points();
@@ -534,6 +887,9 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
       aNP.SetPnt(aP);
     }
   }
+  //
+  // Release the results for the pairs not requested by this operation
+  aCacheSentry.SetCompleted();
 }
 
 //=======================================================================
@@ -612,6 +968,12 @@ void BOPAlgo_PaveFiller::MakeBlocks(const Message_ProgressRange& theRange)
   // some of Face-Face intersections to avoid missing section edges
   // aNbFF will be increased to the number of potentially problematic Face-Face intersections
   const Standard_Integer aNbFFPrev = aNbFF;
+  //
+  // Collect the stick vertices for all pairs of faces at once,
+  // as the interferences and SD vertices are not changed in the loop below
+  BOPAlgo_VectorOfStickVertices aVStickVertices;
+  collectStickVertices(myDS, myRunParallel, Standard_True, aVStickVertices);
+  //
   for (i = 0; i < aNbFF; ++i, aPS.Next()) 
   {
     if (UserBreak(aPS))
@@ -673,7 +1035,19 @@ void BOPAlgo_PaveFiller::MakeBlocks(const Message_ProgressRange& theRange)
     // 2. Treat Curves
     aMVStick.Clear();
     aMVEF.Clear();
-    GetStickVertices(nF1, nF2, aMVStick, aMVEF, aMI);
+    aMI.Clear();
+    GetFullShapeMap(nF1, aMI);
+    GetFullShapeMap(nF2, aMI);
+    {
+      const BOPAlgo_StickVertices& aSV = aVStickVertices(aCurInd);
+      TColStd_ListIteratorOfListOfInteger aItSV(aSV.StickVertices());
+      for (; aItSV.More(); aItSV.Next()) {
+        aMVStick.Add(aItSV.Value());
+      }
+      for (aItSV.Initialize(aSV.EFVertices()); aItSV.More(); aItSV.Next()) {
+        aMVEF.Add(aItSV.Value());
+      }
+    }
     //
     for (j = 0; j < aNbC; ++j) {
       BOPDS_Curve& aNC = aVC.ChangeValue(j);
@@ -1033,14 +1407,18 @@ void BOPAlgo_PaveFiller::PostTreatFF
   //Find unused vertices
   TopTools_IndexedMapOfShape VertsUnused;
   TColStd_MapOfInteger IndMap;
+  BOPAlgo_VectorOfStickVertices aVStickVertices;
+  collectStickVertices(myDS, myRunParallel, Standard_False, aVStickVertices);
   for (Standard_Integer i = 0; i < aNbFF; i++)
   {
     BOPDS_InterfFF& aFF = aFFs(i);
     Standard_Integer nF1, nF2;
     aFF.Indices(nF1, nF2);
     
-    TColStd_MapOfInteger aMV, aMVEF, aMI;
-    GetStickVertices(nF1, nF2, aMV, aMVEF, aMI);
+    TColStd_MapOfInteger aMV;
+    TColStd_ListIteratorOfListOfInteger aItSV(aVStickVertices(i).StickVertices());
+    for (; aItSV.More(); aItSV.Next())
+      aMV.Add(aItSV.Value());
     BOPDS_VectorOfCurve& aVC = aFF.ChangeCurves();
     RemoveUsedVertices (aVC, aMV);
 
@@ -2536,52 +2914,23 @@ void BOPAlgo_PaveFiller::GetStickVertices(const Standard_Integer nF1,
                                           TColStd_MapOfInteger& aMVEF,
                                           TColStd_MapOfInteger& aMI)
 {
-  Standard_Integer nS1, nS2, nVNew, aTypeInt, i;
-  //
-  BOPDS_VectorOfInterfVV& aVVs=myDS->InterfVV();
-  BOPDS_VectorOfInterfVE& aVEs=myDS->InterfVE();
-  BOPDS_VectorOfInterfEE& aEEs=myDS->InterfEE();
-  BOPDS_VectorOfInterfVF& aVFs=myDS->InterfVF();
-  BOPDS_VectorOfInterfEF& aEFs=myDS->InterfEF();
-  //
-  Standard_Integer aNbLines[5] = {
-    aVVs.Length(), aVEs.Length(), aEEs.Length(),
-    aVFs.Length(), aEFs.Length()
-    };
   //collect indices of all shapes from nF1 and nF2.
   aMI.Clear();
   GetFullShapeMap(nF1, aMI);
   GetFullShapeMap(nF2, aMI);
   //
-  //collect VV, VE, EE, VF interferences
-  for (aTypeInt = 0; aTypeInt < 4; ++aTypeInt) {
-    for (i = 0; i < aNbLines[aTypeInt]; ++i) {
-      BOPDS_Interf* aInt = (aTypeInt==0) ? (BOPDS_Interf*)(&aVVs(i)) : 
-        ((aTypeInt==1) ? (BOPDS_Interf*)(&aVEs(i)) :
-         ((aTypeInt==2) ? (BOPDS_Interf*)(&aEEs(i)) : 
-          (BOPDS_Interf*)(&aVFs(i))));
-      if (aInt->HasIndexNew()) {
-        aInt->Indices(nS1, nS2);
-        if(aMI.Contains(nS1) && aMI.Contains(nS2)) {
-          nVNew = aInt->IndexNew();
-          myDS->HasShapeSD (nVNew, nVNew);
-          aMVStick.Add(nVNew);
-        }
-      }
-    }
+  //collect VV, VE, EE, VF and EF interferences
+  BOPAlgo_StickVertices aSV;
+  aSV.SetDS(myDS);
+  aSV.SetIndices(nF1, nF2);
+  aSV.Perform();
+  //
+  TColStd_ListIteratorOfListOfInteger aIt(aSV.StickVertices());
+  for (; aIt.More(); aIt.Next()) {
+    aMVStick.Add(aIt.Value());
   }
-  //collect EF interferences
-  for (i = 0; i < aNbLines[4]; ++i) {
-    const BOPDS_InterfEF& aInt = aEFs(i);
-    if (aInt.HasIndexNew()) {
-      aInt.Indices(nS1, nS2);
-      if(aMI.Contains(nS1) && aMI.Contains(nS2)) {
-        nVNew = aInt.IndexNew();
-        myDS->HasShapeSD (nVNew, nVNew);
-        aMVStick.Add(nVNew);
-        aMVEF.Add(nVNew);
-      }
-    }
+  for (aIt.Initialize(aSV.EFVertices()); aIt.More(); aIt.Next()) {
+    aMVEF.Add(aIt.Value());
   }
 }
 
@@ -3548,6 +3897,39 @@ void BOPAlgo_PaveFiller::UpdateBlocksWithSharedVertices()
   Standard_Real aTolV;
   TColStd_MapOfInteger aMF;
   //
+  // Check the location of the shared vertices on the section curves
+  // of all pairs in parallel. The vertices are taken from the current
+  // state of the faces (including their own vertices, which may appear
+  // on the faces after initialization of the pave blocks below), and the
+  // results are only consulted in the sequential treatment below.
+  BOPAlgo_VectorOfSharedVerticesOnCurves aVSVC;
+  {
+    NCollection_DataMap<Standard_Integer, TColStd_MapOfInteger> aDMFV;
+    for (i=0; i<aNbFF; ++i) {
+      BOPAlgo_SharedVerticesOnCurves& aSVC=aVSVC.Appended();
+      const BOPDS_InterfFF& aFF=aFFs(i);
+      if (aFF.Curves().IsEmpty()) {
+        continue;
+      }
+      //
+      aFF.Indices(nF1, nF2);
+      const TColStd_MapOfInteger& aMV1=sharedVerticesCandidates(myDS, nF1, aDMFV);
+      const TColStd_MapOfInteger& aMV2=sharedVerticesCandidates(myDS, nF2, aDMFV);
+      //
+      TColStd_MapIteratorOfMapOfInteger aItMV(aMV1);
+      for (; aItMV.More(); aItMV.Next()) {
+        nV=aItMV.Value();
+        if (aMV2.Contains(nV) && !myDS->HasShapeSD(nV, nVSD)) {
+          aSVC.AddVertex(nV, TopoDS::Vertex(myDS->Shape(nV)));
+        }
+      }
+      aSVC.SetCurves(&aFF.Curves());
+    }
+  }
+  //======================================================
+  BOPTools_Parallel::Perform (myRunParallel, aVSVC, myContext);
+  //======================================================
+  //
   for (i=0; i<aNbFF; ++i) {
     BOPDS_InterfFF& aFF=aFFs(i);
     //
@@ -3592,6 +3974,8 @@ void BOPAlgo_PaveFiller::UpdateBlocksWithSharedVertices()
       }
     }
     //
+    const BOPAlgo_SharedVerticesOnCurves& aSVC=aVSVC(i);
+    //
     // Try to put vertices aMI on curves
     for (j=0; j<aNbC; ++j) {
       BOPDS_Curve& aNC=aVC.ChangeValue(j);
@@ -3606,7 +3990,8 @@ void BOPAlgo_PaveFiller::UpdateBlocksWithSharedVertices()
           continue;
         }
         //
-        bOnCurve=EstimatePaveOnCurve(nV, aNC, aTolR3D);
+        bOnCurve=aSVC.IsChecked(nV) ?
+          aSVC.IsOnCurve(j, nV) : EstimatePaveOnCurve(nV, aNC, aTolR3D);
         if (!bOnCurve) {
           continue;
         }
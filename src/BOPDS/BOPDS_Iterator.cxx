@@ -26,8 +26,13 @@
 #include <BOPDS_Tools.hxx>
 #include <BOPTools_BoxTree.hxx>
 #include <BOPTools_Parallel.hxx>
+#include <BRep_Tool.hxx>
 #include <IntTools_Context.hxx>
+#include <NCollection_DataMap.hxx>
 #include <NCollection_Vector.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopoDS.hxx>
+#include <gp.hxx>
 #include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////
@@ -67,6 +72,225 @@ class BOPDS_TSR : public BOPTools_BoxTreeSelector
 //
 //=======================================================================
 typedef NCollection_Vector<BOPDS_TSR> BOPDS_VectorOfTSR;
+
+//=======================================================================
+//function : IsSeparated
+//purpose  : Checks if the projections of the triangles on the axis
+//           are separated by the gap greater than the given one
+//=======================================================================
+static Standard_Boolean IsSeparated(const gp_XYZ& theAxis,
+                                    const gp_XYZ* theT1,
+                                    const gp_XYZ* theT2,
+                                    const Standard_Real theGap)
+{
+  const Standard_Real aMod = theAxis.Modulus();
+  if (aMod < gp::Resolution()) {
+    return Standard_False;
+  }
+  const gp_XYZ anAxis = theAxis / aMod;
+  //
+  Standard_Real aMin1 = anAxis.Dot(theT1[0]), aMax1 = aMin1;
+  Standard_Real aMin2 = anAxis.Dot(theT2[0]), aMax2 = aMin2;
+  for (Standard_Integer i = 1; i < 3; ++i) {
+    const Standard_Real aD1 = anAxis.Dot(theT1[i]);
+    const Standard_Real aD2 = anAxis.Dot(theT2[i]);
+    aMin1 = Min(aMin1, aD1);
+    aMax1 = Max(aMax1, aD1);
+    aMin2 = Min(aMin2, aD2);
+    aMax2 = Max(aMax2, aD2);
+  }
+  return (aMin2 - aMax1 > theGap) || (aMin1 - aMax2 > theGap);
+}
+//=======================================================================
+//function : AreTrianglesNear
+//purpose  : Separating axis test for the triangles enlarged by the gap.
+//           Returns false only if the distance between the triangles
+//           is guaranteed to be greater than the gap.
+//=======================================================================
+static Standard_Boolean AreTrianglesNear(const gp_XYZ* theT1,
+                                         const gp_XYZ* theT2,
+                                         const Standard_Real theGap)
+{
+  const gp_XYZ aE1[3] = { theT1[1] - theT1[0], theT1[2] - theT1[1], theT1[0] - theT1[2] };
+  const gp_XYZ aE2[3] = { theT2[1] - theT2[0], theT2[2] - theT2[1], theT2[0] - theT2[2] };
+  //
+  // normals of the triangles
+  if (IsSeparated(aE1[0] ^ aE1[1], theT1, theT2, theGap) ||
+      IsSeparated(aE2[0] ^ aE2[1], theT1, theT2, theGap)) {
+    return Standard_False;
+  }
+  // cross products of the edges
+  for (Standard_Integer i = 0; i < 3; ++i) {
+    for (Standard_Integer j = 0; j < 3; ++j) {
+      if (IsSeparated(aE1[i] ^ aE2[j], theT1, theT2, theGap)) {
+        return Standard_False;
+      }
+    }
+  }
+  return Standard_True;
+}
+
+/////////////////////////////////////////////////////////////////////////
+//=======================================================================
+//class    : BOPDS_FaceTriangles
+//purpose  : Triangles of the face with the tree of their bounding boxes
+//           enlarged by the deflection of the triangulation and
+//           the tolerance of the face
+//=======================================================================
+class BOPDS_FaceTriangles
+{
+ public:
+  BOPDS_FaceTriangles() :
+    myIsValid(Standard_False),
+    myGap(0.) {}
+  //
+  void SetFace(const TopoDS_Face& theFace) {
+    myFace = theFace;
+  }
+  //
+  //! Returns true if the face has the triangulation suitable for the check
+  Standard_Boolean IsValid() const { return myIsValid; }
+  //
+  //! Returns the maximal distance from the triangles to the face
+  Standard_Real Gap() const { return myGap; }
+  //
+  //! Gets the nodes of the triangle
+  void Triangle(const Standard_Integer theIndex,
+                gp_XYZ* theNodes) const {
+    Standard_Integer aN[3];
+    myTriangles(theIndex).Get(aN[0], aN[1], aN[2]);
+    for (Standard_Integer i = 0; i < 3; ++i) {
+      theNodes[i] = myNodes(aN[i]);
+    }
+  }
+  //
+  BOPTools_BoxTree& Tree() { return myTree; }
+  //
+  void Perform() {
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation =
+      BRep_Tool::Triangulation(myFace, aLoc);
+    if (aTriangulation.IsNull() ||
+        aTriangulation->NbTriangles() == 0 ||
+        aTriangulation->Deflection() <= 0.) {
+      return;
+    }
+    //
+    // The deflection is controlled by the meshing algorithms in the sample
+    // points of the triangles only, thus it is doubled for safety
+    Standard_Real aTol = BRep_Tool::Tolerance(myFace);
+    aTol = Max(aTol, BRep_Tool::MaxTolerance(myFace, TopAbs_EDGE));
+    aTol = Max(aTol, BRep_Tool::MaxTolerance(myFace, TopAbs_VERTEX));
+    myGap = 2. * aTriangulation->Deflection() + aTol;
+    //
+    const Standard_Integer aNbNodes = aTriangulation->NbNodes();
+    myNodes.Resize(1, aNbNodes, Standard_False);
+    for (Standard_Integer i = 1; i <= aNbNodes; ++i) {
+      gp_Pnt aP = aTriangulation->Node(i);
+      if (!aLoc.IsIdentity()) {
+        aP.Transform(aLoc.Transformation());
+      }
+      myNodes(i) = aP.XYZ();
+    }
+    //
+    const Standard_Integer aNbTriangles = aTriangulation->NbTriangles();
+    myTriangles.Resize(1, aNbTriangles, Standard_False);
+    myTree.SetSize(aNbTriangles);
+    for (Standard_Integer i = 1; i <= aNbTriangles; ++i) {
+      myTriangles(i) = aTriangulation->Triangle(i);
+      //
+      gp_XYZ aT[3];
+      Triangle(i, aT);
+      Bnd_Box aBox;
+      for (Standard_Integer j = 0; j < 3; ++j) {
+        aBox.Add(gp_Pnt(aT[j]));
+      }
+      aBox.Enlarge(myGap);
+      myTree.Add(i, Bnd_Tools::Bnd2BVH(aBox));
+    }
+    myTree.Build();
+    myIsValid = Standard_True;
+  }
+  //
+ protected:
+  TopoDS_Face myFace;
+  Standard_Boolean myIsValid;
+  Standard_Real myGap;
+  NCollection_Array1<gp_XYZ> myNodes;
+  NCollection_Array1<Poly_Triangle> myTriangles;
+  BOPTools_BoxTree myTree;
+};
+//
+//=======================================================================
+typedef NCollection_Vector<BOPDS_FaceTriangles> BOPDS_VectorOfFaceTriangles;
+
+/////////////////////////////////////////////////////////////////////////
+//=======================================================================
+//class    : BOPDS_FacePairChecker
+//purpose  : Checks if the triangles of the pair of faces are near
+//           to each other. Stops on the first pair of near triangles.
+//=======================================================================
+class BOPDS_FacePairChecker : public BOPTools_BoxPairSelector
+{
+ public:
+  BOPDS_FacePairChecker() :
+    BOPTools_BoxPairSelector(),
+    myFT1(NULL),
+    myFT2(NULL),
+    myFuzzyValue(0.),
+    myIsNear(Standard_False) {}
+  //
+  virtual ~BOPDS_FacePairChecker() {
+  }
+  //
+  void SetFaces(BOPDS_FaceTriangles* theFT1,
+                BOPDS_FaceTriangles* theFT2) {
+    myFT1 = theFT1;
+    myFT2 = theFT2;
+  }
+  //
+  void SetFuzzyValue(const Standard_Real theFuzz) {
+    myFuzzyValue = theFuzz;
+  }
+  //
+  //! Returns true if the faces may interfere
+  Standard_Boolean IsNear() const { return myIsNear; }
+  //
+  virtual Standard_Boolean Stop() const Standard_OVERRIDE {
+    return myIsNear;
+  }
+  //
+  virtual Standard_Boolean Accept(const Standard_Integer theID1,
+                                  const Standard_Integer theID2) Standard_OVERRIDE {
+    if (RejectElement(theID1, theID2)) {
+      return Standard_False;
+    }
+    gp_XYZ aT1[3], aT2[3];
+    myFT1->Triangle(myBVHSet1->Element(theID1), aT1);
+    myFT2->Triangle(myBVHSet2->Element(theID2), aT2);
+    myIsNear = AreTrianglesNear(aT1, aT2, myFT1->Gap() + myFT2->Gap() + myFuzzyValue);
+    return myIsNear;
+  }
+  //
+  void Perform() {
+    if (!myFT1->IsValid() || !myFT2->IsValid()) {
+      // Nothing to check - keep the pair
+      myIsNear = Standard_True;
+      return;
+    }
+    SetBVHSets(&myFT1->Tree(), &myFT2->Tree());
+    Select();
+  }
+  //
+ protected:
+  BOPDS_FaceTriangles* myFT1;
+  BOPDS_FaceTriangles* myFT2;
+  Standard_Real myFuzzyValue;
+  Standard_Boolean myIsNear;
+};
+//
+//=======================================================================
+typedef NCollection_Vector<BOPDS_FacePairChecker> BOPDS_VectorOfFacePairChecker;
 /////////////////////////////////////////////////////////////////////////
 
 //=======================================================================
@@ -77,7 +301,8 @@ BOPDS_Iterator::BOPDS_Iterator()
 :
   myAllocator(NCollection_BaseAllocator::CommonBaseAllocator()),
   myRunParallel(Standard_False),
-  myUseExt(Standard_False)
+  myUseExt(Standard_False),
+  myNbCulledPairs(0)
 {
   Standard_Integer i, aNb;
   //
@@ -107,7 +332,8 @@ BOPDS_Iterator::BOPDS_Iterator
   myLists(0, theAllocator),
   myRunParallel(Standard_False),
   myExtLists(0, theAllocator),
-  myUseExt(Standard_False)
+  myUseExt(Standard_False),
+  myNbCulledPairs(0)
 {
   Standard_Integer i, aNb;
   //
@@ -257,12 +483,14 @@ void BOPDS_Iterator::Value(Standard_Integer& theI1,
 //=======================================================================
 void BOPDS_Iterator::Prepare(const Handle(IntTools_Context)& theCtx,
                              const Standard_Boolean theCheckOBB,
-                             const Standard_Real theFuzzyValue)
+                             const Standard_Real theFuzzyValue,
+                             const Standard_Boolean theCheckTriangulation)
 {
   Standard_Integer i, aNbInterfTypes;
   //
   aNbInterfTypes=BOPDS_DS::NbInterfTypes();
   myLength=0;
+  myNbCulledPairs=0;
   for (i=0; i<aNbInterfTypes; ++i) {
     myLists(i).Clear();
   }
@@ -271,6 +499,10 @@ void BOPDS_Iterator::Prepare(const Handle(IntTools_Context)& theCtx,
     return;
   }
   Intersect(theCtx, theCheckOBB, theFuzzyValue);
+  //
+  if (theCheckTriangulation) {
+    CullFaceFacePairs(theFuzzyValue);
+  }
 }
 //
 //=======================================================================
@@ -452,3 +684,61 @@ void BOPDS_Iterator::IntersectExt(const TColStd_MapOfInteger& theIndices)
 
   myUseExt = Standard_True;
 }
+
+//=======================================================================
+// function: CullFaceFacePairs
+// purpose: 
+//=======================================================================
+void BOPDS_Iterator::CullFaceFacePairs(const Standard_Real theFuzzyValue)
+{
+  myNbCulledPairs = 0;
+  //
+  const Standard_Integer iFF = BOPDS_Tools::TypeToInteger(TopAbs_FACE, TopAbs_FACE);
+  BOPDS_VectorOfPair& aPairs = myLists(iFF);
+  const Standard_Integer aNbPairs = aPairs.Length();
+  if (!aNbPairs) {
+    return;
+  }
+  //
+  // Prepare the triangles of the faces
+  NCollection_DataMap<Standard_Integer, Standard_Integer> aMFT;
+  BOPDS_VectorOfFaceTriangles aVFT;
+  for (Standard_Integer k = 0; k < aNbPairs; ++k) {
+    Standard_Integer nF[2];
+    aPairs(k).Indices(nF[0], nF[1]);
+    for (Standard_Integer i = 0; i < 2; ++i) {
+      if (!aMFT.IsBound(nF[i])) {
+        aMFT.Bind(nF[i], aVFT.Length());
+        aVFT.Appended().SetFace(TopoDS::Face(myDS->Shape(nF[i])));
+      }
+    }
+  }
+  BOPTools_Parallel::Perform(myRunParallel, aVFT);
+  //
+  // Check the pairs
+  BOPDS_VectorOfFacePairChecker aVFPC;
+  for (Standard_Integer k = 0; k < aNbPairs; ++k) {
+    Standard_Integer nF1, nF2;
+    aPairs(k).Indices(nF1, nF2);
+    //
+    BOPDS_FacePairChecker& aChecker = aVFPC.Appended();
+    aChecker.SetFaces(&aVFT(aMFT.Find(nF1)), &aVFT(aMFT.Find(nF2)));
+    aChecker.SetFuzzyValue(theFuzzyValue);
+  }
+  BOPTools_Parallel::Perform(myRunParallel, aVFPC);
+  //
+  // Keep only the pairs which may interfere
+  Standard_Integer aNbKept = 0;
+  for (Standard_Integer k = 0; k < aNbPairs; ++k) {
+    if (aVFPC(k).IsNear()) {
+      if (aNbKept != k) {
+        aPairs(aNbKept) = aPairs(k);
+      }
+      ++aNbKept;
+    }
+  }
+  myNbCulledPairs = aNbPairs - aNbKept;
+  for (Standard_Integer k = 0; k < myNbCulledPairs; ++k) {
+    aPairs.EraseLast();
+  }
+}
@@ -78,10 +78,14 @@ public:
                               Standard_Integer& theIndex2) const;
 
   //! Perform the intersection algorithm and prepare
-  //! the results to be used
+  //! the results to be used.
+  //! If <theCheckTriangulation> is true, the pairs of faces with interfering
+  //! bounding boxes are additionally checked using the triangulations
+  //! of the faces (see CullFaceFacePairs()).
   Standard_EXPORT virtual void Prepare(const Handle(IntTools_Context)& theCtx = Handle(IntTools_Context)(),
                                        const Standard_Boolean theCheckOBB = Standard_False,
-                                       const Standard_Real theFuzzyValue = Precision::Confusion());
+                                       const Standard_Real theFuzzyValue = Precision::Confusion(),
+                                       const Standard_Boolean theCheckTriangulation = Standard_False);
 
   //! Updates the tree of Bounding Boxes with increased boxes and
   //! intersects such elements with the tree.
@@ -101,6 +105,10 @@ public:
   //! Returns the flag of parallel processing
   Standard_EXPORT Standard_Boolean RunParallel() const;
 
+  //! Returns the number of pairs of faces discarded by the check
+  //! of the triangulations of the faces during the last preparation
+  Standard_Integer NbCulledPairs() const { return myNbCulledPairs; }
+
 
 public: //! @name Number of extra interfering types
 
@@ -116,6 +124,16 @@ protected: //! @name Protected methods for bounding boxes intersection
                                          const Standard_Boolean theCheckOBB = Standard_False,
                                          const Standard_Real theFuzzyValue = Precision::Confusion());
 
+  //! Removes the pairs of faces with interfering bounding boxes,
+  //! the triangulations of which are found to be far from each other.
+  //! The pair is discarded only if both faces have the triangulations
+  //! with defined deflection, and none of the pairs of their triangles,
+  //! enlarged by the deflections and tolerances of the faces and by the
+  //! fuzzy value, overlaps. The pairs with not triangulated faces are kept.
+  //! The filter relies on the triangulations to be consistent with the geometry
+  //! of the faces, e.g. computed by BRepMesh_IncrementalMesh.
+  Standard_EXPORT void CullFaceFacePairs(const Standard_Real theFuzzyValue);
+
 protected: //! @name Fields
 
   Handle(NCollection_BaseAllocator) myAllocator; //!< Allocator
@@ -128,6 +146,8 @@ protected: //! @name Fields
   BOPDS_VectorOfVectorOfPair myExtLists;         //!< Extra pairs of sub-shapes found after
                                                  //! intersection of increased sub-shapes
   Standard_Boolean myUseExt;                     //!< Information flag for using the extra lists
+  Standard_Integer myNbCulledPairs;              //!< Number of pairs of faces discarded
+                                                 //! by the check of triangulations
 
 };
 
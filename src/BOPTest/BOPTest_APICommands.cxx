@@ -19,6 +19,7 @@
 #include <BRepAlgoAPI_Common.hxx>
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepAlgoAPI_MeshBoolean.hxx>
 #include <BRepAlgoAPI_Section.hxx>
 #include <BRepAlgoAPI_Splitter.hxx>
 #include <BRepTest_Objects.hxx>
@@ -33,6 +34,7 @@
 static Standard_Integer bapibuild(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bapibop  (Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bapisplit(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bapimeshbop(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
 //function : APICommands
@@ -68,6 +70,21 @@ void BOPTest::APICommands(Draw_Interpretor& theCommands)
                   "\t\tObjects for the operation are added using commands baddobjects and baddtools.\n"
                   "\t\tUsage: bapisplit result",
                   __FILE__, bapisplit, g);
+
+  theCommands.Add("bapimeshbop", "Builds the preview of Boolean operation on the meshes of the shapes.\n"
+                  "\t\tThe shapes should be meshed beforehand.\n"
+                  "\t\tUsage: bapimeshbop result s1 s2 op\n"
+                  "\t\tWhere:\n"
+                  "\t\tresult - name of the result shape (face with triangulation)\n"
+                  "\t\ts1, s2 - Object and Tool of the operation\n"
+                  "\t\top - type of Boolean operation. Possible values:\n"
+                  "\t\t     - 0/common - for Common operation\n"
+                  "\t\t     - 1/fuse - for Fuse operation\n"
+                  "\t\t     - 2/cut - for Cut operation\n"
+                  "\t\t     - 3/tuc/cut21 - for Cut21 operation\n"
+                  "\t\tSection operation is not supported.\n"
+                  "\t\tParallel mode is defined by command bparallel, fuzzy value is not used.",
+                  __FILE__, bapimeshbop, g);
 }
 //=======================================================================
 //function : bapibop
@@ -144,6 +161,9 @@ Standard_Integer bapibop(Draw_Interpretor& di,
   pBuilder->SetGlue(aGlue);
   pBuilder->SetCheckInverted(BOPTest_Objects::CheckInverted());
   pBuilder->SetUseOBB(BOPTest_Objects::UseOBB());
+  pBuilder->SetUseTriangulationFilter(BOPTest_Objects::UseTriangulationFilter());
+  pBuilder->SetFaceFaceCache(BOPTest_Objects::FaceFaceCache());
+  pBuilder->SetBatchMode(BOPTest_Objects::BatchMode());
   pBuilder->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -156,6 +176,12 @@ Standard_Integer bapibop(Draw_Interpretor& di,
   if (BRepTest_Objects::IsHistoryNeeded())
     BRepTest_Objects::SetHistory(pBuilder->History());
 
+  if (pBuilder->BatchMode()) {
+    di << "Batch mode: " << (pBuilder->IsBatchPerformed() ?
+      "the operation has been performed by groups" :
+      "the usual algorithm has been performed") << "\n";
+  }
+
   if (pBuilder->HasWarnings()) {
     Standard_SStream aSStream;
     pBuilder->DumpWarnings(aSStream);
@@ -212,6 +238,8 @@ Standard_Integer bapibuild(Draw_Interpretor& di,
   aBuilder.SetGlue(aGlue);
   aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetUseTriangulationFilter(BOPTest_Objects::UseTriangulationFilter());
+  aBuilder.SetFaceFaceCache(BOPTest_Objects::FaceFaceCache());
   aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -272,6 +300,8 @@ Standard_Integer bapisplit(Draw_Interpretor& di,
   aSplitter.SetGlue(BOPTest_Objects::Glue());
   aSplitter.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aSplitter.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSplitter.SetUseTriangulationFilter(BOPTest_Objects::UseTriangulationFilter());
+  aSplitter.SetFaceFaceCache(BOPTest_Objects::FaceFaceCache());
   aSplitter.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   // performing operation
@@ -310,3 +340,56 @@ Standard_Integer bapisplit(Draw_Interpretor& di,
   DBRep::Set(a[1], aR);
   return 0;
 }
+
+//=======================================================================
+//function : bapimeshbop
+//purpose  : 
+//=======================================================================
+Standard_Integer bapimeshbop(Draw_Interpretor& di,
+                             Standard_Integer n,
+                             const char** a)
+{
+  if (n != 5) {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+  //
+  TopoDS_Shape aS1 = DBRep::Get(a[2]);
+  TopoDS_Shape aS2 = DBRep::Get(a[3]);
+  if (aS1.IsNull() || aS2.IsNull()) {
+    di << "Null shapes are not allowed\n";
+    return 1;
+  }
+  //
+  BOPAlgo_Operation anOp = BOPTest::GetOperationType(a[4]);
+  if (anOp == BOPAlgo_UNKNOWN || anOp == BOPAlgo_SECTION)
+  {
+    di << "Invalid operation type\n";
+    return 1;
+  }
+  //
+  BRepAlgoAPI_MeshBoolean aMB;
+  aMB.SetObject(aS1);
+  aMB.SetTool(aS2);
+  aMB.SetOperation(anOp);
+  aMB.SetRunParallel(BOPTest_Objects::RunParallel());
+  //
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
+  aMB.Build(aProgress->Start());
+  //
+  if (aMB.HasWarnings()) {
+    Standard_SStream aSStream;
+    aMB.DumpWarnings(aSStream);
+    di << aSStream;
+  }
+  //
+  if (aMB.HasErrors()) {
+    Standard_SStream aSStream;
+    aMB.DumpErrors(aSStream);
+    di << aSStream;
+    return 0;
+  }
+  //
+  DBRep::Set(a[1], aMB.Shape());
+  return 0;
+}
@@ -159,6 +159,8 @@ Standard_Integer bop(Draw_Interpretor& di,
   pPF->SetNonDestructive(bNonDestructive);
   pPF->SetGlue(aGlue);
   pPF->SetUseOBB(BOPTest_Objects::UseOBB());
+  pPF->SetUseTriangulationFilter(BOPTest_Objects::UseTriangulationFilter());
+  pPF->SetFaceFaceCache(BOPTest_Objects::FaceFaceCache());
   //
   pPF->Perform(aProgress->Start());
   BOPTest::ReportAlerts(pPF->GetReport());
@@ -444,6 +446,7 @@ Standard_Integer  bsection(Draw_Interpretor& di,
   aSec.SetNonDestructive(bNonDestructive);
   aSec.SetGlue(aGlue);
   aSec.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSec.SetUseTriangulationFilter(BOPTest_Objects::UseTriangulationFilter());
   //
   aSec.Build(aProgress->Start());  
   // Store the history of Section operation into the session
@@ -512,6 +515,7 @@ Standard_Integer bsmt (Draw_Interpretor& di,
   aBOP.SetNonDestructive(BOPTest_Objects::NonDestructive());
   aBOP.SetRunParallel(BOPTest_Objects::RunParallel());
   aBOP.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBOP.SetUseTriangulationFilter(BOPTest_Objects::UseTriangulationFilter());
   aBOP.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBOP.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
@@ -829,6 +833,7 @@ Standard_Integer mkvolume(Draw_Interpretor& di, Standard_Integer n, const char**
   aMV.SetAvoidInternalShapes(bAvoidInternal);
   aMV.SetGlue(aGlue);
   aMV.SetUseOBB(BOPTest_Objects::UseOBB());
+  aMV.SetUseTriangulationFilter(BOPTest_Objects::UseTriangulationFilter());
   aMV.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
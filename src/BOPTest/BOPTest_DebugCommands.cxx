@@ -243,7 +243,8 @@ Standard_Integer bopiterator (Draw_Interpretor& di,
 
   BOPDS_DS& aDS = *pDS;
   aIt.SetDS(&aDS);
-  aIt.Prepare(aCtx, BOPTest_Objects::UseOBB(), BOPTest_Objects::FuzzyValue());
+  aIt.Prepare(aCtx, BOPTest_Objects::UseOBB(), BOPTest_Objects::FuzzyValue(),
+              BOPTest_Objects::UseTriangulationFilter());
   //
   if (n == 1) {
     // type has not been defined. show all pairs
@@ -108,6 +108,9 @@ class BOPTest_Session {
     myDrawWarnShapes = Standard_False;
     myCheckInverted = Standard_True;
     myUseOBB = Standard_False;
+    myUseTriangulationFilter = Standard_False;
+    myFaceFaceCache.Nullify();
+    myBatchMode = Standard_False;
     myUnifyEdges = Standard_False;
     myUnifyFaces = Standard_False;
     myAngTol = Precision::Angular();
@@ -168,6 +171,30 @@ class BOPTest_Session {
   Standard_Boolean UseOBB() const {
     return myUseOBB;
   };
+  //
+  void SetUseTriangulationFilter(const Standard_Boolean bUse) {
+    myUseTriangulationFilter = bUse;
+  };
+  //
+  Standard_Boolean UseTriangulationFilter() const {
+    return myUseTriangulationFilter;
+  };
+  //
+  void SetFaceFaceCache(const Handle(BOPAlgo_FaceFaceCache)& theCache) {
+    myFaceFaceCache = theCache;
+  };
+  //
+  const Handle(BOPAlgo_FaceFaceCache)& FaceFaceCache() const {
+    return myFaceFaceCache;
+  };
+  //
+  void SetBatchMode(const Standard_Boolean bBatch) {
+    myBatchMode = bBatch;
+  };
+  //
+  Standard_Boolean BatchMode() const {
+    return myBatchMode;
+  };
 
   // Controls the Unification of Edges after BOP
   void SetUnifyEdges(const Standard_Boolean bUE) { myUnifyEdges = bUE; }
@@ -204,6 +231,9 @@ protected:
   Standard_Boolean myDrawWarnShapes;
   Standard_Boolean myCheckInverted;
   Standard_Boolean myUseOBB;
+  Standard_Boolean myUseTriangulationFilter;
+  Handle(BOPAlgo_FaceFaceCache) myFaceFaceCache;
+  Standard_Boolean myBatchMode;
   Standard_Boolean myUnifyEdges;
   Standard_Boolean myUnifyFaces;
   Standard_Real myAngTol;
@@ -457,6 +487,54 @@ Standard_Boolean BOPTest_Objects::UseOBB()
   return GetSession().UseOBB();
 }
 //=======================================================================
+//function : SetUseTriangulationFilter
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetUseTriangulationFilter(const Standard_Boolean bUse)
+{
+  GetSession().SetUseTriangulationFilter(bUse);
+}
+//=======================================================================
+//function : UseTriangulationFilter
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPTest_Objects::UseTriangulationFilter()
+{
+  return GetSession().UseTriangulationFilter();
+}
+//=======================================================================
+//function : SetFaceFaceCache
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetFaceFaceCache(const Handle(BOPAlgo_FaceFaceCache)& theCache)
+{
+  GetSession().SetFaceFaceCache(theCache);
+}
+//=======================================================================
+//function : FaceFaceCache
+//purpose  : 
+//=======================================================================
+const Handle(BOPAlgo_FaceFaceCache)& BOPTest_Objects::FaceFaceCache()
+{
+  return GetSession().FaceFaceCache();
+}
+//=======================================================================
+//function : SetBatchMode
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetBatchMode(const Standard_Boolean bBatch)
+{
+  GetSession().SetBatchMode(bBatch);
+}
+//=======================================================================
+//function : BatchMode
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPTest_Objects::BatchMode()
+{
+  return GetSession().BatchMode();
+}
+//=======================================================================
 //function : SetUnifyEdges
 //purpose  : 
 //=======================================================================
@@ -23,6 +23,7 @@
 #include <BOPAlgo_PBuilder.hxx>
 #include <BOPAlgo_CellsBuilder.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_FaceFaceCache.hxx>
 //
 class BOPAlgo_PaveFiller;
 class BOPAlgo_Builder;
@@ -94,6 +95,18 @@ public:
 
   Standard_EXPORT static Standard_Boolean UseOBB();
 
+  Standard_EXPORT static void SetUseTriangulationFilter(const Standard_Boolean bUse);
+
+  Standard_EXPORT static Standard_Boolean UseTriangulationFilter();
+
+  Standard_EXPORT static void SetFaceFaceCache(const Handle(BOPAlgo_FaceFaceCache)& theCache);
+
+  Standard_EXPORT static const Handle(BOPAlgo_FaceFaceCache)& FaceFaceCache();
+
+  Standard_EXPORT static void SetBatchMode(const Standard_Boolean bBatch);
+
+  Standard_EXPORT static Standard_Boolean BatchMode();
+
   Standard_EXPORT static void SetUnifyEdges(const Standard_Boolean bUE);
   Standard_EXPORT static Standard_Boolean UnifyEdges();
 
@@ -18,6 +18,8 @@
 #include <DBRep.hxx>
 #include <Draw.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_PaveFiller.hxx>
+#include <BOPDS_Iterator.hxx>
 
 #include <string.h>
 static Standard_Integer boptions (Draw_Interpretor&, Standard_Integer, const char**); 
@@ -28,6 +30,9 @@ static Standard_Integer bGlue(Draw_Interpretor&, Standard_Integer, const char**)
 static Standard_Integer bdrawwarnshapes(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bcheckinverted(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer buseobb(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer busetrifilter(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bffcache(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bbatch(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bsimplify(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
@@ -75,6 +80,23 @@ void BOPTest::OptionCommands(Draw_Interpretor& theCommands)
                              "\t\tUsage: buseobb 0 (off) / 1 (on)",
                   __FILE__, buseobb, g);
 
+  theCommands.Add("busetrifilter", "Enables/disables the filtering of the pairs of faces for intersection\n"
+                                   "\t\tusing the triangulations of the faces in BOP algorithms\n"
+                                   "\t\tUsage: busetrifilter [0 (off) / 1 (on)]\n"
+                                   "\t\tw/o arguments shows the number of pairs of faces culled by the filter\n"
+                                   "\t\tin the last intersection performed by bfillds command",
+                  __FILE__, busetrifilter, g);
+
+  theCommands.Add("bffcache", "Enables/disables the cache of Face/Face intersection results shared by BOP algorithms\n"
+                              "\t\tUsage: bffcache [0 (off) / 1 (on)]\n"
+                              "\t\tw/o arguments shows the statistics of the cache usage by the last operation",
+                  __FILE__, bffcache, g);
+
+  theCommands.Add("bbatch", "Enables/disables the batch mode of CUT operation in bapibop command\n"
+                            "\t\tIn this mode the arguments are cut by groups of interacting shapes\n"
+                            "\t\tUsage: bbatch 0 (off) / 1 (on)",
+                  __FILE__, bbatch, g);
+
   theCommands.Add("bsimplify", "Enables/Disables the result simplification after BOP\n"
                                "\t\tUsage: bsimplify [-e 0/1] [-f 0/1] [-a tol]\n"
                                "\t\t-e 0/1 - enables/disables edges unification\n"
@@ -134,6 +156,15 @@ Standard_Integer boptions(Draw_Interpretor& di,
   Sprintf(buf, " Use OBB: %s \t\t\t(%s)\n", BOPTest_Objects::UseOBB() ? "Yes" : "No",
                "use \"buseobb\" command to change");
   di << buf;
+  Sprintf(buf, " Use triangulation filter: %s \t(%s)\n", BOPTest_Objects::UseTriangulationFilter() ? "Yes" : "No",
+               "use \"busetrifilter\" command to change");
+  di << buf;
+  Sprintf(buf, " Face/Face cache: %s \t\t(%s)\n", !BOPTest_Objects::FaceFaceCache().IsNull() ? "Yes" : "No",
+               "use \"bffcache\" command to change");
+  di << buf;
+  Sprintf(buf, " Batch mode: %s \t\t\t(%s)\n", BOPTest_Objects::BatchMode() ? "Yes" : "No",
+               "use \"bbatch\" command to change");
+  di << buf;
   Sprintf(buf, " Unify Edges: %s \t\t(%s)\n", BOPTest_Objects::UnifyEdges() ? "Yes" : "No",
                "use \"bsimplify -e\" command to change");
   di << buf;
@@ -285,6 +316,96 @@ Standard_Integer buseobb(Draw_Interpretor& di,
   return 0;
 }
 
+//=======================================================================
+//function : busetrifilter
+//purpose  : 
+//=======================================================================
+Standard_Integer busetrifilter(Draw_Interpretor& di,
+                               Standard_Integer n,
+                               const char** a)
+{
+  if (n > 2)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  if (n == 1)
+  {
+    const BOPDS_PIterator& anIt = BOPTest_Objects::PaveFiller().Iterator();
+    if (!anIt)
+    {
+      di << " prepare PaveFiller first\n";
+      return 1;
+    }
+    di << "Culled pairs of faces: " << anIt->NbCulledPairs() << "\n";
+    return 0;
+  }
+
+  Standard_Integer iUse = Draw::Atoi(a[1]);
+  BOPTest_Objects::SetUseTriangulationFilter(iUse != 0);
+  return 0;
+}
+
+//=======================================================================
+//function : bffcache
+//purpose  : 
+//=======================================================================
+Standard_Integer bffcache(Draw_Interpretor& di,
+                          Standard_Integer n,
+                          const char** a)
+{
+  if (n > 2)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  if (n == 1)
+  {
+    const Handle(BOPAlgo_FaceFaceCache)& aCache = BOPTest_Objects::FaceFaceCache();
+    if (aCache.IsNull())
+    {
+      di << "Face/Face cache is disabled\n";
+      return 0;
+    }
+    di << "Cached pairs: " << aCache->Size() << "\n";
+    di << "Reused pairs: " << aCache->NbReused() << "\n";
+    di << "Computed pairs: " << aCache->NbComputed() << "\n";
+    return 0;
+  }
+
+  Standard_Integer iUse = Draw::Atoi(a[1]);
+  if (iUse == 0)
+  {
+    BOPTest_Objects::SetFaceFaceCache(Handle(BOPAlgo_FaceFaceCache)());
+  }
+  else if (BOPTest_Objects::FaceFaceCache().IsNull())
+  {
+    BOPTest_Objects::SetFaceFaceCache(new BOPAlgo_FaceFaceCache());
+  }
+  return 0;
+}
+
+//=======================================================================
+//function : bbatch
+//purpose  : 
+//=======================================================================
+Standard_Integer bbatch(Draw_Interpretor& di,
+                        Standard_Integer n,
+                        const char** a)
+{
+  if (n != 2)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  Standard_Integer iBatch = Draw::Atoi(a[1]);
+  BOPTest_Objects::SetBatchMode(iBatch != 0);
+  return 0;
+}
+
 //=======================================================================
 //function : bsimplify
 //purpose  : 
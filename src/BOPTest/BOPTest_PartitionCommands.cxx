@@ -165,6 +165,8 @@ Standard_Integer bfillds(Draw_Interpretor& di,
   aPF.SetFuzzyValue(aTol);
   aPF.SetGlue(aGlue);
   aPF.SetUseOBB(BOPTest_Objects::UseOBB());
+  aPF.SetUseTriangulationFilter(BOPTest_Objects::UseTriangulationFilter());
+  aPF.SetFaceFaceCache(BOPTest_Objects::FaceFaceCache());
   //
   OSD_Timer aTimer;
   aTimer.Start();
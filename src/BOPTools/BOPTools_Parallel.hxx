@@ -24,6 +24,19 @@
 //! Implementation of Functors/Starters
 class BOPTools_Parallel
 {
+  //! Creates the context for the worker thread,
+  //! sharing the cache of tools with the main thread context
+  template<class TypeContext>
+  static opencascade::handle<TypeContext> CreateThreadContext (const opencascade::handle<TypeContext>& theMainContext)
+  {
+    opencascade::handle<TypeContext> aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+    if (!theMainContext.IsNull())
+    {
+      aContext->SetSharedCache (theMainContext->SharedCache());
+    }
+    return aContext;
+  }
+
   template<class TypeSolverVector>
   class Functor
   {
@@ -58,6 +71,7 @@ class BOPTools_Parallel
     //! Binds main thread context
     void SetContext (const opencascade::handle<TypeContext>& theContext)
     {
+      myMainContext = theContext;
       myContextMap.Bind (OSD_Thread::Current(), theContext);
     }
 
@@ -74,7 +88,7 @@ class BOPTools_Parallel
       }
 
       // Create new context
-      opencascade::handle<TypeContext> aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+      opencascade::handle<TypeContext> aContext = CreateThreadContext (myMainContext);
 
       Standard_Mutex::Sentry aLocker (myMutex);
       myContextMap.Bind (aThreadID, aContext);
@@ -97,6 +111,7 @@ class BOPTools_Parallel
 
   private:
     TypeSolverVector& mySolverVector;
+    opencascade::handle<TypeContext> myMainContext;
     mutable NCollection_DataMap<Standard_ThreadId, opencascade::handle<TypeContext>> myContextMap;
     mutable Standard_Mutex myMutex;
   };
@@ -125,7 +140,7 @@ class BOPTools_Parallel
       opencascade::handle<TypeContext>& aContext = myContextArray.ChangeValue (theThreadIndex);
       if (aContext.IsNull())
       {
-        aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+        aContext = CreateThreadContext (myContextArray.Last());
       }
       typename TypeSolverVector::value_type& aSolver = mySolverVector[theIndex];
       aSolver.SetContext (aContext);
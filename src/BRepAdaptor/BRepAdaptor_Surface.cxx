@@ -255,6 +255,46 @@ void  BRepAdaptor_Surface::D1(const Standard_Real U,
 }
 
 
+//=======================================================================
+//function : D0Batch
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D0Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                   TColgp_Array1OfPnt&         thePoints) const
+{
+  mySurf.D0Batch (theUVs, thePoints);
+  if (myTrsf.Form() != gp_Identity)
+  {
+    for (Standard_Integer i = thePoints.Lower(); i <= thePoints.Upper(); ++i)
+    {
+      thePoints (i).Transform (myTrsf);
+    }
+  }
+}
+
+//=======================================================================
+//function : D1Batch
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D1Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                   TColgp_Array1OfPnt&         thePoints,
+                                   TColgp_Array1OfVec&         theD1U,
+                                   TColgp_Array1OfVec&         theD1V) const
+{
+  mySurf.D1Batch (theUVs, thePoints, theD1U, theD1V);
+  if (myTrsf.Form() != gp_Identity)
+  {
+    for (Standard_Integer i = 0; i < thePoints.Length(); ++i)
+    {
+      thePoints (thePoints.Lower() + i).Transform (myTrsf);
+      theD1U    (theD1U.Lower()    + i).Transform (myTrsf);
+      theD1V    (theD1V.Lower()    + i).Transform (myTrsf);
+    }
+  }
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -164,6 +164,18 @@ public:
   //! Raised  if   the   continuity   of the current
   //! intervals is not C3.
   Standard_EXPORT void D3 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV, gp_Vec& D3U, gp_Vec& D3V, gp_Vec& D3UUV, gp_Vec& D3UVV) const Standard_OVERRIDE;
+
+  //! Computes the points of the surface for the array of parameters
+  //! (see GeomAdaptor_Surface::D0Batch()).
+  Standard_EXPORT void D0Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                TColgp_Array1OfPnt&         thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the surface for the array of parameters
+  //! (see GeomAdaptor_Surface::D1Batch()).
+  Standard_EXPORT void D1Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                TColgp_Array1OfPnt&         thePoints,
+                                TColgp_Array1OfVec&         theD1U,
+                                TColgp_Array1OfVec&         theD1V) const Standard_OVERRIDE;
   
   //! Computes the derivative of order Nu in the direction
   //! U and Nv in the direction V at the point P(U, V).
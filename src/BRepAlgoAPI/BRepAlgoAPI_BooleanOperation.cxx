@@ -89,7 +89,9 @@ class BRepAlgoAPI_DumpOper {
 BRepAlgoAPI_BooleanOperation::BRepAlgoAPI_BooleanOperation()
 :
   BRepAlgoAPI_BuilderAlgo(),
-  myOperation(BOPAlgo_UNKNOWN)
+  myOperation(BOPAlgo_UNKNOWN),
+  myBatchMode(Standard_False),
+  myIsBatchPerformed(Standard_False)
 {
 }
 //=======================================================================
@@ -100,7 +102,9 @@ BRepAlgoAPI_BooleanOperation::BRepAlgoAPI_BooleanOperation
   (const BOPAlgo_PaveFiller& thePF)
 :
   BRepAlgoAPI_BuilderAlgo(thePF),
-  myOperation(BOPAlgo_UNKNOWN)
+  myOperation(BOPAlgo_UNKNOWN),
+  myBatchMode(Standard_False),
+  myIsBatchPerformed(Standard_False)
 {
 }
 //=======================================================================
@@ -113,7 +117,9 @@ BRepAlgoAPI_BooleanOperation::BRepAlgoAPI_BooleanOperation
    const BOPAlgo_Operation theOp)
 :
   BRepAlgoAPI_BuilderAlgo(),
-  myOperation(theOp)
+  myOperation(theOp),
+  myBatchMode(Standard_False),
+  myIsBatchPerformed(Standard_False)
 {
   myArguments.Append(theS1);
   myTools.Append(theS2);
@@ -129,7 +135,9 @@ BRepAlgoAPI_BooleanOperation::BRepAlgoAPI_BooleanOperation
    const BOPAlgo_Operation theOp)
 :
   BRepAlgoAPI_BuilderAlgo(thePF),
-  myOperation(theOp)
+  myOperation(theOp),
+  myBatchMode(Standard_False),
+  myIsBatchPerformed(Standard_False)
 {
   myArguments.Append(theS1);
   myTools.Append(theS2);
@@ -188,6 +196,53 @@ void BRepAlgoAPI_BooleanOperation::Build(const Message_ProgressRange& theRange)
   }
 
   Message_ProgressScope aPS(theRange, aPSName, myIsIntersectionNeeded ? 100 : 30);
+  myIsBatchPerformed = Standard_False;
+  // In the batch mode the intersection and building of the result
+  // are performed by the Boolean operation algorithm itself,
+  // if the arguments are split on several groups of interacting shapes
+  if (myBatchMode && myIsIntersectionNeeded && myOperation == BOPAlgo_CUT)
+  {
+    BOPAlgo_BOP* pBOP = new BOPAlgo_BOP(myAllocator);
+    pBOP->SetArguments(myArguments);
+    pBOP->SetTools(myTools);
+    pBOP->SetOperation(myOperation);
+    pBOP->SetFuzzyValue(myFuzzyValue);
+    if (!pBOP->IsBatchApplicable())
+    {
+      // Perform the usual operation keeping the intersection results
+      delete pBOP;
+    }
+    else
+    {
+      pBOP->SetBatchMode(Standard_True);
+      pBOP->SetNonDestructive(myNonDestructive);
+      pBOP->SetGlue(myGlue);
+      pBOP->SetUseOBB(myUseOBB);
+      pBOP->SetUseTriangulationFilter(myUseTriangulationFilter);
+      pBOP->SetRunParallel(myRunParallel);
+      pBOP->SetCheckInverted(myCheckInverted);
+      pBOP->SetToFillHistory(myFillHistory);
+      pBOP->SetFaceFaceCache(myFaceFaceCache);
+      myBuilder = pBOP;
+      //
+      myBuilder->Perform(aPS.Next(100));
+      myIsBatchPerformed = pBOP->IsBatchPerformed();
+      GetReport()->Merge(myBuilder->GetReport());
+      if (myBuilder->HasErrors())
+      {
+        return;
+      }
+      Done();
+      myShape = myBuilder->Shape();
+      if (myFillHistory)
+      {
+        myHistory = new BRepTools_History;
+        myHistory->Merge(myBuilder->History());
+      }
+      return;
+    }
+  }
+
   // If necessary perform intersection of the argument shapes
   if (myIsIntersectionNeeded)
   {
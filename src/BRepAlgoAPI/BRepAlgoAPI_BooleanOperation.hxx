@@ -107,6 +107,36 @@ public: //! @name Setting/Getting the type of Boolean operation
   }
 
 
+public: //! @name Batch mode
+
+  //! Sets the batch mode for the *CUT* operation (see BOPAlgo_BOP::SetBatchMode()).<br>
+  //! In this mode the Objects and Tools are distributed into the groups
+  //! of interacting shapes, which are cut independently and in parallel.
+  //! It is intended for cutting the large sets of shapes by many small Tools.<br>
+  //! If the arguments are split on several groups, the intersection results (DSFiller())
+  //! and the section edges are not available. Otherwise, the usual algorithm is performed
+  //! with all its results available (see IsBatchPerformed()). The mode is ignored
+  //! if the intersection results have been provided to the operation.
+  void SetBatchMode(const Standard_Boolean theFlag)
+  {
+    myBatchMode = theFlag;
+  }
+
+  //! Returns the flag of the batch mode.
+  Standard_Boolean BatchMode() const
+  {
+    return myBatchMode;
+  }
+
+  //! Returns TRUE if the last operation has actually been performed in the
+  //! batch mode, i.e. by the groups of interacting shapes
+  //! (see BOPAlgo_BOP::IsBatchPerformed()).
+  Standard_Boolean IsBatchPerformed() const
+  {
+    return myIsBatchPerformed;
+  }
+
+
 public: //! @name Performing the operation
 
   //! Performs the Boolean operation.
@@ -134,6 +164,8 @@ protected: //! @name Fields
 
   TopTools_ListOfShape myTools;  //!< Tool arguments of operation
   BOPAlgo_Operation myOperation; //!< Type of Boolean Operation
+  Standard_Boolean myBatchMode;  //!< Batch mode of the CUT operation
+  Standard_Boolean myIsBatchPerformed; //!< Flag of the operation performed in the batch mode
 
 };
 
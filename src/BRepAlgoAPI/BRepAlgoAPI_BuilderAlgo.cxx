@@ -130,6 +130,8 @@ void BRepAlgoAPI_BuilderAlgo::IntersectShapes(const TopTools_ListOfShape& theArg
   myDSFiller->SetNonDestructive(myNonDestructive);
   myDSFiller->SetGlue(myGlue);
   myDSFiller->SetUseOBB(myUseOBB);
+  myDSFiller->SetUseTriangulationFilter(myUseTriangulationFilter);
+  myDSFiller->SetFaceFaceCache(myFaceFaceCache);
   // Set Face/Face intersection options to the intersection algorithm
   SetAttributes();
   // Perform intersection
@@ -258,7 +260,7 @@ Standard_Boolean BRepAlgoAPI_BuilderAlgo::HasDeleted() const
 const TopTools_ListOfShape& BRepAlgoAPI_BuilderAlgo::SectionEdges()
 {
   myGenerated.Clear();
-  if (myBuilder == NULL)
+  if (myBuilder == NULL || myDSFiller == NULL)
     return myGenerated;
 
   // Fence map to avoid duplicated section edges in the result list
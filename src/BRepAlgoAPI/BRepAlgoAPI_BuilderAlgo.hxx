@@ -19,6 +19,7 @@
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Handle.hxx>
 
+#include <BOPAlgo_FaceFaceCache.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
 #include <BOPAlgo_PPaveFiller.hxx>
 #include <BOPAlgo_PBuilder.hxx>
@@ -133,6 +134,20 @@ public: //! @name Setting options
     return myCheckInverted;
   }
 
+  //! Sets the cache of Face/Face intersection results, allowing to reuse
+  //! the results of intersection of unmodified faces in the consequent runs
+  //! of the algorithm on the modified arguments (see BOPAlgo_FaceFaceCache).
+  void SetFaceFaceCache(const Handle(BOPAlgo_FaceFaceCache)& theCache)
+  {
+    myFaceFaceCache = theCache;
+  }
+
+  //! Returns the cache of Face/Face intersection results
+  const Handle(BOPAlgo_FaceFaceCache)& FaceFaceCache() const
+  {
+    return myFaceFaceCache;
+  }
+
 
 public: //! @name Performing the operation
 
@@ -270,6 +285,7 @@ protected: //! @name Fields
   Standard_Boolean myNonDestructive; //!< Non-destructive mode management
   BOPAlgo_GlueEnum myGlue;           //!< Gluing mode management
   Standard_Boolean myCheckInverted;  //!< Check for inverted solids management
+  Handle(BOPAlgo_FaceFaceCache) myFaceFaceCache; //!< Cache of Face/Face intersection results
   Standard_Boolean myFillHistory;    //!< Controls the history collection
 
   // Tools
@@ -0,0 +1,182 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepAlgoAPI_MeshBoolean.hxx>
+
+#include <BOPAlgo_Alerts.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Face.hxx>
+
+//=======================================================================
+//function : BRepAlgoAPI_MeshBoolean
+//purpose  :
+//=======================================================================
+BRepAlgoAPI_MeshBoolean::BRepAlgoAPI_MeshBoolean()
+: BRepAlgoAPI_Algo(),
+  myOperation (BOPAlgo_UNKNOWN)
+{
+}
+
+//=======================================================================
+//function : BRepAlgoAPI_MeshBoolean
+//purpose  :
+//=======================================================================
+BRepAlgoAPI_MeshBoolean::BRepAlgoAPI_MeshBoolean (const TopoDS_Shape& theObject,
+                                                  const TopoDS_Shape& theTool,
+                                                  const BOPAlgo_Operation theOperation,
+                                                  const Message_ProgressRange& theRange)
+: BRepAlgoAPI_Algo(),
+  myObject (theObject),
+  myTool (theTool),
+  myOperation (theOperation)
+{
+  Build (theRange);
+}
+
+//=======================================================================
+//function : Build
+//purpose  :
+//=======================================================================
+void BRepAlgoAPI_MeshBoolean::Build (const Message_ProgressRange& theRange)
+{
+  // Set not done state for the operation
+  NotDone();
+
+  // Clear the tools performing the operation
+  Clear();
+  myShape.Nullify();
+
+  // Set the inputs to BOPAlgo_MeshBoolean algorithm
+  myMeshBoolean.SetObject (collectTriangulation (myObject));
+  myMeshBoolean.SetTool (collectTriangulation (myTool));
+  myMeshBoolean.SetOperation (myOperation);
+  myMeshBoolean.SetRunParallel (myRunParallel);
+  myMeshBoolean.SetFuzzyValue (myFuzzyValue);
+
+  // Perform the operation
+  myMeshBoolean.Perform (theRange);
+
+  // Merge the Errors/Warnings from the mesh boolean tool
+  GetReport()->Merge (myMeshBoolean.GetReport());
+
+  if (HasErrors())
+    return;
+
+  // Set done state
+  Done();
+
+  // Make the result shape
+  const Handle(Poly_Triangulation)& aResult = myMeshBoolean.Triangulation();
+  BRep_Builder aBB;
+  if (aResult->NbTriangles() == 0)
+  {
+    TopoDS_Compound anEmpty;
+    aBB.MakeCompound (anEmpty);
+    myShape = anEmpty;
+  }
+  else
+  {
+    TopoDS_Face aFace;
+    aBB.MakeFace (aFace, aResult);
+    myShape = aFace;
+  }
+}
+
+//=======================================================================
+//function : collectTriangulation
+//purpose  :
+//=======================================================================
+Handle(Poly_Triangulation) BRepAlgoAPI_MeshBoolean::collectTriangulation (const TopoDS_Shape& theShape)
+{
+  if (theShape.IsNull())
+  {
+    return Handle(Poly_Triangulation)();
+  }
+
+  // Nodes of the faces are merged by coordinates to keep the
+  // connectivity of the triangles of the adjacent faces
+  NCollection_DataMap<gp_Pnt, Standard_Integer> aNodesMap;
+  NCollection_Vector<gp_Pnt> aNodes;
+  NCollection_Vector<Poly_Triangle> aTriangles;
+
+  for (TopExp_Explorer anExp (theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (anExp.Current());
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTris = BRep_Tool::Triangulation (aFace, aLoc);
+    if (aTris.IsNull() || aTris->NbTriangles() == 0)
+    {
+      AddWarning (new BOPAlgo_AlertFaceWithoutTriangulation (aFace));
+      continue;
+    }
+
+    const gp_Trsf& aTrsf = aLoc.Transformation();
+    const Standard_Boolean isIdentity = aLoc.IsIdentity();
+    // mirroring transformation inverts the orientation of triangles
+    const Standard_Boolean isMirrored = !isIdentity && aTrsf.VectorialPart().Determinant() < 0.0;
+    const Standard_Boolean isReversed = (aFace.Orientation() == TopAbs_REVERSED) != isMirrored;
+
+    const Standard_Integer aNbNodes = aTris->NbNodes();
+    NCollection_Array1<Standard_Integer> aNodeIds (1, aNbNodes);
+    for (Standard_Integer i = 1; i <= aNbNodes; ++i)
+    {
+      gp_Pnt aP = aTris->Node (i);
+      if (!isIdentity)
+      {
+        aP.Transform (aTrsf);
+      }
+      if (const Standard_Integer* anId = aNodesMap.Seek (aP))
+      {
+        aNodeIds (i) = *anId;
+        continue;
+      }
+      aNodes.Append (aP);
+      aNodeIds (i) = aNodes.Length();
+      aNodesMap.Bind (aP, aNodes.Length());
+    }
+
+    const Standard_Integer aNbTris = aTris->NbTriangles();
+    for (Standard_Integer i = 1; i <= aNbTris; ++i)
+    {
+      Standard_Integer aN1, aN2, aN3;
+      aTris->Triangle (i).Get (aN1, aN2, aN3);
+      if (isReversed)
+      {
+        std::swap (aN2, aN3);
+      }
+      aTriangles.Append (Poly_Triangle (aNodeIds (aN1), aNodeIds (aN2), aNodeIds (aN3)));
+    }
+  }
+
+  if (aTriangles.IsEmpty())
+  {
+    return new Poly_Triangulation();
+  }
+
+  Handle(Poly_Triangulation) aMesh = new Poly_Triangulation (aNodes.Length(), aTriangles.Length(), Standard_False);
+  for (Standard_Integer i = 0; i < aNodes.Length(); ++i)
+  {
+    aMesh->SetNode (i + 1, aNodes (i));
+  }
+  for (Standard_Integer i = 0; i < aTriangles.Length(); ++i)
+  {
+    aMesh->SetTriangle (i + 1, aTriangles (i));
+  }
+  return aMesh;
+}
@@ -0,0 +1,157 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepAlgoAPI_MeshBoolean_HeaderFile
+#define _BRepAlgoAPI_MeshBoolean_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+#include <BOPAlgo_MeshBoolean.hxx>
+#include <BRepAlgoAPI_Algo.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! The BRepAlgoAPI_MeshBoolean is the API algorithm for fast approximate
+//! Boolean operations on the meshes of the shapes, intended for
+//! visualization of the preview of the results of Boolean operations.
+//!
+//! The algorithm collects the triangulations of the faces of the arguments
+//! (which should be meshed beforehand, e.g. by BRepMesh_IncrementalMesh),
+//! merges them into the single triangulation for each argument and
+//! performs the operation using the low-level *BOPAlgo_MeshBoolean* algorithm.
+//! Thus, the algorithm has the same input data requirements and limitations
+//! as the low-level algorithm: the meshes of the arguments should bound the
+//! closed volumes, and the result has no B-Rep geometry and may contain
+//! T-junctions on the intersection lines.
+//!
+//! The result of the operation is a FACE without surface, carrying
+//! the resulting triangulation only (or an empty COMPOUND in case of empty result).
+//! Such results may be used as the arguments of further operations,
+//! allowing to build the previews of the trees of Boolean operations
+//! without the B-Rep computations.
+//!
+//! The faces of the arguments without triangulation are skipped with
+//! the warning *BOPAlgo_AlertFaceWithoutTriangulation*.
+//!
+//! The algorithm has the following options available from base class:
+//! - Error/Warning reporting system;
+//! - Parallel processing mode.
+//! The fuzzy value is not used, as the geometric predicates are exact.
+//!
+//! The algorithm does not support the history of shapes modifications.
+//!
+//! Here is the example of usage of the algorithm:
+//! ~~~~
+//! TopoDS_Shape anObject = ...;         // Object of the operation (meshed)
+//! TopoDS_Shape aTool = ...;            // Tool of the operation (meshed)
+//!
+//! BRepAlgoAPI_MeshBoolean aMB;
+//! aMB.SetObject (anObject);
+//! aMB.SetTool (aTool);
+//! aMB.SetOperation (BOPAlgo_CUT);
+//! aMB.SetRunParallel (Standard_True);
+//! aMB.Build();
+//! if (!aMB.IsDone())
+//! {
+//!   // error treatment
+//! }
+//! const TopoDS_Shape& aResult = aMB.Shape();                        // Face with triangulation
+//! const Handle(Poly_Triangulation)& aMesh = aMB.Triangulation();    // Resulting triangulation
+//! ~~~~
+class BRepAlgoAPI_MeshBoolean : public BRepAlgoAPI_Algo
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+public: //! @name Constructors
+
+  //! Empty constructor
+  Standard_EXPORT BRepAlgoAPI_MeshBoolean();
+
+  //! Constructor with the arguments, performing the operation.
+  //! @param theObject [in] The Object of the operation
+  //! @param theTool [in] The Tool of the operation
+  //! @param theOperation [in] The type of the operation
+  //! @param theRange [in] The parameter to progressIndicator
+  Standard_EXPORT BRepAlgoAPI_MeshBoolean (const TopoDS_Shape& theObject,
+                                           const TopoDS_Shape& theTool,
+                                           const BOPAlgo_Operation theOperation,
+                                           const Message_ProgressRange& theRange = Message_ProgressRange());
+
+public: //! @name Setting input data for the algorithm
+
+  //! Sets the Object of the operation
+  void SetObject (const TopoDS_Shape& theObject)
+  {
+    myObject = theObject;
+  }
+
+  //! Returns the Object of the operation
+  const TopoDS_Shape& Object() const
+  {
+    return myObject;
+  }
+
+  //! Sets the Tool of the operation
+  void SetTool (const TopoDS_Shape& theTool)
+  {
+    myTool = theTool;
+  }
+
+  //! Returns the Tool of the operation
+  const TopoDS_Shape& Tool() const
+  {
+    return myTool;
+  }
+
+  //! Sets the type of Boolean operation
+  void SetOperation (const BOPAlgo_Operation theOperation)
+  {
+    myOperation = theOperation;
+  }
+
+  //! Returns the type of Boolean operation
+  BOPAlgo_Operation Operation() const
+  {
+    return myOperation;
+  }
+
+public: //! @name Performing the operation
+
+  //! Performs the operation
+  Standard_EXPORT virtual void Build (const Message_ProgressRange& theRange = Message_ProgressRange()) Standard_OVERRIDE;
+
+  //! Returns the resulting triangulation
+  const Handle(Poly_Triangulation)& Triangulation() const
+  {
+    return myMeshBoolean.Triangulation();
+  }
+
+protected: //! @name Protected methods
+
+  //! Merges the triangulations of the faces of the shape into single triangulation,
+  //! taking into account the locations and orientations of the faces.
+  Standard_EXPORT Handle(Poly_Triangulation) collectTriangulation (const TopoDS_Shape& theShape);
+
+protected: //! @name Fields
+
+  TopoDS_Shape        myObject;      //!< Object of the operation
+  TopoDS_Shape        myTool;        //!< Tool of the operation
+  BOPAlgo_Operation   myOperation;   //!< Type of the operation
+  BOPAlgo_MeshBoolean myMeshBoolean; //!< Tool performing the operation
+
+};
+
+#endif // _BRepAlgoAPI_MeshBoolean_HeaderFile
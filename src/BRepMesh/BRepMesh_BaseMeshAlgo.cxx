@@ -278,6 +278,7 @@ Handle(Poly_Triangulation) BRepMesh_BaseMeshAlgo::collectTriangles()
 
     aRes->SetTriangle (aTriangeId, Poly_Triangle (aNode[0], aNode[1], aNode[2]));
   }
+  aRes->SetDoublePrecision (!myParameters.SinglePrecisionNodes);
   aRes->ResizeNodes (myUsedNodes->Extent(), false);
   aRes->AddUVNodes();
   return aRes;
@@ -23,6 +23,8 @@
 
 #include <BRepMesh_MeshAlgoFactory.hxx>
 #include <BRepMesh_DelabellaMeshAlgoFactory.hxx>
+#include <BRepMesh_StructuredMeshAlgoFactory.hxx>
+#include <BRepMesh_LawsonMeshAlgoFactory.hxx>
 #include <Message.hxx>
 #include <OSD_Environment.hxx>
 
@@ -48,6 +50,16 @@ BRepMesh_Context::BRepMesh_Context (IMeshTools_MeshAlgoType theMeshType)
     {
       theMeshType = IMeshTools_MeshAlgoType_Delabella;
     }
+    else if (aValue == "structured"
+          || aValue == "2")
+    {
+      theMeshType = IMeshTools_MeshAlgoType_Structured;
+    }
+    else if (aValue == "lawson"
+          || aValue == "3")
+    {
+      theMeshType = IMeshTools_MeshAlgoType_Lawson;
+    }
     else
     {
       if (!aValue.IsEmpty())
@@ -68,6 +80,12 @@ BRepMesh_Context::BRepMesh_Context (IMeshTools_MeshAlgoType theMeshType)
     case IMeshTools_MeshAlgoType_Delabella:
       aAlgoFactory = new BRepMesh_DelabellaMeshAlgoFactory();
       break;
+    case IMeshTools_MeshAlgoType_Structured:
+      aAlgoFactory = new BRepMesh_StructuredMeshAlgoFactory();
+      break;
+    case IMeshTools_MeshAlgoType_Lawson:
+      aAlgoFactory = new BRepMesh_LawsonMeshAlgoFactory();
+      break;
   }
 
   SetModelBuilder (new BRepMesh_ModelBuilder);
@@ -16,6 +16,7 @@
 #include <BRepMesh_DelaunayBaseMeshAlgo.hxx>
 #include <BRepMesh_MeshTool.hxx>
 #include <BRepMesh_Delaun.hxx>
+#include <BRepMesh_StripTriangulator.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_DelaunayBaseMeshAlgo, BRepMesh_ConstrainedBaseMeshAlgo)
 
@@ -44,6 +45,16 @@ void BRepMesh_DelaunayBaseMeshAlgo::generateMesh(const Message_ProgressRange& th
   const Handle(BRepMesh_DataStructureOfDelaun)& aStructure = getStructure();
   const Handle(VectorOfPnt)&                    aNodesMap  = getNodesMap();
 
+  // BRepMesh_Delaun inserts the nodes one by one, thus the base triangulation
+  // of large face is built by the strips of its domain triangulated in parallel
+  const Standard_Integer aStripsNb = getParameters().InParallelFace ?
+    BRepMesh_StripTriangulator::StripsNb (aStructure->NbNodes()) : 1;
+  if (aStripsNb > 1)
+  {
+    generateMeshByStrips (aStripsNb, theRange);
+    return;
+  }
+
   IMeshData::VectorOfInteger aVerticesOrder(aNodesMap->Size(), getAllocator());
   for (Standard_Integer i = 1; i <= aNodesMap->Size(); ++i)
   {
@@ -61,3 +72,43 @@ void BRepMesh_DelaunayBaseMeshAlgo::generateMesh(const Message_ProgressRange& th
   }
   postProcessMesh(aMesher, theRange);
 }
+
+//=======================================================================
+//function : generateMeshByStrips
+//purpose  :
+//=======================================================================
+void BRepMesh_DelaunayBaseMeshAlgo::generateMeshByStrips (const Standard_Integer       theStripsNb,
+                                                          const Message_ProgressRange& theRange)
+{
+  const Handle(BRepMesh_DataStructureOfDelaun)& aStructure = getStructure();
+  const Standard_Integer aNodesNb = aStructure->NbNodes();
+
+  BRepMesh_StripTriangulator::Perform (aStructure, theStripsNb);
+
+  // the constraints are recovered within the base triangulation,
+  // then the triangles of the auxiliary nodes (corners of the box and ends of the seams) are removed
+  std::pair<Standard_Integer, Standard_Integer> aCellsCount = getCellsCount (aStructure->NbNodes());
+  BRepMesh_Delaun aMesher (aStructure, aCellsCount.first, aCellsCount.second, Standard_False);
+
+  const Standard_Integer aNewNodesNb = aStructure->NbNodes();
+  IMeshData::VectorOfInteger aAuxVertices (aNewNodesNb - aNodesNb);
+  for (Standard_Integer aExtNodesIt = aNodesNb + 1; aExtNodesIt <= aNewNodesNb; ++aExtNodesIt)
+  {
+    aAuxVertices.Append (aExtNodesIt);
+  }
+  aMesher.SetAuxVertices (aAuxVertices);
+  aMesher.ProcessConstraints();
+  aMesher.RemoveAuxElements();
+
+  BRepMesh_MeshTool aCleaner (aStructure);
+  aCleaner.EraseFreeLinks();
+
+  if (!theRange.More())
+  {
+    return;
+  }
+
+  // circles of the triangles are needed for further insertion of nodes
+  aMesher.InitCirclesTool (aCellsCount.first, aCellsCount.second);
+  postProcessMesh (aMesher, theRange);
+}
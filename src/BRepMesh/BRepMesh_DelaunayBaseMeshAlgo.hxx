@@ -21,6 +21,11 @@
 
 //! Class provides base functionality to build face triangulation using Dealunay approach.
 //! Performs generation of mesh using raw data from model.
+//! If IMeshTools_Parameters::InParallelFace is set, the base triangulation of large face
+//! is built by vertical strips of its domain triangulated in parallel and joined along the seams
+//! (see BRepMesh_StripTriangulator), then BRepMesh_Delaun recovers the constraints.
+//! Such triangulation is reproducible, but may differ from the one built sequentially
+//! because of the auxiliary nodes at the ends of the seams.
 class BRepMesh_DelaunayBaseMeshAlgo : public BRepMesh_ConstrainedBaseMeshAlgo
 {
 public:
@@ -37,6 +42,12 @@ protected:
 
   //! Generates mesh for the contour stored in data structure.
   Standard_EXPORT virtual void generateMesh (const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+private:
+
+  //! Generates mesh using the base triangulation built by the given number of strips in parallel.
+  void generateMeshByStrips (const Standard_Integer       theStripsNb,
+                             const Message_ProgressRange& theRange);
 };
 
 #endif
@@ -101,13 +101,7 @@ protected:
       {
         break;
       }
-      // Iterate on current triangles
-      IMeshData::IteratorOfMapOfInteger aTriangleIt(this->getStructure()->ElementsOfDomain());
-      for (; aTriangleIt.More(); aTriangleIt.Next())
-      {
-        const BRepMesh_Triangle& aTriangle = this->getStructure()->GetElement(aTriangleIt.Key());
-        splitTriangleGeometry(aTriangle);
-      }
+      splitTrianglesGeometry (this->getSubregionsNb (this->getStructure()->ElementsOfDomain().Extent()));
 
       isInserted = this->insertNodes(myControlNodes, theMesher, aPS.Next());
     }
@@ -194,49 +188,187 @@ private:
     const gp_Pnt& myPnt2;
   };
 
-  //! Returns nodes info of the given triangle.
-  void getTriangleInfo(
-    const BRepMesh_Triangle& theTriangle,
-    const Standard_Integer (&theNodesIndices)[3],
-    TriangleNodeInfo       (&theInfo)[3]) const
+  //! Point to be checked for deviation from the surface.
+  struct ControlPoint
   {
-    const Standard_Integer(&e)[3] = theTriangle.myEdges;
-    for (Standard_Integer i = 0; i < 3; ++i)
+    ControlPoint()
+    : SqDeviation(0.),
+      IsLink(Standard_False)
     {
-      const BRepMesh_Vertex& aVertex = this->getStructure()->GetNode(theNodesIndices[i]);
-      theInfo[i].Point2d        = this->getRangeSplitter().Scale(aVertex.Coord(), Standard_False).XY();
-      theInfo[i].Point          = this->getNodesMap()->Value(aVertex.Location3d()).XYZ();
-      theInfo[i].isFrontierLink = (this->getStructure()->GetLink(e[i]).Movability() == BRepMesh_Frontier);
     }
-  }
 
-  // Check geometry of the given triangle. If triangle does not suit specified deflection, inserts new point.
-  void splitTriangleGeometry(const BRepMesh_Triangle& theTriangle)
+    gp_XY            Point2d;     //!< Parameters of the point
+    gp_Pnt           Point;       //!< 3d point on the surface
+    Standard_Real    SqDeviation; //!< Square deviation of the point from the mesh
+    TriangleNodeInfo Nodes[2];    //!< Ends of the link or first node of the triangle
+    gp_Vec           Normal;      //!< Normal of the triangle
+    Standard_Boolean IsLink;      //!< Middle point of the link or center of the triangle
+  };
+
+  typedef NCollection_Vector<ControlPoint> VectorOfControlPoints;
+
+  //! Functor computing the points on the surface and their deviations
+  //! for one subregion of the control points.
+  class ControlPointsEvaluator
   {
-    if (theTriangle.Movability() != BRepMesh_Deleted)
+  public:
+
+    ControlPointsEvaluator (const Handle(BRepAdaptor_Surface)& theSurface,
+                            VectorOfControlPoints&             thePoints,
+                            const Standard_Integer             theSubregionsNb)
+    : mySurface      (theSurface),
+      myPoints       (thePoints),
+      mySubregionsNb (theSubregionsNb)
     {
+    }
+
+    void operator() (const Standard_Integer theSubregion) const
+    {
+      // Adaptors of the surfaces are not thread-safe, thus use own copy for each subregion
+      const Handle(Adaptor3d_Surface) aSurface = (mySubregionsNb > 1) ?
+        mySurface->ShallowCopy() : Handle(Adaptor3d_Surface)(mySurface);
+
+      const Standard_Integer aPointsNb = myPoints.Length();
+      const Standard_Integer aFirst    = (Standard_Integer )((Standard_Size )aPointsNb *  theSubregion      / mySubregionsNb);
+      const Standard_Integer aLast     = (Standard_Integer )((Standard_Size )aPointsNb * (theSubregion + 1) / mySubregionsNb);
+      if (aFirst >= aLast)
+      {
+        return;
+      }
+
+      // Evaluate the points of the subregion by single batch
+      TColgp_Array1OfPnt2d aUVs (aFirst, aLast - 1);
+      for (Standard_Integer aPointIt = aFirst; aPointIt < aLast; ++aPointIt)
+      {
+        aUVs.SetValue (aPointIt, gp_Pnt2d (myPoints.Value (aPointIt).Point2d));
+      }
+      TColgp_Array1OfPnt aPnts (aFirst, aLast - 1);
+      aSurface->D0Batch (aUVs, aPnts);
+
+      for (Standard_Integer aPointIt = aFirst; aPointIt < aLast; ++aPointIt)
+      {
+        ControlPoint& aCtrlPnt = myPoints.ChangeValue (aPointIt);
+        aCtrlPnt.Point = aPnts.Value (aPointIt);
+
+        const gp_Pnt aPnt1 (aCtrlPnt.Nodes[0].Point);
+        if (aCtrlPnt.IsLink)
+        {
+          const gp_Pnt aPnt2 (aCtrlPnt.Nodes[1].Point);
+          aCtrlPnt.SqDeviation = LineDeviation (aPnt1, aPnt2).SquareDeviation (aCtrlPnt.Point);
+        }
+        else
+        {
+          aCtrlPnt.SqDeviation = NormalDeviation (aPnt1, aCtrlPnt.Normal).SquareDeviation (aCtrlPnt.Point);
+        }
+      }
+    }
+
+  private:
+
+    void operator= (const ControlPointsEvaluator& theOther);
+
+  private:
+    const Handle(BRepAdaptor_Surface)& mySurface;
+    VectorOfControlPoints&             myPoints;
+    const Standard_Integer             mySubregionsNb;
+  };
+
+  //! Checks geometry of all triangles of the mesh: deviation of the centers
+  //! of the triangles and of the middle points of their links from the surface.
+  //! The points on the surface are computed by batches, in parallel if several
+  //! subregions are given, then the points are checked in the order of triangles.
+  void splitTrianglesGeometry (const Standard_Integer theSubregionsNb)
+  {
+    // Collect control points of the triangles: centers of triangles and middle points of links
+    VectorOfControlPoints aPoints (4096);
+    IMeshData::IteratorOfMapOfInteger aTriangleIt(this->getStructure()->ElementsOfDomain());
+    for (; aTriangleIt.More(); aTriangleIt.Next())
+    {
+      const BRepMesh_Triangle& aTriangle = this->getStructure()->GetElement(aTriangleIt.Key());
+      if (aTriangle.Movability() == BRepMesh_Deleted)
+      {
+        continue;
+      }
+
       Standard_Integer aNodexIndices[3];
-      this->getStructure()->ElementNodes(theTriangle, aNodexIndices);
+      this->getStructure()->ElementNodes(aTriangle, aNodexIndices);
 
       TriangleNodeInfo aNodesInfo[3];
-      getTriangleInfo(theTriangle, aNodexIndices, aNodesInfo);
+      getTriangleInfo(aTriangle, aNodexIndices, aNodesInfo);
 
       gp_Vec aNormal;
       gp_Vec aLinkVec[3];
-      if (computeTriangleGeometry(aNodesInfo, aLinkVec, aNormal))
+      if (!computeTriangleGeometry(aNodesInfo, aLinkVec, aNormal))
       {
-        myIsAllDegenerated = Standard_False;
+        continue;
+      }
+      myIsAllDegenerated = Standard_False;
 
-        const gp_XY aCenter2d = (aNodesInfo[0].Point2d +
-                                 aNodesInfo[1].Point2d +
-                                 aNodesInfo[2].Point2d) / 3.;
+      ControlPoint& aCenter = aPoints.Appended();
+      aCenter.Point2d  = (aNodesInfo[0].Point2d +
+                          aNodesInfo[1].Point2d +
+                          aNodesInfo[2].Point2d) / 3.;
+      aCenter.Nodes[0] = aNodesInfo[0];
+      aCenter.Normal   = aNormal;
 
-        usePoint(aCenter2d, NormalDeviation(aNodesInfo[0].Point, aNormal));
-        splitLinks(aNodesInfo, aNodexIndices);
+      for (Standard_Integer i = 0; i < 3; ++i)
+      {
+        if (aNodesInfo[i].isFrontierLink)
+        {
+          continue;
+        }
+
+        const Standard_Integer j = (i + 1) % 3;
+        if (myCouplesMap->Add(BRepMesh_OrientedEdge(Min(aNodexIndices[i], aNodexIndices[j]),
+                                                    Max(aNodexIndices[i], aNodexIndices[j]))))
+        {
+          ControlPoint& aMidPnt = aPoints.Appended();
+          aMidPnt.Point2d  = (aNodesInfo[i].Point2d + aNodesInfo[j].Point2d) / 2.;
+          aMidPnt.Nodes[0] = aNodesInfo[i];
+          aMidPnt.Nodes[1] = aNodesInfo[j];
+          aMidPnt.IsLink   = Standard_True;
+        }
+      }
+    }
+
+    // Compute the points on the surface
+    const Standard_Integer aSubregionsNb = Min (theSubregionsNb, aPoints.Length());
+    ControlPointsEvaluator anEvaluator (this->getDFace()->GetSurface(), aPoints, aSubregionsNb);
+    OSD_Parallel::For (0, aSubregionsNb, anEvaluator, aSubregionsNb < 2);
+
+    // Check the points keeping the order of the sequential processing
+    for (Standard_Integer aPointIt = 0; aPointIt < aPoints.Length(); ++aPointIt)
+    {
+      const ControlPoint& aCtrlPnt = aPoints.Value (aPointIt);
+      if (!checkDeflectionOfPointAndUpdateCache(aCtrlPnt.Point2d, aCtrlPnt.Point, aCtrlPnt.SqDeviation))
+      {
+        myControlNodes->Append(aCtrlPnt.Point2d);
+      }
+      else if (aCtrlPnt.IsLink &&
+               !rejectSplitLinksForMinSize (aCtrlPnt.Nodes[0], aCtrlPnt.Nodes[1], aCtrlPnt.Point) &&
+               !checkLinkEndsForAngularDeviation (aCtrlPnt.Nodes[0], aCtrlPnt.Nodes[1], aCtrlPnt.Point2d))
+      {
+        myControlNodes->Append(aCtrlPnt.Point2d);
       }
     }
   }
 
+  //! Returns nodes info of the given triangle.
+  void getTriangleInfo(
+    const BRepMesh_Triangle& theTriangle,
+    const Standard_Integer (&theNodesIndices)[3],
+    TriangleNodeInfo       (&theInfo)[3]) const
+  {
+    const Standard_Integer(&e)[3] = theTriangle.myEdges;
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      const BRepMesh_Vertex& aVertex = this->getStructure()->GetNode(theNodesIndices[i]);
+      theInfo[i].Point2d        = this->getRangeSplitter().Scale(aVertex.Coord(), Standard_False).XY();
+      theInfo[i].Point          = this->getNodesMap()->Value(aVertex.Location3d()).XYZ();
+      theInfo[i].isFrontierLink = (this->getStructure()->GetLink(e[i]).Movability() == BRepMesh_Frontier);
+    }
+  }
+
   //! Updates array of links vectors.
   //! @return False on degenerative triangle.
   Standard_Boolean computeTriangleGeometry(
@@ -305,67 +437,14 @@ private:
     return Standard_False;
   }
 
-  //! Computes deflection of midpoints of triangles links.
-  //! @return True if point fits specified deflection.
-  void splitLinks(
-    const TriangleNodeInfo (&theNodesInfo)[3],
-    const Standard_Integer (&theNodesIndices)[3])
-  {
-    // Check deflection at triangle links
-    for (Standard_Integer i = 0; i < 3; ++i)
-    {
-      if (theNodesInfo[i].isFrontierLink)
-      {
-        continue;
-      }
-
-      const Standard_Integer j = (i + 1) % 3;
-      // Check if this link was already processed
-      Standard_Integer aFirstVertex, aLastVertex;
-      if (theNodesIndices[i] < theNodesIndices[j])
-      {
-        aFirstVertex = theNodesIndices[i];
-        aLastVertex  = theNodesIndices[j];
-      }
-      else
-      {
-        aFirstVertex = theNodesIndices[j];
-        aLastVertex  = theNodesIndices[i];
-      }
-
-      if (myCouplesMap->Add(BRepMesh_OrientedEdge(aFirstVertex, aLastVertex)))
-      {
-        const gp_XY aMidPnt2d = (theNodesInfo[i].Point2d +
-                                 theNodesInfo[j].Point2d) / 2.;
-
-        if (!usePoint (aMidPnt2d, LineDeviation (theNodesInfo[i].Point, 
-                                                 theNodesInfo[j].Point)))
-        {
-          if (!rejectSplitLinksForMinSize (theNodesInfo[i],
-                                           theNodesInfo[j],
-                                           aMidPnt2d))
-          {
-            if (!checkLinkEndsForAngularDeviation (theNodesInfo[i],
-                                                   theNodesInfo[j],
-                                                   aMidPnt2d))
-            {
-              myControlNodes->Append(aMidPnt2d);
-            }
-          }
-        }
-      }
-    }
-  }
-
   //! Checks that two links produced as the result of a split of 
-  //! the given link by the middle point fit MinSize requirement.
+  //! the given link by the given 3d point fit MinSize requirement.
   Standard_Boolean rejectSplitLinksForMinSize (const TriangleNodeInfo& theNodeInfo1,
                                                const TriangleNodeInfo& theNodeInfo2,
-                                               const gp_XY&            theMidPoint)
+                                               const gp_Pnt&           theMidPoint)
   {
-    const gp_Pnt aPnt = getPoint3d (theMidPoint);
-    return ((theNodeInfo1.Point - aPnt.XYZ()).SquareModulus() < mySqMinSize ||
-            (theNodeInfo2.Point - aPnt.XYZ()).SquareModulus() < mySqMinSize);
+    return ((theNodeInfo1.Point - theMidPoint.XYZ()).SquareModulus() < mySqMinSize ||
+            (theNodeInfo2.Point - theMidPoint.XYZ()).SquareModulus() < mySqMinSize);
   }
 
   //! Checks the given point (located between the given nodes)
@@ -400,32 +479,6 @@ private:
     return Standard_True;
   }
 
-  //! Returns 3d point corresponding to the given one in 2d space.
-  gp_Pnt getPoint3d (const gp_XY& thePnt2d)
-  {
-    gp_Pnt aPnt;
-    this->getDFace()->GetSurface()->D0(thePnt2d.X(), thePnt2d.Y(), aPnt);
-    return aPnt;
-  }
-
-  //! Computes deflection of the given point and caches it for
-  //! insertion in case if it overflows deflection.
-  //! @return True if point has been cached for insertion.
-  template<class DeflectionFunctor>
-  Standard_Boolean usePoint(
-    const gp_XY&             thePnt2d,
-    const DeflectionFunctor& theDeflectionFunctor)
-  {
-    const gp_Pnt aPnt = getPoint3d (thePnt2d);
-    if (!checkDeflectionOfPointAndUpdateCache(thePnt2d, aPnt, theDeflectionFunctor.SquareDeviation(aPnt)))
-    {
-      myControlNodes->Append(thePnt2d);
-      return Standard_True;
-    }
-
-    return Standard_False;
-  }
-
   //! Checks the given point for specified linear deflection.
   //! Updates value of total mesh defleciton.
   Standard_Boolean checkDeflectionOfPointAndUpdateCache(
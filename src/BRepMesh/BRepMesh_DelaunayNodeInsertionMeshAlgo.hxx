@@ -18,6 +18,7 @@
 
 #include <BRepMesh_NodeInsertionMeshAlgo.hxx>
 #include <BRepMesh_GeomTool.hxx>
+#include <OSD_Parallel.hxx>
 
 //! Extends base Delaunay meshing algo in order to enable possibility 
 //! of addition of free vertices and internal nodes into the mesh.
@@ -65,7 +66,7 @@ protected:
       return Standard_False;
     }
 
-    if (myIsPreProcessSurfaceNodes)
+    if (isPreProcessSurfaceNodes())
     {
       const Handle(IMeshData::ListOfPnt2d) aSurfaceNodes =
         this->getRangeSplitter().GenerateSurfaceNodes(this->getParameters());
@@ -94,7 +95,7 @@ protected:
     }
     InsertionBaseClass::postProcessMesh (theMesher, Message_ProgressRange()); // shouldn't be range passed here?
 
-    if (!myIsPreProcessSurfaceNodes)
+    if (!isPreProcessSurfaceNodes())
     {
       const Handle(IMeshData::ListOfPnt2d) aSurfaceNodes =
         this->getRangeSplitter().GenerateSurfaceNodes(this->getParameters());
@@ -103,6 +104,29 @@ protected:
     }
   }
 
+  //! Returns TRUE if surface nodes should be registered before generation of base mesh.
+  //! In InParallelFace mode they are always included into the base triangulation,
+  //! which is built by the strips of the domain in parallel.
+  Standard_Boolean isPreProcessSurfaceNodes() const
+  {
+    return myIsPreProcessSurfaceNodes || this->getParameters().InParallelFace;
+  }
+
+  //! Returns the number of subregions (chunks of consecutive items) for
+  //! parallel processing of the given number of items of the face interior.
+  //! Returns 1 if the items should be processed in single thread.
+  Standard_Integer getSubregionsNb (const Standard_Integer theItemsNb) const
+  {
+    if (!this->getParameters().InParallelFace)
+    {
+      return 1;
+    }
+
+    const Standard_Integer aMinSubregionSize = 1024;
+    const Standard_Integer aMaxSubregionsNb  = 4 * OSD_Parallel::NbLogicalProcessors();
+    return Max (1, Min (theItemsNb / aMinSubregionSize, aMaxSubregionsNb));
+  }
+
   //! Inserts nodes into mesh.
   Standard_Boolean insertNodes(
     const Handle(IMeshData::ListOfPnt2d)& theNodes,
@@ -114,15 +138,18 @@ protected:
       return Standard_False;
     }
 
-    IMeshData::VectorOfInteger aVertexIndexes(theNodes->Size(), this->getAllocator());
-    IMeshData::ListOfPnt2d::Iterator aNodesIt(*theNodes);
-    for (Standard_Integer aNodeIt = 1; aNodesIt.More(); aNodesIt.Next(), ++aNodeIt)
+    const Standard_Integer aNodesNb = theNodes->Size();
+    NodesData aNodesData (aNodesNb);
+    classifyNodes (theNodes, aNodesData);
+
+    IMeshData::VectorOfInteger aVertexIndexes(aNodesNb, this->getAllocator());
+    for (Standard_Integer aNodeIt = 0; aNodeIt < aNodesNb; ++aNodeIt)
     {
-      const gp_Pnt2d& aPnt2d = aNodesIt.Value();
-      if (this->getClassifier()->Perform(aPnt2d) == TopAbs_IN)
+      if (aNodesData.IsIn.Value (aNodeIt))
       {
-        aVertexIndexes.Append(this->registerNode(this->getRangeSplitter().Point(aPnt2d),
-                                                 aPnt2d, BRepMesh_Free, Standard_False));
+        aVertexIndexes.Append(this->registerNode(aNodesData.Points3d.Value (aNodeIt),
+                                                 aNodesData.Points2d.Value (aNodeIt),
+                                                 BRepMesh_Free, Standard_False));
       }
     }
 
@@ -134,6 +161,119 @@ protected:
     return !aVertexIndexes.IsEmpty();
   }
 
+private:
+
+  struct NodesData;
+
+  //! Classifies the nodes and computes 3d points of the ones lying inside the face.
+  //! The nodes are generated row by row of the grid of range splitter, thus the
+  //! chunks of consecutive nodes processed in parallel correspond to the strips
+  //! of the parametric domain of the face.
+  void classifyNodes (const Handle(IMeshData::ListOfPnt2d)& theNodes,
+                      NodesData&                            theNodesData) const
+  {
+    IMeshData::ListOfPnt2d::Iterator aNodesIt(*theNodes);
+    for (Standard_Integer aNodeIt = 0; aNodesIt.More(); aNodesIt.Next(), ++aNodeIt)
+    {
+      theNodesData.Points2d.SetValue (aNodeIt, aNodesIt.Value());
+    }
+
+    const Standard_Integer aSubregionsNb = getSubregionsNb (theNodes->Size());
+    NodesClassifier aClassifier (*this->getClassifier(), this->getDFace()->GetSurface(),
+                                 theNodesData, aSubregionsNb);
+    OSD_Parallel::For (0, aSubregionsNb, aClassifier, aSubregionsNb < 2);
+  }
+
+private:
+
+  //! Nodes to be inserted into the mesh with the results of their classification.
+  struct NodesData
+  {
+    NCollection_Array1<gp_Pnt2d>         Points2d; //!< Parameters of the nodes
+    NCollection_Array1<gp_Pnt>           Points3d; //!< 3d points of the nodes lying inside the face
+    NCollection_Array1<Standard_Boolean> IsIn;     //!< Classification of the nodes
+
+    NodesData (const Standard_Integer theNodesNb)
+    : Points2d (0, theNodesNb - 1),
+      Points3d (0, theNodesNb - 1),
+      IsIn     (0, theNodesNb - 1)
+    {
+    }
+  };
+
+  //! Functor classifying the nodes of one subregion and computing
+  //! the 3d points of the nodes lying inside the face.
+  class NodesClassifier
+  {
+  public:
+
+    NodesClassifier (const BRepMesh_Classifier&         theClassifier,
+                     const Handle(BRepAdaptor_Surface)& theSurface,
+                     NodesData&                         theNodesData,
+                     const Standard_Integer             theSubregionsNb)
+    : myClassifier   (theClassifier),
+      mySurface      (theSurface),
+      myNodesData    (theNodesData),
+      mySubregionsNb (theSubregionsNb)
+    {
+    }
+
+    void operator() (const Standard_Integer theSubregion) const
+    {
+      // Adaptors of the surfaces are not thread-safe, thus use own copy for each subregion
+      const Handle(Adaptor3d_Surface) aSurface = (mySubregionsNb > 1) ?
+        mySurface->ShallowCopy() : Handle(Adaptor3d_Surface)(mySurface);
+
+      const Standard_Integer aNodesNb = myNodesData.Points2d.Length();
+      const Standard_Integer aFirst   = (Standard_Integer )((Standard_Size )aNodesNb *  theSubregion      / mySubregionsNb);
+      const Standard_Integer aLast    = (Standard_Integer )((Standard_Size )aNodesNb * (theSubregion + 1) / mySubregionsNb);
+      Standard_Integer aNbIn = 0;
+      for (Standard_Integer aNodeIt = aFirst; aNodeIt < aLast; ++aNodeIt)
+      {
+        const Standard_Boolean isIn = (myClassifier.Perform (myNodesData.Points2d.Value (aNodeIt)) == TopAbs_IN);
+        myNodesData.IsIn.SetValue (aNodeIt, isIn);
+        if (isIn)
+        {
+          ++aNbIn;
+        }
+      }
+      if (aNbIn == 0)
+      {
+        return;
+      }
+
+      // Evaluate the points inside the face by single batch
+      TColgp_Array1OfPnt2d aUVs (0, aNbIn - 1);
+      for (Standard_Integer aNodeIt = aFirst, anInIt = 0; aNodeIt < aLast; ++aNodeIt)
+      {
+        if (myNodesData.IsIn.Value (aNodeIt))
+        {
+          aUVs.SetValue (anInIt++, myNodesData.Points2d.Value (aNodeIt));
+        }
+      }
+
+      TColgp_Array1OfPnt aPoints (0, aNbIn - 1);
+      aSurface->D0Batch (aUVs, aPoints);
+      for (Standard_Integer aNodeIt = aFirst, anInIt = 0; aNodeIt < aLast; ++aNodeIt)
+      {
+        if (myNodesData.IsIn.Value (aNodeIt))
+        {
+          myNodesData.Points3d.SetValue (aNodeIt, aPoints.Value (anInIt++));
+        }
+      }
+    }
+
+  private:
+
+    void operator= (const NodesClassifier& theOther);
+
+  private:
+    const BRepMesh_Classifier&         myClassifier;
+    const Handle(BRepAdaptor_Surface)& mySurface;
+    NodesData&                         myNodesData;
+    const Standard_Integer             mySubregionsNb;
+  };
+
 private:
   
   //! Registers surface nodes in data structure.
@@ -145,16 +285,18 @@ private:
       return Standard_False;
     }
 
+    const Standard_Integer aNodesNb = theNodes->Size();
+    NodesData aNodesData (aNodesNb);
+    classifyNodes (theNodes, aNodesData);
+
     Standard_Boolean isAdded = Standard_False;
-    IMeshData::ListOfPnt2d::Iterator aNodesIt(*theNodes);
-    for (Standard_Integer aNodeIt = 1; aNodesIt.More(); aNodesIt.Next(), ++aNodeIt)
+    for (Standard_Integer aNodeIt = 0; aNodeIt < aNodesNb; ++aNodeIt)
     {
-      const gp_Pnt2d& aPnt2d = aNodesIt.Value();
-      if (this->getClassifier()->Perform(aPnt2d) == TopAbs_IN)
+      if (aNodesData.IsIn.Value (aNodeIt))
       {
         isAdded = Standard_True;
-        this->registerNode(this->getRangeSplitter().Point(aPnt2d),
-                           aPnt2d, BRepMesh_Free, Standard_False);
+        this->registerNode(aNodesData.Points3d.Value (aNodeIt),
+                           aNodesData.Points2d.Value (aNodeIt), BRepMesh_Free, Standard_False);
       }
     }
 
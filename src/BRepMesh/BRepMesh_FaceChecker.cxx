@@ -25,6 +25,9 @@ namespace
 {
   const Standard_Real MaxTangentAngle = 5. * M_PI / 180.;
 
+  //! Maximum number of segments checked as a single task.
+  const Standard_Integer MaxSegmentsInRange = 256;
+
   //! Functor to be used to fill segments and bounding box tree in parallel.
   class SegmentsFiller
   {
@@ -236,12 +239,13 @@ Standard_Boolean BRepMesh_FaceChecker::Perform()
   myIntersectingEdges = new IMeshData::MapOfIEdgePtr;
   collectSegments();
 
-  OSD_Parallel::For(0, myDFace->WiresNb(), *this, !isParallel());
+  OSD_Parallel::For(0, mySegmentsRanges.Size(), *this, !isParallelRanges());
   collectResult();
 
   myWiresBndBoxTree.Nullify();
   myWiresSegments.Nullify();
-  myWiresIntersectingEdges.Nullify();
+  mySegmentsRanges.Clear();
+  myRangesIntersectingEdges.Nullify();
   return myIntersectingEdges->IsEmpty();
 }
 
@@ -254,30 +258,49 @@ void BRepMesh_FaceChecker::collectSegments()
   SegmentsFiller aSegmentsFiller(myDFace, myWiresSegments, myWiresBndBoxTree);
   OSD_Parallel::For(0, myDFace->WiresNb(), aSegmentsFiller, !isParallel());
 
-  myWiresIntersectingEdges = new ArrayOfMapOfIEdgePtr(0, myDFace->WiresNb() - 1);
+  mySegmentsRanges.Clear();
+  for (Standard_Integer aWireIt = 0; aWireIt < myDFace->WiresNb(); ++aWireIt)
+  {
+    const Standard_Integer aSegmentsNb = myWiresSegments->Value(aWireIt)->Size();
+    for (Standard_Integer aFirstIt = 0; aFirstIt < aSegmentsNb; aFirstIt += MaxSegmentsInRange)
+    {
+      SegmentsRange aRange;
+      aRange.WireIndex    = aWireIt;
+      aRange.FirstSegment = aFirstIt;
+      aRange.LastSegment  = Min(aFirstIt + MaxSegmentsInRange, aSegmentsNb) - 1;
+      mySegmentsRanges.Append(aRange);
+    }
+  }
+
+  if (!mySegmentsRanges.IsEmpty())
+  {
+    myRangesIntersectingEdges = new ArrayOfMapOfIEdgePtr(0, mySegmentsRanges.Size() - 1);
+  }
 }
 
 //=======================================================================
 //function : perform
 //purpose  : 
 //=======================================================================
-void BRepMesh_FaceChecker::perform(const Standard_Integer theWireIndex) const
+void BRepMesh_FaceChecker::perform(const Standard_Integer theRangeIndex) const
 {
-  const Handle(Segments)&           aSegments1     = myWiresSegments->Value(theWireIndex);
-  Handle(IMeshData::MapOfIEdgePtr)& aIntersections = myWiresIntersectingEdges->ChangeValue(theWireIndex);
+  const SegmentsRange&              aRange         = mySegmentsRanges.Value(theRangeIndex);
+  const Standard_Integer            aWireIndex     = aRange.WireIndex;
+  const Handle(Segments)&           aSegments1     = myWiresSegments->Value(aWireIndex);
+  Handle(IMeshData::MapOfIEdgePtr)& aIntersections = myRangesIntersectingEdges->ChangeValue(theRangeIndex);
 
   // TODO: Tolerance is set to twice value of face deflection in order to fit regressions.
   BndBox2dTreeSelector aSelector(2 * myDFace->GetDeflection());
-  for (Standard_Integer aWireIt = theWireIndex; aWireIt < myDFace->WiresNb(); ++aWireIt)
+  for (Standard_Integer aWireIt = aWireIndex; aWireIt < myDFace->WiresNb(); ++aWireIt)
   {
     const Handle(IMeshData::BndBox2dTree)& aBndBoxTree2 = myWiresBndBoxTree->Value(aWireIt);
     const Handle(Segments)&                aSegments2 = myWiresSegments->Value(aWireIt);
 
     aSelector.SetSegments(aSegments2);
-    for (Standard_Integer aSegmentIt = 0; aSegmentIt < aSegments1->Size(); ++aSegmentIt)
+    for (Standard_Integer aSegmentIt = aRange.FirstSegment; aSegmentIt <= aRange.LastSegment; ++aSegmentIt)
     {
       const BRepMesh_FaceChecker::Segment& aSegment1 = aSegments1->Value(aSegmentIt);
-      aSelector.Reset(&aSegment1, (aWireIt == theWireIndex) ? aSegmentIt : -1);
+      aSelector.Reset(&aSegment1, (aWireIt == aWireIndex) ? aSegmentIt : -1);
       if (aBndBoxTree2->Select(aSelector) != 0)
       {
         if (aIntersections.IsNull())
@@ -304,9 +327,9 @@ void BRepMesh_FaceChecker::perform(const Standard_Integer theWireIndex) const
 //=======================================================================
 void BRepMesh_FaceChecker::collectResult()
 {
-  for (Standard_Integer aWireIt = 0; aWireIt < myDFace->WiresNb(); ++aWireIt)
+  for (Standard_Integer aRangeIt = 0; aRangeIt < mySegmentsRanges.Size(); ++aRangeIt)
   {
-    const Handle(IMeshData::MapOfIEdgePtr)& aEdges = myWiresIntersectingEdges->Value(aWireIt);
+    const Handle(IMeshData::MapOfIEdgePtr)& aEdges = myRangesIntersectingEdges->Value(aRangeIt);
     if (!aEdges.IsNull())
     {
       myIntersectingEdges->Unite(*aEdges);
@@ -26,6 +26,9 @@
 //! Explodes wires of discrete face on sets of segments using tessellation 
 //! data stored in model. Each segment is then checked for intersection with
 //! other ones. All collisions are registered and returned as result of check.
+//! Segments of each wire are split on ranges of limited size checked
+//! independently, so that the check of the face with single large wire
+//! can be performed in parallel mode as well.
 class BRepMesh_FaceChecker : public Standard_Transient
 {
 public: //! @name mesher API
@@ -77,30 +80,44 @@ public: //! @name mesher API
     return myIntersectingEdges;
   }
 
-  //! Checks wire with the given index for intersection with others.
-  void operator()(const Standard_Integer theWireIndex) const
+  //! Checks range of segments with the given index for intersection with others.
+  void operator()(const Standard_Integer theRangeIndex) const
   {
-    perform(theWireIndex);
+    perform(theRangeIndex);
   }
 
   DEFINE_STANDARD_RTTIEXT(BRepMesh_FaceChecker, Standard_Transient)
 
 private:
 
-  //! Returns True in case if check can be performed in parallel mode.
+  //! Range of segments of the wire checked as a single task.
+  struct SegmentsRange
+  {
+    Standard_Integer WireIndex;
+    Standard_Integer FirstSegment;
+    Standard_Integer LastSegment;
+  };
+
+  //! Returns True in case if check of wires can be performed in parallel mode.
   Standard_Boolean isParallel() const
   {
     return (myParameters.InParallel && myDFace->WiresNb() > 1);
   }
 
+  //! Returns True in case if check of segments can be performed in parallel mode.
+  Standard_Boolean isParallelRanges() const
+  {
+    return (myParameters.InParallel && mySegmentsRanges.Size() > 1);
+  }
+
   //! Collects face segments.
   void collectSegments();
 
   //! Collects intersecting edges.
   void collectResult();
 
-  //! Checks wire with the given index for intersection with others.
-  void perform(const Standard_Integer theWireIndex) const;
+  //! Checks range of segments with the given index for intersection with others.
+  void perform(const Standard_Integer theRangeIndex) const;
 
 private:
 
@@ -115,7 +132,8 @@ private:
 
   Handle(ArrayOfSegments)           myWiresSegments;
   Handle(ArrayOfBndBoxTree)         myWiresBndBoxTree;
-  Handle(ArrayOfMapOfIEdgePtr)      myWiresIntersectingEdges;
+  NCollection_Vector<SegmentsRange> mySegmentsRanges;
+  Handle(ArrayOfMapOfIEdgePtr)      myRangesIntersectingEdges;
   Handle(IMeshData::MapOfIEdgePtr)  myIntersectingEdges;
 
 };
@@ -15,11 +15,22 @@
 // commercial license or contractual agreement.
 
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_TFace.hxx>
+#include <BRep_Tool.hxx>
 #include <BRepMesh_Context.hxx>
 #include <BRepMesh_PluginMacro.hxx>
+#include <BRepTools_History.hxx>
+#include <IMeshData_Edge.hxx>
 #include <IMeshData_Face.hxx>
 #include <IMeshData_Wire.hxx>
 #include <IMeshTools_MeshBuilder.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <NCollection_Array1.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
@@ -28,6 +39,80 @@ namespace
   //! Default flag to control parallelization for BRepMesh_IncrementalMesh
   //! tool returned for Mesh Factory
   static Standard_Boolean IS_IN_PARALLEL = Standard_False;
+
+  //! Returns accumulated status flags of the faces and wires of the model.
+  static Standard_Integer statusMask (const Handle(IMeshData_Model)& theModel)
+  {
+    Standard_Integer aStatus = IMeshData_NoError;
+    if (theModel.IsNull())
+    {
+      return aStatus;
+    }
+
+    for (Standard_Integer aFaceIt = 0; aFaceIt < theModel->FacesNb(); ++aFaceIt)
+    {
+      const IMeshData::IFaceHandle& aDFace = theModel->GetFace(aFaceIt);
+      aStatus |= aDFace->GetStatusMask();
+
+      for (Standard_Integer aWireIt = 0; aWireIt < aDFace->WiresNb(); ++aWireIt)
+      {
+        const IMeshData::IWireHandle& aDWire = aDFace->GetWire(aWireIt);
+        aStatus |= aDWire->GetStatusMask();
+      }
+    }
+    return aStatus;
+  }
+
+  //! Resets all status flags of the model entity.
+  static void resetStatus (IMeshData_StatusOwner& theOwner)
+  {
+    theOwner.UnsetStatus (static_cast<IMeshData_Status> (theOwner.GetStatusMask()));
+  }
+
+  //! Clears discrete data and statuses of the model
+  //! to allow its processing with other parameters.
+  static void resetModel (const Handle(IMeshData_Model)& theModel)
+  {
+    for (Standard_Integer aEdgeIt = 0; aEdgeIt < theModel->EdgesNb(); ++aEdgeIt)
+    {
+      const IMeshData::IEdgeHandle& aDEdge = theModel->GetEdge (aEdgeIt);
+      aDEdge->Clear (Standard_False);
+      resetStatus (*aDEdge);
+    }
+
+    for (Standard_Integer aFaceIt = 0; aFaceIt < theModel->FacesNb(); ++aFaceIt)
+    {
+      const IMeshData::IFaceHandle& aDFace = theModel->GetFace (aFaceIt);
+      resetStatus (*aDFace);
+      for (Standard_Integer aWireIt = 0; aWireIt < aDFace->WiresNb(); ++aWireIt)
+      {
+        resetStatus (*aDFace->GetWire (aWireIt));
+      }
+    }
+  }
+
+  //! Removes all triangulations of the face together with
+  //! the polygons of its edges on these triangulations.
+  static void removeTriangulations (const TopoDS_Face& theFace)
+  {
+    TopLoc_Location aLoc;
+    const Poly_ListOfTriangulation aTriangulations = BRep_Tool::Triangulations (theFace, aLoc);
+    if (aTriangulations.IsEmpty())
+    {
+      return;
+    }
+
+    BRep_Builder aBuilder;
+    for (Poly_ListOfTriangulation::Iterator aTriIt (aTriangulations); aTriIt.More(); aTriIt.Next())
+    {
+      for (TopExp_Explorer aEdgeIt (theFace, TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+      {
+        aBuilder.UpdateEdge (TopoDS::Edge (aEdgeIt.Current()),
+                             Handle(Poly_PolygonOnTriangulation)(), aTriIt.Value(), aLoc);
+      }
+    }
+    aBuilder.UpdateFace (theFace, Handle(Poly_Triangulation)());
+  }
 }
 
 //=======================================================================
@@ -101,36 +186,333 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
 {
   initParameters();
 
-  theContext->SetShape(Shape());
+  TopoDS_Shape aShape = Shape();
+  if (!myModifiedFaces.IsEmpty())
+  {
+    aShape = prepareModifiedPart();
+    if (!TopExp_Explorer (aShape, TopAbs_FACE).More())
+    {
+      // None of the modified faces belongs to the shape - nothing to re-mesh
+      restoreRemovedMeshes();
+      myStatus = IMeshData_NoError;
+      setDone();
+      return;
+    }
+  }
+
+  theContext->SetShape(aShape);
   theContext->ChangeParameters()            = myParameters;
   theContext->ChangeParameters().CleanModel = Standard_False;
 
   Message_ProgressScope aPS(theRange, "Perform incmesh", 10);
-  IMeshTools_MeshBuilder aIncMesh(theContext);
-  aIncMesh.Perform(aPS.Next(9));
+  myStatus = IMeshData_NoError;
+  if (myParameters.NbLODs > 1)
+  {
+    performLODs (theContext, aPS.Next(9));
+  }
+  else
+  {
+    IMeshTools_MeshBuilder aIncMesh(theContext);
+    aIncMesh.Perform(aPS.Next(9));
+    myStatus = statusMask (theContext->GetModel());
+  }
+
+  // Faces failed to be re-meshed keep their previous meshes
+  restoreRemovedMeshes();
   if (!aPS.More())
   {
     myStatus = IMeshData_UserBreak;
     return;
   }
-  myStatus = IMeshData_NoError;
-  const Handle(IMeshData_Model)& aModel = theContext->GetModel();
-  if (!aModel.IsNull())
+  aPS.Next(1);
+  setDone();
+}
+
+//=======================================================================
+//function : performLODs
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::performLODs (const Handle(IMeshTools_Context)& theContext,
+                                            const Message_ProgressRange&      theRange)
+{
+  if (!theContext->BuildModel())
+  {
+    theContext->Clean();
+    return;
+  }
+
+  // In case of re-meshing of the modified faces only these faces get new levels of detail
+  // (their meshes have been already removed by prepareModifiedPart()), while the adjacent
+  // faces keep their triangulations, which are consistent with the coarser levels.
+  const Handle(IMeshData_Model) aModel = theContext->GetModel();
+  const Standard_Integer aFacesNb = aModel->FacesNb();
+  NCollection_Array1<Standard_Boolean> aToCollect (0, Max (aFacesNb - 1, 0));
+  for (Standard_Integer aFaceIt = 0; aFaceIt < aFacesNb; ++aFaceIt)
   {
-    for (Standard_Integer aFaceIt = 0; aFaceIt < aModel->FacesNb(); ++aFaceIt)
+    const TopoDS_Face& aFace = aModel->GetFace (aFaceIt)->GetFace();
+    aToCollect (aFaceIt) = myModifiedFaces.IsEmpty() || myModifiedFaces.Contains (aFace);
+    if (myModifiedFaces.IsEmpty())
     {
-      const IMeshData::IFaceHandle& aDFace = aModel->GetFace(aFaceIt);
-      myStatus |= aDFace->GetStatusMask();
+      removeTriangulations (aFace);
+    }
+  }
 
-      for (Standard_Integer aWireIt = 0; aWireIt < aDFace->WiresNb(); ++aWireIt)
+  // The levels are meshed from the coarsest to the finest one, so that the finest
+  // level is the last one stored to the shape (e.g. 3D polygons of free edges).
+  // The triangulations of the previous levels are detached from the faces
+  // (keeping the polygons of the edges on them) to be not considered as
+  // existing mesh by the next level and collected in the lists of the faces.
+  NCollection_Array1<Poly_ListOfTriangulation> aLODs (0, Max (aFacesNb - 1, 0));
+  const IMeshTools_Parameters aParameters = theContext->GetParameters();
+  Message_ProgressScope aPS (theRange, "Levels of detail", aParameters.NbLODs);
+  for (Standard_Integer aLevel = aParameters.NbLODs - 1; aLevel >= 0 && aPS.More(); --aLevel)
+  {
+    const Standard_Real aScale = Pow (aParameters.LODRatio, aLevel);
+    IMeshTools_Parameters& aLevelParameters = theContext->ChangeParameters();
+    aLevelParameters = aParameters;
+    aLevelParameters.Deflection         *= aScale;
+    aLevelParameters.DeflectionInterior *= aScale;
+    aLevelParameters.MinSize            *= aScale;
+
+    if (aLevel != aParameters.NbLODs - 1)
+    {
+      resetModel (aModel);
+    }
+
+    const Standard_Boolean isDone = theContext->DiscretizeEdges() &&
+                                    theContext->HealModel()       &&
+                                    theContext->PreProcessModel() &&
+                                    theContext->DiscretizeFaces (aPS.Next()) &&
+                                    theContext->PostProcessModel();
+    myStatus |= statusMask (aModel);
+
+    for (Standard_Integer aFaceIt = 0; aFaceIt < aFacesNb; ++aFaceIt)
+    {
+      if (!aToCollect (aFaceIt))
       {
-        const IMeshData::IWireHandle& aDWire = aDFace->GetWire(aWireIt);
-        myStatus |= aDWire->GetStatusMask();
+        continue;
+      }
+
+      const TopoDS_Face& aFace = aModel->GetFace (aFaceIt)->GetFace();
+      TopLoc_Location aLoc;
+      const Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+      if (!aTriangulation.IsNull())
+      {
+        aLODs (aFaceIt).Prepend (aTriangulation);
+        BRep_Builder().UpdateFace (aFace, Handle(Poly_Triangulation)());
       }
     }
+
+    if (!isDone)
+    {
+      break;
+    }
   }
-  aPS.Next(1);
-  setDone();
+
+  for (Standard_Integer aFaceIt = 0; aFaceIt < aFacesNb; ++aFaceIt)
+  {
+    const Poly_ListOfTriangulation& aFaceLODs = aLODs (aFaceIt);
+    if (!aFaceLODs.IsEmpty())
+    {
+      const TopoDS_Face& aFace = aModel->GetFace (aFaceIt)->GetFace();
+      const Handle(BRep_TFace)& aTFace = *((Handle(BRep_TFace)*) &aFace.TShape());
+      aTFace->Triangulations (aFaceLODs, aFaceLODs.First());
+      aTFace->Modified (Standard_True);
+    }
+  }
+
+  theContext->ChangeParameters() = aParameters;
+  theContext->Clean();
+}
+
+//=======================================================================
+//function : SetModifiedFaces
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::SetModifiedFaces (const Handle(BRepTools_History)& theHistory,
+                                                 const TopoDS_Shape&              theInitialShape)
+{
+  myModifiedFaces.Clear();
+  if (theHistory.IsNull() || theInitialShape.IsNull())
+  {
+    return;
+  }
+
+  // Collect the images of the sub-shapes of the initial shape
+  TopTools_IndexedMapOfShape aModifiedEdges;
+  TopTools_IndexedMapOfShape aImageFaces;
+  TopTools_IndexedMapOfShape aInitialShapes;
+  TopExp::MapShapes (theInitialShape, aInitialShapes);
+  for (Standard_Integer aShapeIt = 1; aShapeIt <= aInitialShapes.Extent(); ++aShapeIt)
+  {
+    const TopoDS_Shape& aInitial = aInitialShapes (aShapeIt);
+    if (!BRepTools_History::IsSupportedType (aInitial))
+    {
+      continue;
+    }
+
+    for (Standard_Integer aRelIt = 0; aRelIt < 2; ++aRelIt)
+    {
+      const TopTools_ListOfShape& aImages = aRelIt == 0 ?
+        theHistory->Modified  (aInitial) :
+        theHistory->Generated (aInitial);
+
+      for (TopTools_ListOfShape::Iterator aImageIt (aImages); aImageIt.More(); aImageIt.Next())
+      {
+        const TopoDS_Shape& aImage = aImageIt.Value();
+        if (aImage.ShapeType() == TopAbs_FACE)
+        {
+          aImageFaces.Add (aImage);
+        }
+        else if (aImage.ShapeType() == TopAbs_EDGE)
+        {
+          aModifiedEdges.Add (aImage);
+        }
+      }
+    }
+  }
+
+  // Take the faces of the meshed shape which are the images themselves
+  // or contain the modified edges
+  for (TopExp_Explorer aFaceIt (Shape(), TopAbs_FACE); aFaceIt.More(); aFaceIt.Next())
+  {
+    const TopoDS_Shape& aFace = aFaceIt.Current();
+    if (myModifiedFaces.Contains (aFace))
+    {
+      continue;
+    }
+
+    Standard_Boolean isModified = aImageFaces.Contains (aFace);
+    for (TopExp_Explorer aEdgeIt (aFace, TopAbs_EDGE); !isModified && aEdgeIt.More(); aEdgeIt.Next())
+    {
+      isModified = aModifiedEdges.Contains (aEdgeIt.Current());
+    }
+
+    if (isModified)
+    {
+      myModifiedFaces.Add (aFace);
+    }
+  }
+}
+
+//=======================================================================
+//function : prepareModifiedPart
+//purpose  : 
+//=======================================================================
+TopoDS_Shape BRepMesh_IncrementalMesh::prepareModifiedPart()
+{
+  myRemovedMeshes.Clear();
+  BRep_Builder aBuilder;
+  TopTools_IndexedMapOfShape aFaces;
+  for (TopExp_Explorer aFaceIt (Shape(), TopAbs_FACE); aFaceIt.More(); aFaceIt.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (aFaceIt.Current());
+    if (!myModifiedFaces.Contains (aFace) || !aFaces.Add (aFace))
+    {
+      continue;
+    }
+
+    if (!BRep_Tool::IsGeometric (aFace))
+    {
+      // Keep the triangulation as there is no surface to recompute it
+      continue;
+    }
+
+    // Remove the outdated mesh of the face to enforce its re-meshing,
+    // keeping it to be restored in case of failure
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+    if (!aTriangulation.IsNull())
+    {
+      RemovedMesh& aRemoved = myRemovedMeshes.Append (RemovedMesh());
+      aRemoved.Face          = aFace;
+      aRemoved.Triangulation = aTriangulation;
+      aRemoved.Location      = aLoc;
+
+      TopTools_IndexedMapOfShape aEdges;
+      TopExp::MapShapes (aFace, TopAbs_EDGE, aEdges);
+      for (Standard_Integer aEdgeIt = 1; aEdgeIt <= aEdges.Extent(); ++aEdgeIt)
+      {
+        const TopoDS_Edge aEdge = TopoDS::Edge (aEdges (aEdgeIt).Oriented (TopAbs_FORWARD));
+        RemovedPolygons aPolygons;
+        aPolygons.Edge     = aEdge;
+        aPolygons.Polygon1 = BRep_Tool::PolygonOnTriangulation (aEdge, aTriangulation, aLoc);
+        if (BRep_Tool::IsClosed (aEdge, aTriangulation, aLoc))
+        {
+          aPolygons.Polygon2 = BRep_Tool::PolygonOnTriangulation (TopoDS::Edge (aEdge.Reversed()), aTriangulation, aLoc);
+        }
+        if (!aPolygons.Polygon1.IsNull())
+        {
+          aRemoved.Polygons.Append (aPolygons);
+          aBuilder.UpdateEdge (aEdge, Handle(Poly_PolygonOnTriangulation)(), aTriangulation, aLoc);
+        }
+      }
+      aBuilder.UpdateFace (aFace, Handle(Poly_Triangulation)());
+    }
+  }
+
+  // Add the adjacent faces so that the discretization of the shared edges
+  // is extracted from their triangulations
+  TopTools_IndexedDataMapOfShapeListOfShape aEdgeFaces;
+  TopExp::MapShapesAndAncestors (Shape(), TopAbs_EDGE, TopAbs_FACE, aEdgeFaces);
+  const Standard_Integer aNbModified = aFaces.Extent();
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aNbModified; ++aFaceIt)
+  {
+    for (TopExp_Explorer aEdgeIt (aFaces (aFaceIt), TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+    {
+      const TopTools_ListOfShape* aAdjFaces = aEdgeFaces.Seek (aEdgeIt.Current());
+      if (aAdjFaces == NULL)
+      {
+        continue;
+      }
+      for (TopTools_ListOfShape::Iterator aAdjIt (*aAdjFaces); aAdjIt.More(); aAdjIt.Next())
+      {
+        aFaces.Add (aAdjIt.Value());
+      }
+    }
+  }
+
+  TopoDS_Compound aCompound;
+  aBuilder.MakeCompound (aCompound);
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaces.Extent(); ++aFaceIt)
+  {
+    aBuilder.Add (aCompound, aFaces (aFaceIt));
+  }
+  return aCompound;
+}
+
+//=======================================================================
+//function : restoreRemovedMeshes
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::restoreRemovedMeshes()
+{
+  BRep_Builder aBuilder;
+  for (NCollection_List<RemovedMesh>::Iterator aMeshIt (myRemovedMeshes); aMeshIt.More(); aMeshIt.Next())
+  {
+    const RemovedMesh& aRemoved = aMeshIt.Value();
+    TopLoc_Location aLoc;
+    if (!BRep_Tool::Triangulation (aRemoved.Face, aLoc).IsNull())
+    {
+      continue;
+    }
+
+    aBuilder.UpdateFace (aRemoved.Face, aRemoved.Triangulation);
+    for (NCollection_List<RemovedPolygons>::Iterator aPolyIt (aRemoved.Polygons); aPolyIt.More(); aPolyIt.Next())
+    {
+      const RemovedPolygons& aPolygons = aPolyIt.Value();
+      if (aPolygons.Polygon2.IsNull())
+      {
+        aBuilder.UpdateEdge (aPolygons.Edge, aPolygons.Polygon1, aRemoved.Triangulation, aRemoved.Location);
+      }
+      else
+      {
+        aBuilder.UpdateEdge (aPolygons.Edge, aPolygons.Polygon1, aPolygons.Polygon2,
+                             aRemoved.Triangulation, aRemoved.Location);
+      }
+    }
+  }
+  myRemovedMeshes.Clear();
 }
 
 //=======================================================================
@@ -16,7 +16,16 @@
 
 #include <BRepMesh_DiscretRoot.hxx>
 #include <IMeshTools_Context.hxx>
+#include <NCollection_List.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
 #include <Standard_NumericError.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+class BRepTools_History;
 
 //! Builds the mesh of a shape with respect of their 
 //! correctly triangulated parts 
@@ -59,7 +68,41 @@ public: //! @name mesher API
   //! Performs meshing using custom context;
   Standard_EXPORT void Perform(const Handle(IMeshTools_Context)& theContext,
                                const Message_ProgressRange& theRange = Message_ProgressRange());
-  
+
+public: //! @name incremental re-meshing of the modified faces
+
+  //! Restricts meshing to the given faces of the shape.
+  //! The existing triangulations of these faces are removed and the faces are meshed anew,
+  //! while the triangulations of all other faces are kept untouched.
+  //! The faces adjacent to the modified ones are also added to the data model
+  //! (and re-meshed only if their triangulations do not fit the parameters)
+  //! in order to reuse the discretization of the shared edges and keep the mesh conformal.
+  //! Note that in relative mode the size of the shape used for computation
+  //! of the deflection is the size of the re-meshed part of the shape.
+  //! When several levels of detail are requested, they are built for the modified faces only,
+  //! while the adjacent faces keep their triangulations with all levels of detail.
+  //! Empty map switches off the restriction.
+  void SetModifiedFaces (const TopTools_IndexedMapOfShape& theFaces)
+  {
+    myModifiedFaces = theFaces;
+  }
+
+  //! Restricts meshing to the faces of the shape which have been modified or generated
+  //! from the sub-shapes of the initial shape according to the given history
+  //! (see SetModifiedFaces()). Faces containing modified or generated edges
+  //! are also considered as modified.
+  //! The shape to be meshed should be set before calling this method.
+  //! @param theHistory history of the modification of the initial shape into the meshed shape
+  //! @param theInitialShape initial shape of the modification
+  Standard_EXPORT void SetModifiedFaces (const Handle(BRepTools_History)& theHistory,
+                                         const TopoDS_Shape&              theInitialShape);
+
+  //! Returns the faces to which the meshing is restricted.
+  const TopTools_IndexedMapOfShape& ModifiedFaces() const
+  {
+    return myModifiedFaces;
+  }
+
 public: //! @name accessing to parameters.
 
   //! Returns meshing parameters
@@ -88,6 +131,20 @@ public: //! @name accessing to parameters.
   
 private:
 
+  //! Removes the meshes of the modified faces and returns the compound
+  //! of these faces and their adjacent faces to be passed to the data model.
+  //! The removed meshes are kept to be restored by restoreRemovedMeshes().
+  TopoDS_Shape prepareModifiedPart();
+
+  //! Restores the meshes removed by prepareModifiedPart()
+  //! on the faces which have not been meshed anew.
+  void restoreRemovedMeshes();
+
+  //! Performs meshing of the levels of detail from the coarsest to the finest one
+  //! reusing the same data model.
+  void performLODs (const Handle(IMeshTools_Context)& theContext,
+                    const Message_ProgressRange&      theRange);
+
   //! Initializes specific parameters
   void initParameters()
   {
@@ -116,6 +173,12 @@ private:
     {
       myParameters.AngleInterior = 2.0 * myParameters.Angle;
     }
+
+    if (myParameters.NbLODs < 1
+     || (myParameters.NbLODs > 1 && myParameters.LODRatio <= 1.0))
+    {
+      throw Standard_NumericError ("BRepMesh_IncrementalMesh::initParameters : invalid parameter value");
+    }
   }
 
 public: //! @name plugin API
@@ -141,11 +204,32 @@ public: //! @name plugin API
 
   DEFINE_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
+private:
+
+  //! Polygons of the edge on the removed triangulation.
+  struct RemovedPolygons
+  {
+    TopoDS_Edge                         Edge;
+    Handle(Poly_PolygonOnTriangulation) Polygon1;
+    Handle(Poly_PolygonOnTriangulation) Polygon2; //!< polygon of the reversed closed edge
+  };
+
+  //! Mesh removed from the modified face before its re-meshing.
+  struct RemovedMesh
+  {
+    TopoDS_Face                       Face;
+    Handle(Poly_Triangulation)        Triangulation;
+    TopLoc_Location                   Location;
+    NCollection_List<RemovedPolygons> Polygons;
+  };
+
 protected:
 
-  IMeshTools_Parameters myParameters;
-  Standard_Boolean      myModified;
-  Standard_Integer      myStatus;
+  IMeshTools_Parameters         myParameters;
+  Standard_Boolean              myModified;
+  Standard_Integer              myStatus;
+  TopTools_IndexedMapOfShape    myModifiedFaces;
+  NCollection_List<RemovedMesh> myRemovedMeshes;
 };
 
 #endif
@@ -0,0 +1,47 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepMesh_LawsonBaseMeshAlgo.hxx>
+
+#include <BRepMesh_StripTriangulator.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_LawsonBaseMeshAlgo, BRepMesh_CustomBaseMeshAlgo)
+
+//=======================================================================
+// Function: Constructor
+// Purpose :
+//=======================================================================
+BRepMesh_LawsonBaseMeshAlgo::BRepMesh_LawsonBaseMeshAlgo ()
+{
+}
+
+//=======================================================================
+// Function: Destructor
+// Purpose :
+//=======================================================================
+BRepMesh_LawsonBaseMeshAlgo::~BRepMesh_LawsonBaseMeshAlgo ()
+{
+}
+
+//=======================================================================
+//function : buildBaseTriangulation
+//purpose  :
+//=======================================================================
+void BRepMesh_LawsonBaseMeshAlgo::buildBaseTriangulation()
+{
+  const Handle(BRepMesh_DataStructureOfDelaun)& aStructure = this->getStructure();
+  const Standard_Integer aStripsNb = getParameters().InParallelFace ?
+    BRepMesh_StripTriangulator::StripsNb (aStructure->NbNodes()) : 1;
+  BRepMesh_StripTriangulator::Perform (aStructure, aStripsNb);
+}
@@ -0,0 +1,42 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_LawsonBaseMeshAlgo_HeaderFile
+#define _BRepMesh_LawsonBaseMeshAlgo_HeaderFile
+
+#include <BRepMesh_CustomBaseMeshAlgo.hxx>
+
+//! Class provides base functionality to build face triangulation using incremental
+//! insertion of nodes with Lawson edge flips and exact geometric predicates
+//! (see BRepMesh_StripTriangulator). If IMeshTools_Parameters::InParallelFace is set,
+//! the domain of large face is triangulated by strips in parallel.
+//! The base triangulation is then passed to BRepMesh_Delaun to recover the constraints.
+class BRepMesh_LawsonBaseMeshAlgo : public BRepMesh_CustomBaseMeshAlgo
+{
+public:
+
+  //! Constructor.
+  Standard_EXPORT BRepMesh_LawsonBaseMeshAlgo ();
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BRepMesh_LawsonBaseMeshAlgo ();
+
+  DEFINE_STANDARD_RTTIEXT(BRepMesh_LawsonBaseMeshAlgo, BRepMesh_CustomBaseMeshAlgo)
+
+protected:
+
+  //! Builds base triangulation using incremental insertion with Lawson flips.
+  Standard_EXPORT virtual void buildBaseTriangulation() Standard_OVERRIDE;
+};
+
+#endif
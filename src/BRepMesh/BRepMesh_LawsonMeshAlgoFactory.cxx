@@ -0,0 +1,132 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_LawsonMeshAlgoFactory.hxx>
+#include <BRepMesh_SphereRangeSplitter.hxx>
+#include <BRepMesh_CylinderRangeSplitter.hxx>
+#include <BRepMesh_ConeRangeSplitter.hxx>
+#include <BRepMesh_TorusRangeSplitter.hxx>
+#include <BRepMesh_LawsonBaseMeshAlgo.hxx>
+#include <BRepMesh_CustomDelaunayBaseMeshAlgo.hxx>
+#include <BRepMesh_DelaunayDeflectionControlMeshAlgo.hxx>
+#include <BRepMesh_BoundaryParamsRangeSplitter.hxx>
+#include <BRepMesh_ExtrusionRangeSplitter.hxx>
+#include <BRepMesh_UndefinedRangeSplitter.hxx>
+
+namespace
+{
+  struct BaseMeshAlgo
+  {
+    typedef BRepMesh_LawsonBaseMeshAlgo Type;
+  };
+
+  template<class RangeSplitter>
+  struct NodeInsertionMeshAlgo
+  {
+    typedef BRepMesh_DelaunayNodeInsertionMeshAlgo<RangeSplitter, BRepMesh_CustomDelaunayBaseMeshAlgo<BRepMesh_LawsonBaseMeshAlgo> > Type;
+  };
+
+  template<class RangeSplitter>
+  struct DeflectionControlMeshAlgo
+  {
+    typedef BRepMesh_DelaunayDeflectionControlMeshAlgo<RangeSplitter, BRepMesh_CustomDelaunayBaseMeshAlgo<BRepMesh_LawsonBaseMeshAlgo> > Type;
+  };
+
+  //! Creates the algorithm including the nodes generated on the surface into the base triangulation.
+  template<class MeshAlgo>
+  Handle(IMeshTools_MeshAlgo) preProcessedAlgo()
+  {
+    MeshAlgo* aMeshAlgo = new MeshAlgo;
+    aMeshAlgo->SetPreProcessSurfaceNodes (Standard_True);
+    return aMeshAlgo;
+  }
+
+  //! Creates the algorithm for the surface with specific range splitter.
+  template<class RangeSplitter>
+  Handle(IMeshTools_MeshAlgo) surfaceAlgo (const IMeshTools_Parameters& theParameters)
+  {
+    return theParameters.EnableControlSurfaceDeflectionAllSurfaces ?
+      preProcessedAlgo<typename DeflectionControlMeshAlgo<RangeSplitter>::Type>() :
+      preProcessedAlgo<typename NodeInsertionMeshAlgo<RangeSplitter>::Type>();
+  }
+}
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_LawsonMeshAlgoFactory, IMeshTools_MeshAlgoFactory)
+
+//=======================================================================
+// Function: Constructor
+// Purpose :
+//=======================================================================
+BRepMesh_LawsonMeshAlgoFactory::BRepMesh_LawsonMeshAlgoFactory ()
+{
+}
+
+//=======================================================================
+// Function: Destructor
+// Purpose :
+//=======================================================================
+BRepMesh_LawsonMeshAlgoFactory::~BRepMesh_LawsonMeshAlgoFactory ()
+{
+}
+
+//=======================================================================
+// Function: GetAlgo
+// Purpose :
+//=======================================================================
+Handle(IMeshTools_MeshAlgo) BRepMesh_LawsonMeshAlgoFactory::GetAlgo(
+  const GeomAbs_SurfaceType    theSurfaceType,
+  const IMeshTools_Parameters& theParameters) const
+{
+  switch (theSurfaceType)
+  {
+  case GeomAbs_Plane:
+    if (!theParameters.EnableControlSurfaceDeflectionAllSurfaces
+     && !theParameters.InternalVerticesMode)
+    {
+      return new BaseMeshAlgo::Type;
+    }
+    return surfaceAlgo<BRepMesh_DefaultRangeSplitter> (theParameters);
+
+  case GeomAbs_Sphere:
+    return surfaceAlgo<BRepMesh_SphereRangeSplitter> (theParameters);
+
+  case GeomAbs_Cylinder:
+    if (!theParameters.EnableControlSurfaceDeflectionAllSurfaces
+     && !theParameters.InternalVerticesMode)
+    {
+      return new BaseMeshAlgo::Type;
+    }
+    return surfaceAlgo<BRepMesh_CylinderRangeSplitter> (theParameters);
+
+  case GeomAbs_Cone:
+    return surfaceAlgo<BRepMesh_ConeRangeSplitter> (theParameters);
+
+  case GeomAbs_Torus:
+    return surfaceAlgo<BRepMesh_TorusRangeSplitter> (theParameters);
+
+  case GeomAbs_SurfaceOfRevolution:
+    return preProcessedAlgo<DeflectionControlMeshAlgo<BRepMesh_BoundaryParamsRangeSplitter>::Type>();
+
+  case GeomAbs_SurfaceOfExtrusion:
+    return preProcessedAlgo<DeflectionControlMeshAlgo<BRepMesh_ExtrusionRangeSplitter>::Type>();
+
+  case GeomAbs_BezierSurface:
+  case GeomAbs_BSplineSurface:
+    return preProcessedAlgo<DeflectionControlMeshAlgo<BRepMesh_NURBSRangeSplitter>::Type>();
+
+  case GeomAbs_OffsetSurface:
+  case GeomAbs_OtherSurface:
+  default:
+    return preProcessedAlgo<DeflectionControlMeshAlgo<BRepMesh_UndefinedRangeSplitter>::Type>();
+  }
+}
@@ -0,0 +1,45 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_LawsonMeshAlgoFactory_HeaderFile
+#define _BRepMesh_LawsonMeshAlgoFactory_HeaderFile
+
+#include <Standard_Transient.hxx>
+#include <IMeshTools_MeshAlgoFactory.hxx>
+
+//! Implementation of IMeshTools_MeshAlgoFactory providing algorithms
+//! based on BRepMesh_LawsonBaseMeshAlgo of different complexity
+//! depending on type of target surface.
+//! The nodes generated on the surface are included into the base triangulation,
+//! so that the whole face is triangulated by incremental insertion with Lawson flips.
+//! If IMeshTools_Parameters::InParallelFace is set, the domain of large face
+//! is split into strips triangulated in parallel.
+class BRepMesh_LawsonMeshAlgoFactory : public IMeshTools_MeshAlgoFactory
+{
+public:
+
+  //! Constructor.
+  Standard_EXPORT BRepMesh_LawsonMeshAlgoFactory ();
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BRepMesh_LawsonMeshAlgoFactory ();
+
+  //! Creates instance of meshing algorithm for the given type of surface.
+  Standard_EXPORT virtual Handle(IMeshTools_MeshAlgo) GetAlgo(
+    const GeomAbs_SurfaceType    theSurfaceType,
+    const IMeshTools_Parameters& theParameters) const Standard_OVERRIDE;
+
+  DEFINE_STANDARD_RTTIEXT(BRepMesh_LawsonMeshAlgoFactory, IMeshTools_MeshAlgoFactory)
+};
+
+#endif
@@ -0,0 +1,820 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepMesh_StripTriangulator.hxx>
+
+#include <Bnd_B2d.hxx>
+#include <BRepMesh_DataStructureOfDelaun.hxx>
+#include <math_BullardGenerator.hxx>
+#include <math_RobustPredicates.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  //! Returns the index of the point with the given integer coordinates
+  //! along Hilbert curve filling the square of 2^16 x 2^16 cells.
+  inline unsigned int hilbertIndex (unsigned int theX, unsigned int theY)
+  {
+    const unsigned int aSize = 1u << 16;
+    unsigned int anIndex = 0;
+    for (unsigned int aStep = aSize / 2; aStep > 0; aStep /= 2)
+    {
+      const unsigned int aRX = (theX & aStep) != 0 ? 1 : 0;
+      const unsigned int aRY = (theY & aStep) != 0 ? 1 : 0;
+      anIndex += aStep * aStep * ((3 * aRX) ^ aRY);
+      if (aRY == 0)
+      {
+        if (aRX == 1)
+        {
+          theX = aSize - 1 - theX;
+          theY = aSize - 1 - theY;
+        }
+        std::swap (theX, theY);
+      }
+    }
+    return anIndex;
+  }
+
+  //! Minimal number of nodes in the strip of the domain triangulated in parallel.
+  static const Standard_Integer THE_MIN_STRIP_SIZE = 1024;
+
+  //! Maximal number of strips of the domain triangulated in parallel.
+  static const Standard_Integer THE_MAX_STRIPS_NB = 32;
+
+  //! Incremental Delaunay triangulator with Lawson flips.
+  //! The triangles are stored in flat arrays: half-edge 3 * T + K of the triangle T
+  //! starts at its vertex K, and its twin is the opposite half-edge of the adjacent triangle.
+  class LawsonTriangulator
+  {
+  public:
+
+    //! Minimal number of points in the round of insertion.
+    static const Standard_Integer THE_MIN_ROUND = 64;
+
+    //! Constructor.
+    //! @param[in] thePoints points to triangulate; the last four of them should be
+    //!                      the corners of the box containing all other points
+    //!                      in counterclockwise order
+    LawsonTriangulator (const std::vector<gp_XY>& thePoints)
+    : myInput (thePoints),
+      myLastTriangle (0)
+    {
+    }
+
+    //! Returns the number of triangles.
+    Standard_Integer NbTriangles() const { return static_cast<Standard_Integer> (myVertices.size() / 3); }
+
+    //! Returns the index of the input point at which the half-edge starts.
+    Standard_Integer Vertex (const Standard_Integer theHalfEdge) const { return myVertices[theHalfEdge]; }
+
+    //! Returns the twin of the half-edge or -1 for the outer edge.
+    Standard_Integer Twin (const Standard_Integer theHalfEdge) const { return myTwins[theHalfEdge]; }
+
+    //! Returns the next half-edge of the same triangle.
+    static Standard_Integer Next (const Standard_Integer theHalfEdge)
+    {
+      return theHalfEdge % 3 == 2 ? theHalfEdge - 2 : theHalfEdge + 1;
+    }
+
+    //! Returns the previous half-edge of the same triangle.
+    static Standard_Integer Prev (const Standard_Integer theHalfEdge)
+    {
+      return theHalfEdge % 3 == 0 ? theHalfEdge + 2 : theHalfEdge - 1;
+    }
+
+    //! Builds the triangulation.
+    //! The points coinciding with already inserted ones are skipped.
+    void Perform()
+    {
+      const Standard_Integer aNbPoints = static_cast<Standard_Integer> (myInput.size()) - 4;
+      std::vector<Standard_Integer> anOrder;
+      insertionOrder (aNbPoints, anOrder);
+
+      // the points are copied in the order of insertion to keep memory access local;
+      // the corners of the box go first
+      myPoints.reserve (myInput.size());
+      for (Standard_Integer aCornerIter = 0; aCornerIter < 4; ++aCornerIter)
+      {
+        myPoints.push_back (myInput[aNbPoints + aCornerIter]);
+      }
+      for (Standard_Integer aPntIter = 0; aPntIter < aNbPoints; ++aPntIter)
+      {
+        myPoints.push_back (myInput[anOrder[aPntIter]]);
+      }
+
+      myVertices.reserve (6 * myPoints.size());
+      myTwins   .reserve (6 * myPoints.size());
+      const Standard_Integer aTri1 = addTriangle (0, 1, 2);
+      const Standard_Integer aTri2 = addTriangle (0, 2, 3);
+      link (3 * aTri1 + 2, 3 * aTri2);
+      for (Standard_Integer aPntIter = 4; aPntIter < aNbPoints + 4; ++aPntIter)
+      {
+        insert (aPntIter);
+      }
+
+      // restore the indices of the input points
+      for (size_t aVertIter = 0; aVertIter < myVertices.size(); ++aVertIter)
+      {
+        Standard_Integer& aVertex = myVertices[aVertIter];
+        aVertex = aVertex < 4 ? aNbPoints + aVertex : anOrder[aVertex - 4];
+      }
+    }
+
+    //! Builds the triangulation splitting the box into vertical strips by the seams
+    //! separating nearly equal numbers of points. The strips are triangulated in parallel
+    //! independently of each other, then the triangulations are joined along the seams
+    //! and the Delaunay property is restored by the flips starting from the seam edges.
+    //! The ends of the seams lying on the sides of the box are added as auxiliary points
+    //! following the corners of the box, see SeamPoints().
+    //! @param[in] theNbStrips maximal number of strips
+    void Perform (const Standard_Integer theNbStrips)
+    {
+      const Standard_Integer aNbPoints = static_cast<Standard_Integer> (myInput.size()) - 4;
+      const gp_XY& aMin = myInput[aNbPoints];
+      const gp_XY& aMax = myInput[aNbPoints + 2];
+
+      // the seam is skipped if it cannot be placed strictly between the points
+      // of the neighboring strips, so that no point lies on the seam
+      std::vector<Standard_Integer> anIndices (aNbPoints);
+      for (Standard_Integer aPntIter = 0; aPntIter < aNbPoints; ++aPntIter)
+      {
+        anIndices[aPntIter] = aPntIter;
+      }
+
+      const LessX aLessX (myInput);
+      std::vector<Standard_Integer> aStripEnds;
+      std::vector<Standard_Real> aBounds (1, aMin.X());
+      Standard_Integer aStripStart = 0;
+      for (Standard_Integer aSeamIter = 1; aSeamIter < theNbStrips; ++aSeamIter)
+      {
+        const Standard_Integer aPos = static_cast<Standard_Integer> ((Standard_Size )aNbPoints * aSeamIter / theNbStrips);
+        if (aPos <= aStripStart)
+        {
+          continue;
+        }
+
+        // the points with equal X coordinates (e.g. columns of the grid) are kept in the same strip
+        const std::vector<Standard_Integer>::iterator aStart = anIndices.begin() + aStripStart;
+        std::nth_element (aStart, anIndices.begin() + aPos, anIndices.end(), aLessX);
+        Standard_Real aRight = myInput[anIndices[aPos]].X();
+        std::vector<Standard_Integer>::iterator aSplit =
+          std::partition (aStart, anIndices.end(), LessX (myInput, aRight, Standard_False));
+        if (aSplit == aStart)
+        {
+          aSplit = std::partition (aStart, anIndices.end(), LessX (myInput, aRight, Standard_True));
+          if (aSplit == anIndices.end())
+          {
+            break;
+          }
+          aRight = myInput[*std::min_element (aSplit, anIndices.end(), aLessX)].X();
+        }
+
+        const Standard_Real aLeft = myInput[*std::max_element (aStart, aSplit, aLessX)].X();
+        const Standard_Real aSeam = 0.5 * (aLeft + aRight);
+        if (aLeft < aSeam && aSeam < aRight)
+        {
+          aStripStart = static_cast<Standard_Integer> (aSplit - anIndices.begin());
+          aStripEnds.push_back (aStripStart);
+          aBounds.push_back (aSeam);
+        }
+      }
+      aStripEnds.push_back (aNbPoints);
+      aBounds.push_back (aMax.X());
+
+      const Standard_Integer aNbStrips = static_cast<Standard_Integer> (aStripEnds.size());
+      if (aNbStrips < 2)
+      {
+        Perform();
+        return;
+      }
+
+      // indices of the points at the bottom and top ends of the bounds of the strips
+      std::vector<Standard_Integer> aBottoms (aNbStrips + 1), aTops (aNbStrips + 1);
+      aBottoms[0] = aNbPoints;
+      aTops   [0] = aNbPoints + 3;
+      for (Standard_Integer aSeamIter = 1; aSeamIter < aNbStrips; ++aSeamIter)
+      {
+        aBottoms[aSeamIter] = static_cast<Standard_Integer> (myInput.size() + mySeamPoints.size());
+        mySeamPoints.push_back (gp_XY (aBounds[aSeamIter], aMin.Y()));
+        aTops[aSeamIter] = aBottoms[aSeamIter] + 1;
+        mySeamPoints.push_back (gp_XY (aBounds[aSeamIter], aMax.Y()));
+      }
+      aBottoms[aNbStrips] = aNbPoints + 1;
+      aTops   [aNbStrips] = aNbPoints + 2;
+
+      std::vector<Strip> aStrips (aNbStrips);
+      for (Standard_Integer aStripIter = 0; aStripIter < aNbStrips; ++aStripIter)
+      {
+        Strip& aStrip = aStrips[aStripIter];
+        aStrip.First   = aStripIter == 0 ? 0 : aStripEnds[aStripIter - 1];
+        aStrip.Last    = aStripEnds[aStripIter];
+        aStrip.Corners[0] = aBottoms[aStripIter];
+        aStrip.Corners[1] = aBottoms[aStripIter + 1];
+        aStrip.Corners[2] = aTops   [aStripIter + 1];
+        aStrip.Corners[3] = aTops   [aStripIter];
+      }
+
+      myPoints.reserve (myInput.size() + mySeamPoints.size());
+      myPoints.assign (myInput.begin(), myInput.end());
+      myPoints.insert (myPoints.end(), mySeamPoints.begin(), mySeamPoints.end());
+
+      const StripFunctor aStripFunctor (myPoints, anIndices, aStrips);
+      OSD_Parallel::For (0, aNbStrips, aStripFunctor);
+
+      // join the triangulations of the strips
+      size_t aNbHalfEdges = 0;
+      for (Standard_Integer aStripIter = 0; aStripIter < aNbStrips; ++aStripIter)
+      {
+        aNbHalfEdges += aStrips[aStripIter].Vertices.size();
+      }
+      myVertices.reserve (aNbHalfEdges);
+      myTwins   .reserve (aNbHalfEdges);
+
+      std::vector<Standard_Integer> anOffsets (aNbStrips + 1, 0);
+      for (Standard_Integer aStripIter = 0; aStripIter < aNbStrips; ++aStripIter)
+      {
+        Strip& aStrip = aStrips[aStripIter];
+        const Standard_Integer anOffset = static_cast<Standard_Integer> (myVertices.size());
+        anOffsets[aStripIter] = anOffset;
+        myVertices.insert (myVertices.end(), aStrip.Vertices.begin(), aStrip.Vertices.end());
+        for (size_t anEdgeIter = 0; anEdgeIter < aStrip.Twins.size(); ++anEdgeIter)
+        {
+          const Standard_Integer aTwin = aStrip.Twins[anEdgeIter];
+          myTwins.push_back (aTwin < 0 ? -1 : aTwin + anOffset);
+        }
+        std::vector<Standard_Integer>().swap (aStrip.Vertices);
+        std::vector<Standard_Integer>().swap (aStrip.Twins);
+      }
+      anOffsets[aNbStrips] = static_cast<Standard_Integer> (myVertices.size());
+
+      // the seams are the single edges on the boundaries of the strips,
+      // as no point lies on them
+      for (Standard_Integer aSeamIter = 1; aSeamIter < aNbStrips; ++aSeamIter)
+      {
+        const Standard_Integer aLeft  = findBoundaryEdge (anOffsets[aSeamIter - 1], anOffsets[aSeamIter],
+                                                          aBottoms[aSeamIter], aTops[aSeamIter]);
+        const Standard_Integer aRight = findBoundaryEdge (anOffsets[aSeamIter], anOffsets[aSeamIter + 1],
+                                                          aTops[aSeamIter], aBottoms[aSeamIter]);
+        if (aLeft >= 0 && aRight >= 0)
+        {
+          link (aLeft, aRight);
+          myStack.push_back (aLeft);
+        }
+      }
+      flipEdges();
+    }
+
+    //! Returns the auxiliary points at the ends of the seams between the strips.
+    //! Their indices follow the ones of the input points.
+    const std::vector<gp_XY>& SeamPoints() const { return mySeamPoints; }
+
+  private:
+
+    //! Compares the input points by X coordinate with each other or with the given value.
+    struct LessX
+    {
+      LessX (const std::vector<gp_XY>& thePoints)
+      : myPoints (&thePoints), myValue (0.0), myIsEqual (Standard_False) {}
+
+      LessX (const std::vector<gp_XY>& thePoints, const Standard_Real theValue, const Standard_Boolean theIsEqual)
+      : myPoints (&thePoints), myValue (theValue), myIsEqual (theIsEqual) {}
+
+      bool operator() (const Standard_Integer theIndex1, const Standard_Integer theIndex2) const
+      {
+        return (*myPoints)[theIndex1].X() < (*myPoints)[theIndex2].X();
+      }
+
+      bool operator() (const Standard_Integer theIndex) const
+      {
+        const Standard_Real aX = (*myPoints)[theIndex].X();
+        return aX < myValue || (myIsEqual && aX == myValue);
+      }
+
+      const std::vector<gp_XY>* myPoints;
+      Standard_Real             myValue;
+      Standard_Boolean          myIsEqual;
+    };
+
+    //! Strip of the box triangulated independently.
+    struct Strip
+    {
+      Standard_Integer              First;      //!< first position of the points of the strip in sorted indices
+      Standard_Integer              Last;       //!< position following the last point of the strip
+      Standard_Integer              Corners[4]; //!< corners of the strip in counterclockwise order
+      std::vector<Standard_Integer> Vertices;   //!< vertices of the half-edges of the triangulation
+      std::vector<Standard_Integer> Twins;      //!< twins of the half-edges local to the strip
+    };
+
+    //! Functor triangulating the strips.
+    class StripFunctor
+    {
+    public:
+
+      StripFunctor (const std::vector<gp_XY>&            thePoints,
+                    const std::vector<Standard_Integer>& theIndices,
+                    std::vector<Strip>&                  theStrips)
+      : myPoints  (thePoints),
+        myIndices (theIndices),
+        myStrips  (theStrips)
+      {
+      }
+
+      void operator() (const Standard_Integer theStripIndex) const
+      {
+        Strip& aStrip = myStrips[theStripIndex];
+        const Standard_Integer aNbPoints = aStrip.Last - aStrip.First;
+        std::vector<gp_XY> aPoints;
+        aPoints.reserve (aNbPoints + 4);
+        for (Standard_Integer aPntIter = aStrip.First; aPntIter < aStrip.Last; ++aPntIter)
+        {
+          aPoints.push_back (myPoints[myIndices[aPntIter]]);
+        }
+        for (Standard_Integer aCornerIter = 0; aCornerIter < 4; ++aCornerIter)
+        {
+          aPoints.push_back (myPoints[aStrip.Corners[aCornerIter]]);
+        }
+
+        LawsonTriangulator aTriangulator (aPoints);
+        aTriangulator.Perform();
+
+        const Standard_Integer aNbHalfEdges = 3 * aTriangulator.NbTriangles();
+        aStrip.Vertices.resize (aNbHalfEdges);
+        aStrip.Twins   .resize (aNbHalfEdges);
+        for (Standard_Integer aHalfEdge = 0; aHalfEdge < aNbHalfEdges; ++aHalfEdge)
+        {
+          const Standard_Integer aVertex = aTriangulator.Vertex (aHalfEdge);
+          aStrip.Vertices[aHalfEdge] = aVertex < aNbPoints ? myIndices[aStrip.First + aVertex]
+                                                           : aStrip.Corners[aVertex - aNbPoints];
+          aStrip.Twins[aHalfEdge] = aTriangulator.Twin (aHalfEdge);
+        }
+      }
+
+    private:
+
+      void operator= (const StripFunctor& theOther);
+
+    private:
+      const std::vector<gp_XY>&            myPoints;
+      const std::vector<Standard_Integer>& myIndices;
+      std::vector<Strip>&                  myStrips;
+    };
+
+    //! Returns the half-edge without twin going from the first vertex to the second one
+    //! among the given range of half-edges, or -1 if it is not found.
+    Standard_Integer findBoundaryEdge (const Standard_Integer theFirst,
+                                       const Standard_Integer theLast,
+                                       const Standard_Integer theVertex1,
+                                       const Standard_Integer theVertex2) const
+    {
+      for (Standard_Integer aHalfEdge = theFirst; aHalfEdge < theLast; ++aHalfEdge)
+      {
+        if (myTwins[aHalfEdge] < 0
+         && myVertices[aHalfEdge] == theVertex1
+         && myVertices[Next (aHalfEdge)] == theVertex2)
+        {
+          return aHalfEdge;
+        }
+      }
+      return -1;
+    }
+
+    //! Defines the order of insertion of the input points: the rounds of increasing size
+    //! (halves of the remaining points) are selected randomly,
+    //! and the points of each round are sorted along Hilbert curve.
+    void insertionOrder (const Standard_Integer theNbPoints,
+                         std::vector<Standard_Integer>& theOrder) const
+    {
+      theOrder.resize (theNbPoints);
+      if (theNbPoints == 0)
+      {
+        return;
+      }
+
+      Bnd_B2d aBox;
+      for (Standard_Integer aPntIter = 0; aPntIter < theNbPoints; ++aPntIter)
+      {
+        aBox.Add (myInput[aPntIter]);
+      }
+
+      const gp_XY aMin = aBox.CornerMin();
+      const gp_XY aSize = aBox.CornerMax() - aMin;
+      const Standard_Real aScaleX = aSize.X() > 0.0 ? 65535.0 / aSize.X() : 0.0;
+      const Standard_Real aScaleY = aSize.Y() > 0.0 ? 65535.0 / aSize.Y() : 0.0;
+      std::vector< std::pair<unsigned int, Standard_Integer> > aKeys (theNbPoints);
+      for (Standard_Integer aPntIter = 0; aPntIter < theNbPoints; ++aPntIter)
+      {
+        const gp_XY& aPnt = myInput[aPntIter];
+        aKeys[aPntIter].first = hilbertIndex (static_cast<unsigned int> ((aPnt.X() - aMin.X()) * aScaleX),
+                                              static_cast<unsigned int> ((aPnt.Y() - aMin.Y()) * aScaleY));
+        aKeys[aPntIter].second = aPntIter;
+      }
+
+      math_BullardGenerator aRandom;
+      for (Standard_Integer aPntIter = theNbPoints - 1; aPntIter > 0; --aPntIter)
+      {
+        std::swap (aKeys[aPntIter], aKeys[aRandom.NextInt() % (aPntIter + 1)]);
+      }
+
+      for (Standard_Integer aRoundEnd = theNbPoints; aRoundEnd > 0;)
+      {
+        const Standard_Integer aRoundStart = aRoundEnd > THE_MIN_ROUND ? aRoundEnd / 2 : 0;
+        std::sort (aKeys.begin() + aRoundStart, aKeys.begin() + aRoundEnd);
+        aRoundEnd = aRoundStart;
+      }
+
+      for (Standard_Integer aPntIter = 0; aPntIter < theNbPoints; ++aPntIter)
+      {
+        theOrder[aPntIter] = aKeys[aPntIter].second;
+      }
+    }
+
+    //! Adds new triangle and returns its index.
+    Standard_Integer addTriangle (const Standard_Integer theV1,
+                                  const Standard_Integer theV2,
+                                  const Standard_Integer theV3)
+    {
+      myVertices.push_back (theV1);
+      myVertices.push_back (theV2);
+      myVertices.push_back (theV3);
+      myTwins.push_back (-1);
+      myTwins.push_back (-1);
+      myTwins.push_back (-1);
+      return NbTriangles() - 1;
+    }
+
+    //! Changes the vertices of the triangle.
+    void setTriangle (const Standard_Integer theTri,
+                      const Standard_Integer theV1,
+                      const Standard_Integer theV2,
+                      const Standard_Integer theV3)
+    {
+      myVertices[3 * theTri]     = theV1;
+      myVertices[3 * theTri + 1] = theV2;
+      myVertices[3 * theTri + 2] = theV3;
+    }
+
+    //! Makes the half-edges twins of each other.
+    void link (const Standard_Integer theHalfEdge1, const Standard_Integer theHalfEdge2)
+    {
+      myTwins[theHalfEdge1] = theHalfEdge2;
+      if (theHalfEdge2 >= 0)
+      {
+        myTwins[theHalfEdge2] = theHalfEdge1;
+      }
+    }
+
+    //! Returns the orientation of the point relative to the half-edge.
+    double orientation (const Standard_Integer theHalfEdge, const gp_XY& thePnt) const
+    {
+      return math_RobustPredicates::Orient2d (myPoints[myVertices[theHalfEdge]],
+                                              myPoints[myVertices[Next (theHalfEdge)]], thePnt);
+    }
+
+    //! Returns the triangle containing the point or -1 if it is not found.
+    //! Walks from the last created triangle towards the point,
+    //! with the full search as fallback.
+    Standard_Integer locate (const gp_XY& thePnt) const
+    {
+      Standard_Integer aTri = myLastTriangle;
+      const Standard_Integer aMaxNbSteps = NbTriangles() + 1;
+      for (Standard_Integer aStep = 0; aStep < aMaxNbSteps; ++aStep)
+      {
+        Standard_Boolean isInside = Standard_True;
+        for (Standard_Integer anEdgeIter = 0; anEdgeIter < 3; ++anEdgeIter)
+        {
+          // rotation of the first edge to check prevents cycles of the walk
+          const Standard_Integer aHalfEdge = 3 * aTri + (anEdgeIter + aStep) % 3;
+          if (orientation (aHalfEdge, thePnt) < 0.0)
+          {
+            const Standard_Integer aTwin = myTwins[aHalfEdge];
+            if (aTwin < 0)
+            {
+              return -1;
+            }
+
+            aTri = aTwin / 3;
+            isInside = Standard_False;
+            break;
+          }
+        }
+        if (isInside)
+        {
+          return aTri;
+        }
+      }
+
+      for (aTri = 0; aTri < NbTriangles(); ++aTri)
+      {
+        if (orientation (3 * aTri,     thePnt) >= 0.0
+         && orientation (3 * aTri + 1, thePnt) >= 0.0
+         && orientation (3 * aTri + 2, thePnt) >= 0.0)
+        {
+          return aTri;
+        }
+      }
+      return -1;
+    }
+
+    //! Inserts the point into the triangulation.
+    void insert (const Standard_Integer thePnt)
+    {
+      const Standard_Integer aTri = locate (myPoints[thePnt]);
+      if (aTri < 0)
+      {
+        return;
+      }
+
+      Standard_Integer aNbOnEdge = 0, anEdge = -1;
+      for (Standard_Integer anEdgeIter = 0; anEdgeIter < 3; ++anEdgeIter)
+      {
+        if (orientation (3 * aTri + anEdgeIter, myPoints[thePnt]) == 0.0)
+        {
+          ++aNbOnEdge;
+          anEdge = 3 * aTri + anEdgeIter;
+        }
+      }
+
+      if (aNbOnEdge == 0)
+      {
+        splitTriangle (aTri, thePnt);
+      }
+      else if (aNbOnEdge == 1 && myTwins[anEdge] >= 0)
+      {
+        splitEdge (anEdge, thePnt);
+      }
+      else
+      {
+        // coincides with existing vertex
+        return;
+      }
+      legalize();
+    }
+
+    //! Splits the triangle into three by the point inside it.
+    void splitTriangle (const Standard_Integer theTri, const Standard_Integer thePnt)
+    {
+      const Standard_Integer aV1 = myVertices[3 * theTri];
+      const Standard_Integer aV2 = myVertices[3 * theTri + 1];
+      const Standard_Integer aV3 = myVertices[3 * theTri + 2];
+      const Standard_Integer aTwin1 = myTwins[3 * theTri];
+      const Standard_Integer aTwin2 = myTwins[3 * theTri + 1];
+      const Standard_Integer aTwin3 = myTwins[3 * theTri + 2];
+
+      setTriangle (theTri, aV1, aV2, thePnt);
+      const Standard_Integer aTri2 = addTriangle (aV2, aV3, thePnt);
+      const Standard_Integer aTri3 = addTriangle (aV3, aV1, thePnt);
+      link (3 * theTri, aTwin1);
+      link (3 * aTri2,  aTwin2);
+      link (3 * aTri3,  aTwin3);
+      link (3 * theTri + 1, 3 * aTri2 + 2);
+      link (3 * aTri2  + 1, 3 * aTri3 + 2);
+      link (3 * aTri3  + 1, 3 * theTri + 2);
+
+      myStack.push_back (3 * theTri);
+      myStack.push_back (3 * aTri2);
+      myStack.push_back (3 * aTri3);
+      myLastTriangle = theTri;
+    }
+
+    //! Splits two triangles sharing the half-edge into four by the point on this edge.
+    void splitEdge (const Standard_Integer theHalfEdge, const Standard_Integer thePnt)
+    {
+      const Standard_Integer aTwin = myTwins[theHalfEdge];
+      const Standard_Integer aTri1 = theHalfEdge / 3;
+      const Standard_Integer aTri3 = aTwin / 3;
+
+      const Standard_Integer aVA = myVertices[theHalfEdge];
+      const Standard_Integer aVB = myVertices[Next (theHalfEdge)];
+      const Standard_Integer aVC = myVertices[Prev (theHalfEdge)];
+      const Standard_Integer aVD = myVertices[Prev (aTwin)];
+      const Standard_Integer aTwinBC = myTwins[Next (theHalfEdge)];
+      const Standard_Integer aTwinCA = myTwins[Prev (theHalfEdge)];
+      const Standard_Integer aTwinAD = myTwins[Next (aTwin)];
+      const Standard_Integer aTwinDB = myTwins[Prev (aTwin)];
+
+      setTriangle (aTri1, aVB, aVC, thePnt);
+      const Standard_Integer aTri2 = addTriangle (aVC, aVA, thePnt);
+      setTriangle (aTri3, aVA, aVD, thePnt);
+      const Standard_Integer aTri4 = addTriangle (aVD, aVB, thePnt);
+      link (3 * aTri1, aTwinBC);
+      link (3 * aTri2, aTwinCA);
+      link (3 * aTri3, aTwinAD);
+      link (3 * aTri4, aTwinDB);
+      link (3 * aTri1 + 1, 3 * aTri2 + 2);
+      link (3 * aTri2 + 1, 3 * aTri3 + 2);
+      link (3 * aTri3 + 1, 3 * aTri4 + 2);
+      link (3 * aTri4 + 1, 3 * aTri1 + 2);
+
+      myStack.push_back (3 * aTri1);
+      myStack.push_back (3 * aTri2);
+      myStack.push_back (3 * aTri3);
+      myStack.push_back (3 * aTri4);
+      myLastTriangle = aTri1;
+    }
+
+    //! Restores Delaunay property by flipping the edges opposite to the inserted point.
+    //! Each half-edge in the stack is the first one of its triangle, the last vertex being the inserted point.
+    void legalize()
+    {
+      while (!myStack.empty())
+      {
+        const Standard_Integer aHalfEdge = myStack.back();
+        myStack.pop_back();
+
+        const Standard_Integer aTwin = myTwins[aHalfEdge];
+        if (aTwin < 0)
+        {
+          continue;
+        }
+
+        const Standard_Integer aVA = myVertices[aHalfEdge];
+        const Standard_Integer aVB = myVertices[aHalfEdge + 1];
+        const Standard_Integer aVP = myVertices[aHalfEdge + 2];
+        const Standard_Integer aVD = myVertices[Prev (aTwin)];
+        if (math_RobustPredicates::InCircle (myPoints[aVA], myPoints[aVB], myPoints[aVP], myPoints[aVD]) <= 0.0)
+        {
+          continue;
+        }
+
+        const Standard_Integer aTri1 = aHalfEdge / 3;
+        const Standard_Integer aTri2 = aTwin / 3;
+        const Standard_Integer aTwinBP = myTwins[aHalfEdge + 1];
+        const Standard_Integer aTwinPA = myTwins[aHalfEdge + 2];
+        const Standard_Integer aTwinAD = myTwins[Next (aTwin)];
+        const Standard_Integer aTwinDB = myTwins[Prev (aTwin)];
+
+        setTriangle (aTri1, aVA, aVD, aVP);
+        setTriangle (aTri2, aVD, aVB, aVP);
+        link (3 * aTri1,     aTwinAD);
+        link (3 * aTri1 + 2, aTwinPA);
+        link (3 * aTri2,     aTwinDB);
+        link (3 * aTri2 + 1, aTwinBP);
+        link (3 * aTri1 + 1, 3 * aTri2 + 2);
+
+        myStack.push_back (3 * aTri1);
+        myStack.push_back (3 * aTri2);
+      }
+    }
+
+    //! Restores Delaunay property by flipping the edges starting from the ones in the stack.
+    //! In contrast to legalize(), the half-edges in the stack may be arbitrary,
+    //! and all four outer edges of each flipped pair of triangles are checked further.
+    void flipEdges()
+    {
+      while (!myStack.empty())
+      {
+        const Standard_Integer aHalfEdge = myStack.back();
+        myStack.pop_back();
+
+        const Standard_Integer aTwin = myTwins[aHalfEdge];
+        if (aTwin < 0)
+        {
+          continue;
+        }
+
+        const Standard_Integer aVA = myVertices[aHalfEdge];
+        const Standard_Integer aVB = myVertices[Next (aHalfEdge)];
+        const Standard_Integer aVC = myVertices[Prev (aHalfEdge)];
+        const Standard_Integer aVD = myVertices[Prev (aTwin)];
+        if (math_RobustPredicates::InCircle (myPoints[aVA], myPoints[aVB], myPoints[aVC], myPoints[aVD]) <= 0.0)
+        {
+          continue;
+        }
+
+        const Standard_Integer aTri1 = aHalfEdge / 3;
+        const Standard_Integer aTri2 = aTwin / 3;
+        const Standard_Integer aTwinBC = myTwins[Next (aHalfEdge)];
+        const Standard_Integer aTwinCA = myTwins[Prev (aHalfEdge)];
+        const Standard_Integer aTwinAD = myTwins[Next (aTwin)];
+        const Standard_Integer aTwinDB = myTwins[Prev (aTwin)];
+
+        setTriangle (aTri1, aVA, aVD, aVC);
+        setTriangle (aTri2, aVD, aVB, aVC);
+        link (3 * aTri1,     aTwinAD);
+        link (3 * aTri1 + 2, aTwinCA);
+        link (3 * aTri2,     aTwinDB);
+        link (3 * aTri2 + 1, aTwinBC);
+        link (3 * aTri1 + 1, 3 * aTri2 + 2);
+
+        myStack.push_back (3 * aTri1);
+        myStack.push_back (3 * aTri1 + 2);
+        myStack.push_back (3 * aTri2);
+        myStack.push_back (3 * aTri2 + 1);
+      }
+    }
+
+  private:
+
+    const std::vector<gp_XY>&     myInput;
+    std::vector<gp_XY>            mySeamPoints;
+    std::vector<gp_XY>            myPoints;
+    std::vector<Standard_Integer> myVertices;
+    std::vector<Standard_Integer> myTwins;
+    std::vector<Standard_Integer> myStack;
+    Standard_Integer              myLastTriangle;
+  };
+}
+//=======================================================================
+//function : StripsNb
+//purpose  :
+//=======================================================================
+Standard_Integer BRepMesh_StripTriangulator::StripsNb (const Standard_Integer theNodesNb)
+{
+  return Max (1, Min (theNodesNb / THE_MIN_STRIP_SIZE, THE_MAX_STRIPS_NB));
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BRepMesh_StripTriangulator::Perform (const Handle(BRepMesh_DataStructureOfDelaun)& theStructure,
+                                          const Standard_Integer theStripsNb)
+{
+  const Handle(BRepMesh_DataStructureOfDelaun)& aStructure = theStructure;
+
+  Bnd_B2d aBox;
+  const Standard_Integer aNodesNb = aStructure->NbNodes ();
+  std::vector<gp_XY> aPoints;
+  aPoints.reserve (aNodesNb + 4);
+  for (Standard_Integer aNodeIt = 1; aNodeIt <= aNodesNb; ++aNodeIt)
+  {
+    const gp_XY& aCoord = aStructure->GetNode (aNodeIt).Coord();
+    aPoints.push_back (aCoord);
+    aBox.Add (aCoord);
+  }
+
+  // corners of the enlarged box are added as auxiliary nodes to be removed after processing of constraints
+  aBox.Enlarge (0.1 * (aBox.CornerMax () - aBox.CornerMin ()).Modulus ());
+  const gp_XY aMin = aBox.CornerMin ();
+  const gp_XY aMax = aBox.CornerMax ();
+  aPoints.push_back (aMin);
+  aPoints.push_back (gp_XY (aMax.X(), aMin.Y()));
+  aPoints.push_back (aMax);
+  aPoints.push_back (gp_XY (aMin.X(), aMax.Y()));
+  for (Standard_Integer aCornerIt = aNodesNb; aCornerIt < aNodesNb + 4; ++aCornerIt)
+  {
+    aStructure->AddNode (BRepMesh_Vertex (aPoints[aCornerIt].X(), aPoints[aCornerIt].Y(), BRepMesh_Free));
+  }
+
+  // the domain of large face is split into strips triangulated in parallel
+  LawsonTriangulator aTriangulator (aPoints);
+  aTriangulator.Perform (theStripsNb);
+
+  // ends of the seams between the strips are auxiliary nodes as well
+  const std::vector<gp_XY>& aSeamPoints = aTriangulator.SeamPoints();
+  for (size_t aSeamPntIt = 0; aSeamPntIt < aSeamPoints.size(); ++aSeamPntIt)
+  {
+    aStructure->AddNode (BRepMesh_Vertex (aSeamPoints[aSeamPntIt].X(), aSeamPoints[aSeamPntIt].Y(), BRepMesh_Free));
+  }
+
+  // each link is added to the data structure once for both half-edges
+  const Standard_Integer aNbHalfEdges = 3 * aTriangulator.NbTriangles();
+  std::vector<Standard_Integer> aLinks (aNbHalfEdges, 0);
+  for (Standard_Integer aHalfEdge = 0; aHalfEdge < aNbHalfEdges; ++aHalfEdge)
+  {
+    if (aLinks[aHalfEdge] != 0)
+    {
+      continue;
+    }
+
+    const BRepMesh_Edge aLink (aTriangulator.Vertex (aHalfEdge) + 1,
+                               aTriangulator.Vertex (LawsonTriangulator::Next (aHalfEdge)) + 1,
+                               BRepMesh_Free);
+    aLinks[aHalfEdge] = aStructure->AddLink (aLink);
+
+    const Standard_Integer aTwin = aTriangulator.Twin (aHalfEdge);
+    if (aTwin >= 0)
+    {
+      aLinks[aTwin] = -aLinks[aHalfEdge];
+    }
+  }
+
+  for (Standard_Integer aTriIt = 0; aTriIt < aTriangulator.NbTriangles(); ++aTriIt)
+  {
+    Standard_Integer aEdges       [3];
+    Standard_Boolean aOrientations[3];
+    for (Standard_Integer k = 0; k < 3; ++k)
+    {
+      const Standard_Integer aLinkInfo = aLinks[3 * aTriIt + k];
+      aEdges       [k] = Abs (aLinkInfo);
+      aOrientations[k] = aLinkInfo > 0;
+    }
+
+    const BRepMesh_Triangle aTriangle (aEdges, aOrientations, BRepMesh_Free);
+    aStructure->AddElement (aTriangle);
+  }
+}
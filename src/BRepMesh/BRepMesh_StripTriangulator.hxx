@@ -0,0 +1,55 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_StripTriangulator_HeaderFile
+#define _BRepMesh_StripTriangulator_HeaderFile
+
+#include <BRepMesh_DataStructureOfDelaun.hxx>
+
+//! Auxiliary tool building base Delaunay triangulation of the nodes of the data structure
+//! using incremental insertion with Lawson edge flips.
+//!
+//! The nodes are inserted in biased randomized order (BRIO) with the rounds sorted
+//! along Hilbert curve, so that the point location by walking from the last created
+//! triangle takes nearly constant time. The orientation and in-circle tests are evaluated
+//! exactly (see math_RobustPredicates), so that the result does not depend on round-off errors.
+//!
+//! The domain of large face can be split into vertical strips triangulated in parallel;
+//! the triangulations are joined along the seams and the Delaunay property is restored
+//! by the flips of the edges around the seams. The ends of the seams are added as auxiliary nodes,
+//! thus the triangulation built by strips may differ from the one built at once, though it is
+//! deterministic: the number of strips depends only on the number of nodes (see StripsNb()),
+//! and the random generator is seeded by a constant.
+//!
+//! The tool is shared by BRepMesh_LawsonBaseMeshAlgo and BRepMesh_DelaunayBaseMeshAlgo.
+class BRepMesh_StripTriangulator
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Returns the number of strips the domain with the given number of nodes
+  //! should be split into for parallel triangulation (1 if the domain is too small).
+  //! The number does not depend on the number of processors, so that the result is reproducible.
+  Standard_EXPORT static Standard_Integer StripsNb (const Standard_Integer theNodesNb);
+
+  //! Builds Delaunay triangulation of the nodes of the data structure
+  //! within the enlarged bounding box, which corners are added to the structure as auxiliary nodes
+  //! followed by the ends of the seams between the strips (if any).
+  //! @param[in] theStructure data structure to fill in
+  //! @param[in] theStripsNb  number of strips triangulated in parallel
+  Standard_EXPORT static void Perform (const Handle(BRepMesh_DataStructureOfDelaun)& theStructure,
+                                       const Standard_Integer theStripsNb);
+};
+
+#endif
@@ -0,0 +1,570 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_StructuredMeshAlgo_HeaderFile
+#define _BRepMesh_StructuredMeshAlgo_HeaderFile
+
+#include <BRepMesh_BaseMeshAlgo.hxx>
+#include <BRepMesh_DataStructureOfDelaun.hxx>
+#include <BRepMesh_NodeInsertionMeshAlgo.hxx>
+#include <IMeshTools_MeshAlgoFactory.hxx>
+#include <NCollection_Array2.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+
+#include <algorithm>
+
+//! Builds structured triangulation of the faces with rectangular parametric
+//! domain, i.e. the faces bounded by iso-lines of the surface only
+//! (full or iso-trimmed analytic surfaces, untrimmed B-spline patches, etc.).
+//!
+//! The interior of the face is covered by the regular grid formed by the
+//! iso-lines passing through the surface nodes generated by the range splitter,
+//! each cell of the grid is split into two triangles along the shorter diagonal.
+//! The strips between the boundary of the face and the outer rows and columns
+//! of the grid are filled by zipping the discretization of the corresponding
+//! side of the boundary with the nodes of the row (column), so the mesh is
+//! conformal with the discretization of the edges shared with other faces.
+//! No Delaunay triangulation is performed at all.
+//!
+//! The faces with other domains (trimmed faces, faces with holes or internal
+//! vertices) are meshed by the algorithm of the fallback factory.
+//! The same is done for the Bezier and B-spline faces, which grid built from
+//! the nodes of the range splitter exceeds the deflection of the face, as the grid
+//! is not refined.
+template<class RangeSplitter>
+class BRepMesh_StructuredMeshAlgo : public BRepMesh_NodeInsertionMeshAlgo<RangeSplitter, BRepMesh_BaseMeshAlgo>
+{
+private:
+  // Typedef for OCCT RTTI
+  typedef BRepMesh_NodeInsertionMeshAlgo<RangeSplitter, BRepMesh_BaseMeshAlgo> InsertionBaseClass;
+
+public:
+
+  //! Constructor.
+  //! @param theFallbackFactory factory of the algorithms to be used for the faces
+  //!                           which cannot be meshed by structured grid.
+  BRepMesh_StructuredMeshAlgo (const Handle(IMeshTools_MeshAlgoFactory)& theFallbackFactory)
+  : myFallbackFactory (theFallbackFactory),
+    myToFallback (Standard_False)
+  {
+  }
+
+  //! Destructor.
+  virtual ~BRepMesh_StructuredMeshAlgo()
+  {
+  }
+
+  //! Performs processing of the given face.
+  virtual void Perform(
+    const IMeshData::IFaceHandle& theDFace,
+    const IMeshTools_Parameters&  theParameters,
+    const Message_ProgressRange&  theRange) Standard_OVERRIDE
+  {
+    if (initDomain (theDFace))
+    {
+      // failure status set by empty grid rejected by deflection is not a failure of the face
+      const Standard_Boolean isFailed = theDFace->IsSet (IMeshData_Failure);
+      myToFallback = Standard_False;
+      InsertionBaseClass::Perform (theDFace, theParameters, theRange);
+      if (!myToFallback)
+      {
+        return;
+      }
+      if (!isFailed)
+      {
+        theDFace->UnsetStatus (IMeshData_Failure);
+      }
+    }
+
+    if (!myFallbackFactory.IsNull())
+    {
+      Handle(IMeshTools_MeshAlgo) aFallbackAlgo =
+        myFallbackFactory->GetAlgo (theDFace->GetSurface()->GetType(), theParameters);
+      if (!aFallbackAlgo.IsNull())
+      {
+        aFallbackAlgo->Perform (theDFace, theParameters, theRange);
+      }
+    }
+  }
+
+protected:
+
+  //! Generates structured mesh of the rectangular domain.
+  virtual void generateMesh (const Message_ProgressRange& /*theRange*/) Standard_OVERRIDE
+  {
+    // collect the nodes of the sides of the boundary (the corners belong to two sides)
+    NCollection_Vector<ChainNode> aSides[4];
+    const Handle(BRepMesh_DataStructureOfDelaun)& aStructure = this->getStructure();
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aStructure->NbNodes(); ++aNodeIt)
+    {
+      const gp_Pnt2d aUV = this->getNodePoint2d (aStructure->GetNode (aNodeIt));
+      const Standard_Integer aSideMask = sideMask (aUV);
+      for (Standard_Integer aSideIt = 0; aSideIt < 4; ++aSideIt)
+      {
+        if ((aSideMask & (1 << aSideIt)) != 0)
+        {
+          aSides[aSideIt].Append (ChainNode ((aSideIt % 2) == 0 ? aUV.X() : aUV.Y(), aNodeIt));
+        }
+      }
+    }
+
+    NCollection_Array1<ChainNode> aChains[4];
+    for (Standard_Integer aSideIt = 0; aSideIt < 4; ++aSideIt)
+    {
+      sortChain (aSides[aSideIt], aChains[aSideIt]);
+    }
+
+    const NCollection_Array1<ChainNode>& aBottom = aChains[0];
+    const NCollection_Array1<ChainNode>& aRight  = aChains[1];
+    const NCollection_Array1<ChainNode>& aTop    = aChains[2];
+    const NCollection_Array1<ChainNode>& aLeft   = aChains[3];
+
+    // parameters of the iso-lines of the grid
+    NCollection_Vector<Standard_Real> aParamsU, aParamsV;
+    const Handle(IMeshData::ListOfPnt2d) aSurfaceNodes =
+      this->getRangeSplitter().GenerateSurfaceNodes (this->getParameters());
+    if (!aSurfaceNodes.IsNull())
+    {
+      for (IMeshData::ListOfPnt2d::Iterator aNodesIt (*aSurfaceNodes); aNodesIt.More(); aNodesIt.Next())
+      {
+        const gp_Pnt2d& aUV = aNodesIt.Value();
+        if (aUV.X() > myRangeU.first + myTolerance.first && aUV.X() < myRangeU.second - myTolerance.first)
+        {
+          aParamsU.Append (aUV.X());
+        }
+        if (aUV.Y() > myRangeV.first + myTolerance.second && aUV.Y() < myRangeV.second - myTolerance.second)
+        {
+          aParamsV.Append (aUV.Y());
+        }
+      }
+    }
+
+    NCollection_Array1<Standard_Real> aGridU, aGridV;
+    sortParameters (aParamsU, myTolerance.first,  aGridU);
+    sortParameters (aParamsV, myTolerance.second, aGridV);
+
+    // single strip between two opposite sides
+    if (aGridV.IsEmpty() && aLeft.Size() == 2 && aRight.Size() == 2)
+    {
+      zipChains (aBottom, aTop);
+      return;
+    }
+    if (aGridU.IsEmpty() && aBottom.Size() == 2 && aTop.Size() == 2)
+    {
+      zipChains (aLeft, aRight);
+      return;
+    }
+
+    if (aGridU.IsEmpty())
+    {
+      aGridU.Resize (0, 0, Standard_False);
+      aGridU (0) = 0.5 * (myRangeU.first + myRangeU.second);
+    }
+    if (aGridV.IsEmpty())
+    {
+      aGridV.Resize (0, 0, Standard_False);
+      aGridV (0) = 0.5 * (myRangeV.first + myRangeV.second);
+    }
+
+    if (isDeflectionExceeded (aGridU, aGridV))
+    {
+      myToFallback = Standard_True;
+      return;
+    }
+
+    // nodes of the grid
+    const Standard_Integer aNbU = aGridU.Size();
+    const Standard_Integer aNbV = aGridV.Size();
+    TColgp_Array1OfPnt2d aGridUV  (0, aNbU * aNbV - 1);
+    TColgp_Array1OfPnt   aGridPnt (0, aNbU * aNbV - 1);
+    for (Standard_Integer aVIt = 0; aVIt < aNbV; ++aVIt)
+    {
+      for (Standard_Integer aUIt = 0; aUIt < aNbU; ++aUIt)
+      {
+        aGridUV.SetValue (aVIt * aNbU + aUIt, gp_Pnt2d (aGridU (aUIt), aGridV (aVIt)));
+      }
+    }
+    this->getDFace()->GetSurface()->D0Batch (aGridUV, aGridPnt);
+
+    NCollection_Array2<Standard_Integer> aGrid (0, aNbU - 1, 0, aNbV - 1);
+    for (Standard_Integer aPntIt = aGridUV.Lower(); aPntIt <= aGridUV.Upper(); ++aPntIt)
+    {
+      aGrid (aPntIt % aNbU, aPntIt / aNbU) = this->registerNode (aGridPnt (aPntIt), aGridUV (aPntIt),
+                                                                 BRepMesh_Free, Standard_True);
+    }
+
+    // cells of the grid
+    for (Standard_Integer aVIt = 0; aVIt + 1 < aNbV; ++aVIt)
+    {
+      for (Standard_Integer aUIt = 0; aUIt + 1 < aNbU; ++aUIt)
+      {
+        const Standard_Integer aN00 = aGrid (aUIt,     aVIt);
+        const Standard_Integer aN10 = aGrid (aUIt + 1, aVIt);
+        const Standard_Integer aN11 = aGrid (aUIt + 1, aVIt + 1);
+        const Standard_Integer aN01 = aGrid (aUIt,     aVIt + 1);
+
+        const gp_Pnt& aP00 = aGridPnt (aVIt * aNbU + aUIt);
+        const gp_Pnt& aP10 = aGridPnt (aVIt * aNbU + aUIt + 1);
+        const gp_Pnt& aP11 = aGridPnt ((aVIt + 1) * aNbU + aUIt + 1);
+        const gp_Pnt& aP01 = aGridPnt ((aVIt + 1) * aNbU + aUIt);
+        if (aP00.SquareDistance (aP11) <= aP10.SquareDistance (aP01))
+        {
+          addTriangle (aN00, aN10, aN11);
+          addTriangle (aN00, aN11, aN01);
+        }
+        else
+        {
+          addTriangle (aN00, aN10, aN01);
+          addTriangle (aN10, aN11, aN01);
+        }
+      }
+    }
+
+    // strips between the boundary and the grid
+    NCollection_Array1<ChainNode> aRow (0, aNbU - 1), aColumn (0, aNbV - 1);
+    for (Standard_Integer aUIt = 0; aUIt < aNbU; ++aUIt)
+    {
+      aRow (aUIt) = ChainNode (aGridU (aUIt), aGrid (aUIt, 0));
+    }
+    zipChains (aBottom, aRow);
+    for (Standard_Integer aUIt = 0; aUIt < aNbU; ++aUIt)
+    {
+      aRow (aUIt) = ChainNode (aGridU (aUIt), aGrid (aUIt, aNbV - 1));
+    }
+    zipChains (aTop, aRow);
+
+    for (Standard_Integer aVIt = 0; aVIt < aNbV; ++aVIt)
+    {
+      aColumn (aVIt) = ChainNode (aGridV (aVIt), aGrid (0, aVIt));
+    }
+    zipChains (aLeft, aColumn);
+    for (Standard_Integer aVIt = 0; aVIt < aNbV; ++aVIt)
+    {
+      aColumn (aVIt) = ChainNode (aGridV (aVIt), aGrid (aNbU - 1, aVIt));
+    }
+    zipChains (aRight, aColumn);
+  }
+
+private:
+
+  //! Node of the chain ordered by parameter.
+  struct ChainNode
+  {
+    Standard_Real    Param;
+    Standard_Integer Node;
+
+    ChainNode() : Param (0.), Node (0) {}
+    ChainNode (const Standard_Real theParam, const Standard_Integer theNode)
+    : Param (theParam), Node (theNode) {}
+
+    bool operator< (const ChainNode& theOther) const { return Param < theOther.Param; }
+  };
+
+  //! Checks if the domain of the face is a rectangle in parametric space
+  //! bounded by the iso-lines, and initializes its range.
+  Standard_Boolean initDomain (const IMeshData::IFaceHandle& theDFace)
+  {
+    if (theDFace->WiresNb() != 1)
+    {
+      return Standard_False;
+    }
+
+    const IMeshData::IWireHandle& aDWire = theDFace->GetWire (0);
+    if (aDWire->IsSet (IMeshData_SelfIntersectingWire) ||
+        aDWire->IsSet (IMeshData_OpenWire))
+    {
+      return Standard_False;
+    }
+
+    for (TopExp_Explorer aExplorer (theDFace->GetFace(), TopAbs_VERTEX, TopAbs_EDGE); aExplorer.More(); aExplorer.Next())
+    {
+      if (aExplorer.Current().Orientation() == TopAbs_INTERNAL)
+      {
+        return Standard_False;
+      }
+    }
+
+    myRangeU.first  = myRangeV.first  =  1.e100;
+    myRangeU.second = myRangeV.second = -1.e100;
+    for (Standard_Integer aEdgeIt = 0; aEdgeIt < aDWire->EdgesNb(); ++aEdgeIt)
+    {
+      const IMeshData::IPCurveHandle& aPCurve = aDWire->GetEdge (aEdgeIt)->GetPCurve (
+        theDFace.get(), aDWire->GetEdgeOrientation (aEdgeIt));
+      for (Standard_Integer aPointIt = 0; aPointIt < aPCurve->ParametersNb(); ++aPointIt)
+      {
+        const gp_Pnt2d& aUV = aPCurve->GetPoint (aPointIt);
+        myRangeU.first  = Min (myRangeU.first,  aUV.X());
+        myRangeU.second = Max (myRangeU.second, aUV.X());
+        myRangeV.first  = Min (myRangeV.first,  aUV.Y());
+        myRangeV.second = Max (myRangeV.second, aUV.Y());
+      }
+    }
+
+    const Standard_Real aDiffU = myRangeU.second - myRangeU.first;
+    const Standard_Real aDiffV = myRangeV.second - myRangeV.first;
+    myTolerance.first  = Max (Precision::PConfusion(), 1.e-7 * aDiffU);
+    myTolerance.second = Max (Precision::PConfusion(), 1.e-7 * aDiffV);
+    if (aDiffU <= myTolerance.first || aDiffV <= myTolerance.second)
+    {
+      return Standard_False;
+    }
+
+    // each link of the wire should lie on one side of the rectangle
+    // and all corners of the rectangle should be the nodes of the wire
+    Standard_Integer aCorners = 0;
+    for (Standard_Integer aEdgeIt = 0; aEdgeIt < aDWire->EdgesNb(); ++aEdgeIt)
+    {
+      const IMeshData::IPCurveHandle& aPCurve = aDWire->GetEdge (aEdgeIt)->GetPCurve (
+        theDFace.get(), aDWire->GetEdgeOrientation (aEdgeIt));
+
+      Standard_Integer aPrevMask = 0;
+      for (Standard_Integer aPointIt = 0; aPointIt < aPCurve->ParametersNb(); ++aPointIt)
+      {
+        const Standard_Integer aMask = sideMask (aPCurve->GetPoint (aPointIt));
+        if (aMask == 0 || (aPointIt > 0 && (aMask & aPrevMask) == 0))
+        {
+          return Standard_False;
+        }
+
+        switch (aMask)
+        {
+          case 9:  aCorners |= 1; break; // left  bottom
+          case 3:  aCorners |= 2; break; // right bottom
+          case 6:  aCorners |= 4; break; // right top
+          case 12: aCorners |= 8; break; // left  top
+          default: break;
+        }
+        aPrevMask = aMask;
+      }
+    }
+
+    return aCorners == 15;
+  }
+
+  //! Checks if the grid of the Bezier or B-spline face exceeds its deflection:
+  //! the surface point in the middle of the cell is compared with the middle
+  //! of the diagonal of the cell. The grid is extended by the sides of the domain
+  //! to check the strips between the boundary and the grid as well.
+  //! The nodes of the analytic surfaces are distributed by the range splitters
+  //! according to the deflection.
+  Standard_Boolean isDeflectionExceeded (const NCollection_Array1<Standard_Real>& theGridU,
+                                         const NCollection_Array1<Standard_Real>& theGridV) const
+  {
+    const Handle(BRepAdaptor_Surface)& aSurface = this->getDFace()->GetSurface();
+    if (aSurface->GetType() != GeomAbs_BezierSurface
+     && aSurface->GetType() != GeomAbs_BSplineSurface)
+    {
+      return Standard_False;
+    }
+
+    NCollection_Array1<Standard_Real> aParamsU (0, theGridU.Size() + 1);
+    NCollection_Array1<Standard_Real> aParamsV (0, theGridV.Size() + 1);
+    aParamsU.ChangeFirst() = myRangeU.first;
+    aParamsU.ChangeLast()  = myRangeU.second;
+    aParamsV.ChangeFirst() = myRangeV.first;
+    aParamsV.ChangeLast()  = myRangeV.second;
+    for (Standard_Integer aUIt = 0; aUIt < theGridU.Size(); ++aUIt)
+    {
+      aParamsU (aUIt + 1) = theGridU (aUIt);
+    }
+    for (Standard_Integer aVIt = 0; aVIt < theGridV.Size(); ++aVIt)
+    {
+      aParamsV (aVIt + 1) = theGridV (aVIt);
+    }
+
+    // nodes of the extended grid followed by the centers of its cells
+    const Standard_Integer aNbU = aParamsU.Size();
+    const Standard_Integer aNbV = aParamsV.Size();
+    const Standard_Integer aNbNodes = aNbU * aNbV;
+    TColgp_Array1OfPnt2d aUVs  (0, aNbNodes + (aNbU - 1) * (aNbV - 1) - 1);
+    TColgp_Array1OfPnt   aPnts (0, aNbNodes + (aNbU - 1) * (aNbV - 1) - 1);
+    for (Standard_Integer aVIt = 0; aVIt < aNbV; ++aVIt)
+    {
+      for (Standard_Integer aUIt = 0; aUIt < aNbU; ++aUIt)
+      {
+        aUVs.SetValue (aVIt * aNbU + aUIt, gp_Pnt2d (aParamsU (aUIt), aParamsV (aVIt)));
+        if (aUIt + 1 < aNbU && aVIt + 1 < aNbV)
+        {
+          aUVs.SetValue (aNbNodes + aVIt * (aNbU - 1) + aUIt,
+                         gp_Pnt2d (0.5 * (aParamsU (aUIt) + aParamsU (aUIt + 1)),
+                                   0.5 * (aParamsV (aVIt) + aParamsV (aVIt + 1))));
+        }
+      }
+    }
+    aSurface->D0Batch (aUVs, aPnts);
+
+    const Standard_Real aSqDeflection = this->getDFace()->GetDeflection() * this->getDFace()->GetDeflection();
+    for (Standard_Integer aVIt = 0; aVIt + 1 < aNbV; ++aVIt)
+    {
+      for (Standard_Integer aUIt = 0; aUIt + 1 < aNbU; ++aUIt)
+      {
+        const gp_Pnt& aP00 = aPnts (aVIt * aNbU + aUIt);
+        const gp_Pnt& aP10 = aPnts (aVIt * aNbU + aUIt + 1);
+        const gp_Pnt& aP11 = aPnts ((aVIt + 1) * aNbU + aUIt + 1);
+        const gp_Pnt& aP01 = aPnts ((aVIt + 1) * aNbU + aUIt);
+        const gp_XYZ aMid = aP00.SquareDistance (aP11) <= aP10.SquareDistance (aP01)
+                          ? (aP00.XYZ() + aP11.XYZ()) * 0.5
+                          : (aP10.XYZ() + aP01.XYZ()) * 0.5;
+        if (aPnts (aNbNodes + aVIt * (aNbU - 1) + aUIt).XYZ().Subtracted (aMid).SquareModulus() > aSqDeflection)
+        {
+          return Standard_True;
+        }
+      }
+    }
+    return Standard_False;
+  }
+
+  //! Returns the mask of the sides of the rectangular domain the point lies on:
+  //! 1 - bottom, 2 - right, 4 - top, 8 - left.
+  Standard_Integer sideMask (const gp_Pnt2d& thePnt) const
+  {
+    Standard_Integer aMask = 0;
+    if (Abs (thePnt.Y() - myRangeV.first)  <= myTolerance.second) aMask |= 1;
+    if (Abs (thePnt.X() - myRangeU.second) <= myTolerance.first)  aMask |= 2;
+    if (Abs (thePnt.Y() - myRangeV.second) <= myTolerance.second) aMask |= 4;
+    if (Abs (thePnt.X() - myRangeU.first)  <= myTolerance.first)  aMask |= 8;
+    return aMask;
+  }
+
+  //! Sorts the nodes of the side by parameter.
+  static void sortChain (const NCollection_Vector<ChainNode>& theSide,
+                         NCollection_Array1<ChainNode>&       theChain)
+  {
+    if (theSide.IsEmpty())
+    {
+      return;
+    }
+
+    theChain.Resize (0, theSide.Length() - 1, Standard_False);
+    for (Standard_Integer aNodeIt = 0; aNodeIt < theSide.Length(); ++aNodeIt)
+    {
+      theChain (aNodeIt) = theSide (aNodeIt);
+    }
+    std::sort (theChain.begin(), theChain.end());
+  }
+
+  //! Sorts the parameters and removes the coincident ones.
+  static void sortParameters (NCollection_Vector<Standard_Real>& theParams,
+                              const Standard_Real                theTolerance,
+                              NCollection_Array1<Standard_Real>& theGrid)
+  {
+    if (theParams.IsEmpty())
+    {
+      return;
+    }
+
+    NCollection_Array1<Standard_Real> aParams (0, theParams.Length() - 1);
+    for (Standard_Integer aParamIt = 0; aParamIt < theParams.Length(); ++aParamIt)
+    {
+      aParams (aParamIt) = theParams (aParamIt);
+    }
+    std::sort (aParams.begin(), aParams.end());
+
+    theParams.Clear();
+    theParams.Append (aParams (0));
+    for (Standard_Integer aParamIt = 1; aParamIt < aParams.Size(); ++aParamIt)
+    {
+      if (aParams (aParamIt) - theParams.Last() > theTolerance)
+      {
+        theParams.Append (aParams (aParamIt));
+      }
+    }
+
+    theGrid.Resize (0, theParams.Length() - 1, Standard_False);
+    for (Standard_Integer aParamIt = 0; aParamIt < theParams.Length(); ++aParamIt)
+    {
+      theGrid (aParamIt) = theParams (aParamIt);
+    }
+  }
+
+  //! Fills the strip between two chains of nodes lying on parallel iso-lines
+  //! by triangles, advancing along the chain which is behind the other one.
+  //! The parameters of both chains are measured along the same direction,
+  //! so the links of the strip connect the nodes with the closest parameters.
+  void zipChains (const NCollection_Array1<ChainNode>& theChain1,
+                  const NCollection_Array1<ChainNode>& theChain2)
+  {
+    if (theChain1.IsEmpty() || theChain2.IsEmpty())
+    {
+      return;
+    }
+
+    const Standard_Integer aLast1 = theChain1.Upper();
+    const Standard_Integer aLast2 = theChain2.Upper();
+
+    Standard_Integer aIt1 = 0, aIt2 = 0;
+    while (aIt1 < aLast1 || aIt2 < aLast2)
+    {
+      Standard_Boolean isAdvance1 = (aIt2 == aLast2);
+      if (aIt1 < aLast1 && aIt2 < aLast2)
+      {
+        isAdvance1 = theChain1 (aIt1 + 1).Param <= theChain2 (aIt2 + 1).Param;
+      }
+
+      if (isAdvance1)
+      {
+        addTriangle (theChain1 (aIt1).Node, theChain1 (aIt1 + 1).Node, theChain2 (aIt2).Node);
+        ++aIt1;
+      }
+      else
+      {
+        addTriangle (theChain1 (aIt1).Node, theChain2 (aIt2 + 1).Node, theChain2 (aIt2).Node);
+        ++aIt2;
+      }
+    }
+  }
+
+  //! Adds the triangle to the mesh structure with counterclockwise orientation in parametric space.
+  void addTriangle (const Standard_Integer theNode1,
+                    const Standard_Integer theNode2,
+                    const Standard_Integer theNode3)
+  {
+    const Handle(BRepMesh_DataStructureOfDelaun)& aStructure = this->getStructure();
+    Standard_Integer aNodes[3] = { theNode1, theNode2, theNode3 };
+
+    const gp_XY& aP1 = aStructure->GetNode (aNodes[0]).Coord();
+    const gp_XY& aP2 = aStructure->GetNode (aNodes[1]).Coord();
+    const gp_XY& aP3 = aStructure->GetNode (aNodes[2]).Coord();
+    const Standard_Real anArea = (aP2 - aP1) ^ (aP3 - aP1);
+    if (anArea == 0.)
+    {
+      return;
+    }
+    else if (anArea < 0.)
+    {
+      std::swap (aNodes[1], aNodes[2]);
+    }
+
+    Standard_Integer aLinks[3];
+    Standard_Boolean aLinksOri[3];
+    for (Standard_Integer aLinkIt = 0; aLinkIt < 3; ++aLinkIt)
+    {
+      const Standard_Integer aLink = aStructure->AddLink (
+        BRepMesh_Edge (aNodes[aLinkIt], aNodes[(aLinkIt + 1) % 3], BRepMesh_Free));
+      aLinks   [aLinkIt] = Abs (aLink);
+      aLinksOri[aLinkIt] = aLink > 0;
+    }
+    aStructure->AddElement (BRepMesh_Triangle (aLinks, aLinksOri, BRepMesh_Free));
+  }
+
+private:
+
+  Handle(IMeshTools_MeshAlgoFactory)      myFallbackFactory;
+  Standard_Boolean                        myToFallback;      //!< grid has been rejected by deflection
+  std::pair<Standard_Real, Standard_Real> myRangeU;
+  std::pair<Standard_Real, Standard_Real> myRangeV;
+  std::pair<Standard_Real, Standard_Real> myTolerance;
+};
+
+#endif
@@ -0,0 +1,86 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_StructuredMeshAlgoFactory.hxx>
+#include <BRepMesh_MeshAlgoFactory.hxx>
+#include <BRepMesh_StructuredMeshAlgo.hxx>
+#include <BRepMesh_SphereRangeSplitter.hxx>
+#include <BRepMesh_CylinderRangeSplitter.hxx>
+#include <BRepMesh_ConeRangeSplitter.hxx>
+#include <BRepMesh_TorusRangeSplitter.hxx>
+#include <BRepMesh_NURBSRangeSplitter.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_StructuredMeshAlgoFactory, IMeshTools_MeshAlgoFactory)
+
+//=======================================================================
+// Function: Constructor
+// Purpose :
+//=======================================================================
+BRepMesh_StructuredMeshAlgoFactory::BRepMesh_StructuredMeshAlgoFactory ()
+: myFallbackFactory (new BRepMesh_MeshAlgoFactory())
+{
+}
+
+//=======================================================================
+// Function: Constructor
+// Purpose :
+//=======================================================================
+BRepMesh_StructuredMeshAlgoFactory::BRepMesh_StructuredMeshAlgoFactory (
+  const Handle(IMeshTools_MeshAlgoFactory)& theFallbackFactory)
+: myFallbackFactory (theFallbackFactory)
+{
+}
+
+//=======================================================================
+// Function: Destructor
+// Purpose :
+//=======================================================================
+BRepMesh_StructuredMeshAlgoFactory::~BRepMesh_StructuredMeshAlgoFactory ()
+{
+}
+
+//=======================================================================
+// Function: GetAlgo
+// Purpose :
+//=======================================================================
+Handle(IMeshTools_MeshAlgo) BRepMesh_StructuredMeshAlgoFactory::GetAlgo(
+  const GeomAbs_SurfaceType    theSurfaceType,
+  const IMeshTools_Parameters& theParameters) const
+{
+  // the algorithm of the fallback factory is requested by the structured
+  // algorithm only for the faces which cannot be meshed by the grid
+  switch (theSurfaceType)
+  {
+  case GeomAbs_Plane:
+    return new BRepMesh_StructuredMeshAlgo<BRepMesh_DefaultRangeSplitter> (myFallbackFactory);
+
+  case GeomAbs_Sphere:
+    return new BRepMesh_StructuredMeshAlgo<BRepMesh_SphereRangeSplitter> (myFallbackFactory);
+
+  case GeomAbs_Cylinder:
+    return new BRepMesh_StructuredMeshAlgo<BRepMesh_CylinderRangeSplitter> (myFallbackFactory);
+
+  case GeomAbs_Cone:
+    return new BRepMesh_StructuredMeshAlgo<BRepMesh_ConeRangeSplitter> (myFallbackFactory);
+
+  case GeomAbs_Torus:
+    return new BRepMesh_StructuredMeshAlgo<BRepMesh_TorusRangeSplitter> (myFallbackFactory);
+
+  case GeomAbs_BezierSurface:
+  case GeomAbs_BSplineSurface:
+    return new BRepMesh_StructuredMeshAlgo<BRepMesh_NURBSRangeSplitter> (myFallbackFactory);
+
+  default:
+    return myFallbackFactory->GetAlgo (theSurfaceType, theParameters);
+  }
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_StructuredMeshAlgoFactory_HeaderFile
+#define _BRepMesh_StructuredMeshAlgoFactory_HeaderFile
+
+#include <Standard_Transient.hxx>
+#include <IMeshTools_MeshAlgoFactory.hxx>
+
+//! Implementation of IMeshTools_MeshAlgoFactory providing algorithms building
+//! structured grids (BRepMesh_StructuredMeshAlgo) for the faces with rectangular
+//! parametric domain lying on planes, cylinders, cones, spheres, tori and
+//! Bezier or B-spline surfaces. The other faces are meshed by the algorithms
+//! of the fallback factory (BRepMesh_MeshAlgoFactory by default).
+class BRepMesh_StructuredMeshAlgoFactory : public IMeshTools_MeshAlgoFactory
+{
+public:
+
+  //! Constructor.
+  Standard_EXPORT BRepMesh_StructuredMeshAlgoFactory ();
+
+  //! Constructor with the factory of the algorithms for the faces
+  //! which cannot be meshed by structured grid.
+  Standard_EXPORT BRepMesh_StructuredMeshAlgoFactory (const Handle(IMeshTools_MeshAlgoFactory)& theFallbackFactory);
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BRepMesh_StructuredMeshAlgoFactory ();
+
+  //! Creates instance of meshing algorithm for the given type of surface.
+  Standard_EXPORT virtual Handle(IMeshTools_MeshAlgo) GetAlgo(
+    const GeomAbs_SurfaceType    theSurfaceType,
+    const IMeshTools_Parameters& theParameters) const Standard_OVERRIDE;
+
+  DEFINE_STANDARD_RTTIEXT(BRepMesh_StructuredMeshAlgoFactory, IMeshTools_MeshAlgoFactory)
+
+private:
+
+  Handle(IMeshTools_MeshAlgoFactory) myFallbackFactory;
+};
+
+#endif
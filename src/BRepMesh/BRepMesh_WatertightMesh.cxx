@@ -0,0 +1,312 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_WatertightMesh.hxx>
+
+#include <BRep_Tool.hxx>
+#include <NCollection_DataMap.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Precision.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+#include <TColStd_HArray1OfInteger.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+namespace
+{
+  //! Nodes of the result lying on the edge and the polygon of the edge they have been taken from
+  struct EdgeDiscretization
+  {
+    Handle(TColStd_HArray1OfInteger)    Nodes;
+    Handle(Poly_PolygonOnTriangulation) Polygon;
+  };
+
+  typedef NCollection_DataMap<TopoDS_Shape, Standard_Integer, TopTools_ShapeMapHasher> VertexNodesMap;
+  typedef NCollection_DataMap<TopoDS_Shape, EdgeDiscretization, TopTools_ShapeMapHasher> EdgeNodesMap;
+
+  //! Auxiliary tool accumulating the nodes and triangles of the result
+  class MeshBuilder
+  {
+  public:
+
+    //! Adds new node to the result and returns its index
+    Standard_Integer AddNode (const gp_Pnt& thePnt)
+    {
+      myNodes.Append (thePnt);
+      return myNodes.Length();
+    }
+
+    //! Returns the node of the vertex, adding it with the given point if necessary
+    Standard_Integer VertexNode (const TopoDS_Vertex& theVertex, const gp_Pnt& thePnt)
+    {
+      if (const Standard_Integer* aNode = myVertexNodes.Seek (theVertex))
+      {
+        return *aNode;
+      }
+      const Standard_Integer aNode = AddNode (thePnt);
+      myVertexNodes.Bind (theVertex, aNode);
+      return aNode;
+    }
+
+    //! Adds the triangle, skipping the degenerated ones.
+    void AddTriangle (const Standard_Integer theN1,
+                      const Standard_Integer theN2,
+                      const Standard_Integer theN3)
+    {
+      if (theN1 != theN2 && theN2 != theN3 && theN3 != theN1)
+      {
+        myTriangles.Append (Poly_Triangle (theN1, theN2, theN3));
+      }
+    }
+
+    //! Returns the node with the given index
+    const gp_Pnt& Node (const Standard_Integer theIndex) const { return myNodes.Value (theIndex - 1); }
+
+    //! Returns the number of added triangles
+    Standard_Integer NbTriangles() const { return myTriangles.Length(); }
+
+    //! Returns the map of the discretized edges
+    EdgeNodesMap& EdgeNodes() { return myEdgeNodes; }
+
+    //! Creates the resulting triangulation
+    Handle(Poly_Triangulation) Result() const
+    {
+      Handle(Poly_Triangulation) aResult = new Poly_Triangulation (myNodes.Length(), myTriangles.Length(), Standard_False);
+      for (Standard_Integer aNodeIt = 0; aNodeIt < myNodes.Length(); ++aNodeIt)
+      {
+        aResult->SetNode (aNodeIt + 1, myNodes.Value (aNodeIt));
+      }
+      for (Standard_Integer aTriIt = 0; aTriIt < myTriangles.Length(); ++aTriIt)
+      {
+        aResult->SetTriangle (aTriIt + 1, myTriangles.Value (aTriIt));
+      }
+      return aResult;
+    }
+
+  private:
+    NCollection_Vector<gp_Pnt>        myNodes;
+    NCollection_Vector<Poly_Triangle> myTriangles;
+    VertexNodesMap                    myVertexNodes;
+    EdgeNodesMap                      myEdgeNodes;
+  };
+}
+
+//=======================================================================
+//function : isSameDiscretization
+//purpose  : Checks if the polygon of the edge on the face gives the same
+//           discretization of the edge as the one already added to the result:
+//           the parameters of the nodes should coincide if both polygons have
+//           them, otherwise the positions of the nodes within edge tolerance
+//=======================================================================
+static Standard_Boolean isSameDiscretization (const MeshBuilder&                         theBuilder,
+                                              const EdgeDiscretization&                  theEdgeNodes,
+                                              const Handle(Poly_PolygonOnTriangulation)& thePolygon,
+                                              const Handle(Poly_Triangulation)&          theTriangulation,
+                                              const gp_Trsf&                             theTrsf,
+                                              const Standard_Real                        theTolerance)
+{
+  const Standard_Integer aNbNodes = thePolygon->NbNodes();
+  if (theEdgeNodes.Nodes->Length() != aNbNodes)
+  {
+    return Standard_False;
+  }
+
+  if (thePolygon->HasParameters() && theEdgeNodes.Polygon->HasParameters())
+  {
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+    {
+      if (Abs (thePolygon->Parameter (aNodeIt) - theEdgeNodes.Polygon->Parameter (aNodeIt)) > Precision::PConfusion())
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+
+  const Standard_Real aSqTol = theTolerance * theTolerance;
+  for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+  {
+    const gp_Pnt aPnt = theTriangulation->Node (thePolygon->Node (aNodeIt)).Transformed (theTrsf);
+    if (aPnt.SquareDistance (theBuilder.Node (theEdgeNodes.Nodes->Value (aNodeIt))) > aSqTol)
+    {
+      return Standard_False;
+    }
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : BRepMesh_WatertightMesh
+//purpose  :
+//=======================================================================
+BRepMesh_WatertightMesh::BRepMesh_WatertightMesh()
+: myNbNotSharedEdges (0)
+{
+}
+
+//=======================================================================
+//function : BRepMesh_WatertightMesh
+//purpose  :
+//=======================================================================
+BRepMesh_WatertightMesh::BRepMesh_WatertightMesh (const TopoDS_Shape& theShape)
+: myNbNotSharedEdges (0)
+{
+  Perform (theShape);
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BRepMesh_WatertightMesh::Perform (const TopoDS_Shape& theShape)
+{
+  myTriangulation.Nullify();
+  myFaces.Clear();
+  myNbNotSharedEdges = 0;
+
+  MeshBuilder aBuilder;
+  TopTools_MapOfShape aProcessedFaces, aNotSharedEdges;
+  for (TopExp_Explorer aFaceIt (theShape, TopAbs_FACE); aFaceIt.More(); aFaceIt.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (aFaceIt.Current());
+    if (!aProcessedFaces.Add (aFace))
+    {
+      continue;
+    }
+
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+    if (aTriangulation.IsNull() || aTriangulation->NbTriangles() == 0)
+    {
+      continue;
+    }
+
+    const gp_Trsf aTrsf = aLoc.Transformation();
+    const Standard_Boolean isIdentity = aLoc.IsIdentity();
+
+    // global indices of the nodes of the face (0 for not assigned yet)
+    TColStd_Array1OfInteger aGlobalNodes (1, aTriangulation->NbNodes());
+    aGlobalNodes.Init (0);
+
+    // the nodes on the boundary are taken from the discretization of the edges
+    for (TopExp_Explorer anEdgeIt (aFace, TopAbs_EDGE); anEdgeIt.More(); anEdgeIt.Next())
+    {
+      const TopoDS_Edge& anEdge = TopoDS::Edge (anEdgeIt.Current());
+      const Handle(Poly_PolygonOnTriangulation)& aPolygon =
+        BRep_Tool::PolygonOnTriangulation (anEdge, aTriangulation, aLoc);
+      if (aPolygon.IsNull() || aPolygon->NbNodes() < 2)
+      {
+        continue;
+      }
+
+      const Standard_Integer aNbNodes = aPolygon->NbNodes();
+      TopoDS_Vertex aFirstVertex, aLastVertex;
+      TopExp::Vertices (TopoDS::Edge (anEdge.Oriented (TopAbs_FORWARD)), aFirstVertex, aLastVertex);
+
+      const gp_Pnt aFirstPnt = aTriangulation->Node (aPolygon->Node (1)).Transformed (aTrsf);
+      const gp_Pnt aLastPnt  = aTriangulation->Node (aPolygon->Node (aNbNodes)).Transformed (aTrsf);
+      if (BRep_Tool::Degenerated (anEdge))
+      {
+        // all nodes of the degenerated edge collapse into its vertex
+        const Standard_Integer aVertexNode = aBuilder.VertexNode (aFirstVertex, aFirstPnt);
+        for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+        {
+          Standard_Integer& aGlobalNode = aGlobalNodes.ChangeValue (aPolygon->Node (aNodeIt));
+          if (aGlobalNode == 0)
+          {
+            aGlobalNode = aVertexNode;
+          }
+        }
+        continue;
+      }
+
+      Handle(TColStd_HArray1OfInteger) anEdgeNodes;
+      if (const EdgeDiscretization* anEdgeNodesPtr = aBuilder.EdgeNodes().Seek (anEdge))
+      {
+        anEdgeNodes = anEdgeNodesPtr->Nodes;
+        if (!isSameDiscretization (aBuilder, *anEdgeNodesPtr, aPolygon, aTriangulation,
+                                   aTrsf, Max (BRep_Tool::Tolerance (anEdge), Precision::Confusion())))
+        {
+          // inconsistent discretization, only the vertices can be shared
+          if (aNotSharedEdges.Add (anEdge))
+          {
+            ++myNbNotSharedEdges;
+          }
+          aGlobalNodes.ChangeValue (aPolygon->Node (1))        = aBuilder.VertexNode (aFirstVertex, aFirstPnt);
+          aGlobalNodes.ChangeValue (aPolygon->Node (aNbNodes)) = aBuilder.VertexNode (aLastVertex,  aLastPnt);
+          continue;
+        }
+      }
+      else
+      {
+        anEdgeNodes = new TColStd_HArray1OfInteger (1, aNbNodes);
+        anEdgeNodes->SetValue (1,        aBuilder.VertexNode (aFirstVertex, aFirstPnt));
+        anEdgeNodes->SetValue (aNbNodes, aBuilder.VertexNode (aLastVertex,  aLastPnt));
+        for (Standard_Integer aNodeIt = 2; aNodeIt < aNbNodes; ++aNodeIt)
+        {
+          const gp_Pnt aPnt = aTriangulation->Node (aPolygon->Node (aNodeIt));
+          anEdgeNodes->SetValue (aNodeIt, aBuilder.AddNode (isIdentity ? aPnt : aPnt.Transformed (aTrsf)));
+        }
+        EdgeDiscretization aNewEdgeNodes;
+        aNewEdgeNodes.Nodes   = anEdgeNodes;
+        aNewEdgeNodes.Polygon = aPolygon;
+        aBuilder.EdgeNodes().Bind (anEdge, aNewEdgeNodes);
+      }
+
+      for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+      {
+        aGlobalNodes.ChangeValue (aPolygon->Node (aNodeIt)) = anEdgeNodes->Value (aNodeIt);
+      }
+    }
+
+    // the interior nodes are specific to the face
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aTriangulation->NbNodes(); ++aNodeIt)
+    {
+      Standard_Integer& aGlobalNode = aGlobalNodes.ChangeValue (aNodeIt);
+      if (aGlobalNode == 0)
+      {
+        const gp_Pnt aPnt = aTriangulation->Node (aNodeIt);
+        aGlobalNode = aBuilder.AddNode (isIdentity ? aPnt : aPnt.Transformed (aTrsf));
+      }
+    }
+
+    FaceRange aRange;
+    aRange.Face  = aFace;
+    aRange.First = aBuilder.NbTriangles() + 1;
+    // mirroring location inverts the orientation of the triangles as well
+    const Standard_Boolean isMirrored = !isIdentity && aTrsf.VectorialPart().Determinant() < 0.0;
+    const Standard_Boolean isReversed = (aFace.Orientation() == TopAbs_REVERSED) != isMirrored;
+    for (Standard_Integer aTriIt = 1; aTriIt <= aTriangulation->NbTriangles(); ++aTriIt)
+    {
+      Standard_Integer aN1, aN2, aN3;
+      aTriangulation->Triangle (aTriIt).Get (aN1, aN2, aN3);
+      if (isReversed)
+      {
+        std::swap (aN2, aN3);
+      }
+      aBuilder.AddTriangle (aGlobalNodes (aN1), aGlobalNodes (aN2), aGlobalNodes (aN3));
+    }
+    aRange.Last = aBuilder.NbTriangles();
+    myFaces.Append (aRange);
+  }
+
+  if (!myFaces.IsEmpty())
+  {
+    myTriangulation = aBuilder.Result();
+  }
+}
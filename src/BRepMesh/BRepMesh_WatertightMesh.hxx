@@ -0,0 +1,108 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_WatertightMesh_HeaderFile
+#define _BRepMesh_WatertightMesh_HeaderFile
+
+#include <NCollection_Vector.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! Builds a single compact mesh of the whole shape from the triangulations
+//! of its faces computed by BRepMesh_IncrementalMesh.
+//!
+//! The nodes of the faces lying on the shared edges and vertices are not
+//! duplicated in the result: BRepMesh discretizes each edge only once for all
+//! faces sharing it, and the polygons on triangulation stored in the edges
+//! give for each face the nodes of this common discretization.
+//! Thus the nodes are identified topologically, without any geometrical
+//! welding, and the mesh of the closed shell is watertight.
+//! The nodes of the seam edges are merged in the same way, and the triangles
+//! collapsed on the degenerated edges are removed from the result.
+//!
+//! The nodes of the result are given in the global coordinate system
+//! (locations of the faces are applied), and the triangles are oriented
+//! according to the orientation of the faces in the shape, taking into
+//! account the mirroring locations.
+//! The triangles of each face occupy a contiguous range in the result.
+//!
+//! The nodes of the edge are merged only if its polygons in the adjacent faces
+//! give the same discretization: the parameters of the nodes on the edge should
+//! coincide, or, if the polygons have no parameters, the nodes should coincide
+//! within the tolerance of the edge. Otherwise (e.g. the faces have been meshed
+//! separately) only the vertices of such edge are merged, and the edge
+//! is counted as not shared.
+class BRepMesh_WatertightMesh
+{
+public:
+
+  //! Empty constructor
+  Standard_EXPORT BRepMesh_WatertightMesh();
+
+  //! Constructor building the mesh of the given shape
+  Standard_EXPORT BRepMesh_WatertightMesh (const TopoDS_Shape& theShape);
+
+  //! Builds the mesh of the given shape.
+  //! The faces without triangulation are skipped.
+  Standard_EXPORT void Perform (const TopoDS_Shape& theShape);
+
+  //! Returns TRUE if the mesh is built
+  Standard_Boolean IsDone() const { return !myTriangulation.IsNull(); }
+
+  //! Returns the resulting mesh
+  const Handle(Poly_Triangulation)& Triangulation() const { return myTriangulation; }
+
+  //! Returns the number of meshed faces in the result
+  Standard_Integer NbFaces() const { return myFaces.Length(); }
+
+  //! Returns the face with the given index (1 <= theIndex <= NbFaces())
+  const TopoDS_Face& Face (const Standard_Integer theIndex) const
+  {
+    return myFaces.Value (theIndex - 1).Face;
+  }
+
+  //! Returns the range of the triangles of the face with the given index
+  //! (1 <= theIndex <= NbFaces()) in the result.
+  //! The range is empty (theFirst > theLast) if all triangles of the face are degenerated.
+  void TrianglesRange (const Standard_Integer theIndex,
+                       Standard_Integer& theFirst,
+                       Standard_Integer& theLast) const
+  {
+    const FaceRange& aRange = myFaces.Value (theIndex - 1);
+    theFirst = aRange.First;
+    theLast  = aRange.Last;
+  }
+
+  //! Returns the number of edges whose nodes have not been merged
+  //! because of inconsistent discretization in the adjacent faces
+  Standard_Integer NbNotSharedEdges() const { return myNbNotSharedEdges; }
+
+private:
+
+  //! Range of triangles of the face in the result
+  struct FaceRange
+  {
+    TopoDS_Face      Face;
+    Standard_Integer First;
+    Standard_Integer Last;
+  };
+
+private:
+
+  Handle(Poly_Triangulation)    myTriangulation;
+  NCollection_Vector<FaceRange> myFaces;
+  Standard_Integer              myNbNotSharedEdges;
+};
+
+#endif
@@ -42,6 +42,11 @@
 
 #include <GeomAPI_ProjectPointOnSurf.hxx>
 #include <Message.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <math_BullardGenerator.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec.hxx>
 
 //-----------------------------------------------------------------------
 // suppressarg : suppress a[d],modifie na--
@@ -700,6 +705,96 @@ static Standard_Integer projponf(Draw_Interpretor& di, Standard_Integer n, const
   return 0;
 }
 
+//=======================================================================
+//function : sbatchvalue
+//purpose  : compares the batch evaluation of the surface with the point-by-point one
+//=======================================================================
+static Standard_Integer sbatchvalue (Draw_Interpretor& theDI,
+                                     Standard_Integer  theNbArgs,
+                                     const char**      theArgVec)
+{
+  if (theNbArgs != 4)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  // the face is evaluated by BRepAdaptor_Surface taking into account its location
+  Handle(Adaptor3d_Surface) aSurf;
+  const TopoDS_Shape aShape = DBRep::Get (theArgVec[1], TopAbs_FACE, Standard_False);
+  if (!aShape.IsNull())
+  {
+    aSurf = new BRepAdaptor_Surface (TopoDS::Face (aShape), Standard_False);
+  }
+  else
+  {
+    const Handle(Geom_Surface) aGeomSurf = DrawTrSurf::GetSurface (theArgVec[1]);
+    if (aGeomSurf.IsNull())
+    {
+      theDI << "Error: " << theArgVec[1] << " is neither a face nor a surface\n";
+      return 1;
+    }
+    aSurf = new GeomAdaptor_Surface (aGeomSurf);
+  }
+
+  const Standard_Integer aNbU = Draw::Atoi (theArgVec[2]);
+  const Standard_Integer aNbV = Draw::Atoi (theArgVec[3]);
+  if (aNbU < 2 || aNbV < 2)
+  {
+    theDI << "Error: at least 2 points in each direction are required\n";
+    return 1;
+  }
+
+  const Standard_Real aUFirst = aSurf->FirstUParameter(), aULast = aSurf->LastUParameter();
+  const Standard_Real aVFirst = aSurf->FirstVParameter(), aVLast = aSurf->LastVParameter();
+  if (Precision::IsInfinite (aUFirst) || Precision::IsInfinite (aULast)
+   || Precision::IsInfinite (aVFirst) || Precision::IsInfinite (aVLast))
+  {
+    theDI << "Error: the surface is not bounded\n";
+    return 1;
+  }
+
+  // the grid points are shuffled to mix the spans of the surface
+  const Standard_Integer aNbPnts = aNbU * aNbV;
+  TColgp_Array1OfPnt2d aUVs (1, aNbPnts);
+  for (Standard_Integer i = 0; i < aNbU; ++i)
+  {
+    for (Standard_Integer j = 0; j < aNbV; ++j)
+    {
+      aUVs (i * aNbV + j + 1).SetCoord (aUFirst + (aULast - aUFirst) * i / (aNbU - 1),
+                                        aVFirst + (aVLast - aVFirst) * j / (aNbV - 1));
+    }
+  }
+  math_BullardGenerator aRandom;
+  for (Standard_Integer i = aNbPnts; i > 1; --i)
+  {
+    std::swap (aUVs (i), aUVs (1 + aRandom.NextInt() % i));
+  }
+
+  TColgp_Array1OfPnt aPnts0 (1, aNbPnts), aPnts1 (1, aNbPnts);
+  TColgp_Array1OfVec aD1U (1, aNbPnts), aD1V (1, aNbPnts);
+  aSurf->D0Batch (aUVs, aPnts0);
+  aSurf->D1Batch (aUVs, aPnts1, aD1U, aD1V);
+
+  Standard_Real aMaxDevD0 = 0.0, aMaxDevD1 = 0.0;
+  for (Standard_Integer i = 1; i <= aNbPnts; ++i)
+  {
+    gp_Pnt aPnt;
+    gp_Vec aDU, aDV;
+    aSurf->D0 (aUVs (i).X(), aUVs (i).Y(), aPnt);
+    aMaxDevD0 = Max (aMaxDevD0, aPnt.Distance (aPnts0 (i)));
+
+    aSurf->D1 (aUVs (i).X(), aUVs (i).Y(), aPnt, aDU, aDV);
+    aMaxDevD1 = Max (aMaxDevD1, aPnt.Distance (aPnts1 (i)));
+    aMaxDevD1 = Max (aMaxDevD1, (aDU - aD1U (i)).Magnitude());
+    aMaxDevD1 = Max (aMaxDevD1, (aDV - aD1V (i)).Magnitude());
+  }
+
+  theDI << "Max deviation D0: " << aMaxDevD0 << "\n";
+  theDI << "Max deviation D1: " << aMaxDevD1 << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : SurfaceCommands
 //purpose  : 
@@ -760,5 +855,12 @@ void  BRepTest::SurfaceCommands(Draw_Interpretor& theCommands)
                    "projponf face pnt [extrema flag: -min/-max/-minmax] [extrema algo: -g(grad)/-t(tree)]\n"
                    "\t\tProject point on the face.",
                    __FILE__, projponf, g);
+
+  theCommands.Add ("sbatchvalue",
+                   "sbatchvalue face|surface NbU NbV"
+                   "\n\t\t: Evaluates the points and the first derivatives of the surface"
+                   "\n\t\t: on the grid of NbU x NbV parameters by single batch (D0Batch, D1Batch)"
+                   "\n\t\t: and outputs their maximal deviations from the ones evaluated point by point.",
+                   __FILE__, sbatchvalue, g);
 }
 
@@ -127,3 +127,24 @@ void BinDrivers_DocumentRetrievalDriver::EnableQuickPartReading (
 
   aShapesDriver->EnableQuickPart (theValue);
 }
+
+//=======================================================================
+//function : SetDeferredTriangulation
+//purpose  :
+//=======================================================================
+void BinDrivers_DocumentRetrievalDriver::SetDeferredTriangulation (
+  const Handle(Message_Messenger)& theMessageDriver, const Standard_Boolean theIsDeferred)
+{
+  if (myDrivers.IsNull())
+    myDrivers = AttributeDrivers (theMessageDriver);
+  if (myDrivers.IsNull())
+    return;
+
+  Handle(BinMDF_ADriver) aDriver;
+  myDrivers->GetDriver (STANDARD_TYPE(TNaming_NamedShape), aDriver);
+  Handle(BinMNaming_NamedShapeDriver) aShapesDriver = Handle(BinMNaming_NamedShapeDriver)::DownCast (aDriver);
+  if (aShapesDriver.IsNull())
+    throw Standard_NotImplemented ("Internal Error - TNaming_NamedShape is not found!");
+
+  aShapesDriver->SetDeferredTriangulation (theIsDeferred);
+}
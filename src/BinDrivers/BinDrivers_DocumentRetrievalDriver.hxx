@@ -59,6 +59,11 @@ public:
   Standard_EXPORT virtual void EnableQuickPartReading
     (const Handle(Message_Messenger)& theMessageDriver, Standard_Boolean theValue) Standard_OVERRIDE;
 
+  //! Enables deferred decoding of triangulation stored in compact form:
+  //! triangulation is kept encoded until Poly_Triangulation::LoadDeferredData() call.
+  Standard_EXPORT void SetDeferredTriangulation
+    (const Handle(Message_Messenger)& theMessageDriver, const Standard_Boolean theIsDeferred);
+
 
   DEFINE_STANDARD_RTTIEXT(BinDrivers_DocumentRetrievalDriver,BinLDrivers_DocumentRetrievalDriver)
 
@@ -176,6 +176,51 @@ void BinDrivers_DocumentStorageDriver::SetWithNormals (const Handle(Message_Mess
   aShapesDriver->SetWithNormals (theWithNormals);
 }
 
+//=======================================================================
+//function : IsCompactTriangulation
+//purpose  :
+//=======================================================================
+Standard_Boolean BinDrivers_DocumentStorageDriver::IsCompactTriangulation() const
+{
+  if (myDrivers.IsNull())
+  {
+    return Standard_False;
+  }
+
+  Handle(BinMDF_ADriver) aDriver;
+  myDrivers->GetDriver (STANDARD_TYPE(TNaming_NamedShape), aDriver);
+  Handle(BinMNaming_NamedShapeDriver) aShapesDriver = Handle(BinMNaming_NamedShapeDriver)::DownCast (aDriver);
+  return !aShapesDriver.IsNull()
+       && aShapesDriver->IsCompactTriangulation();
+}
+
+//=======================================================================
+//function : SetCompactTriangulation
+//purpose  :
+//=======================================================================
+void BinDrivers_DocumentStorageDriver::SetCompactTriangulation (const Handle(Message_Messenger)& theMessageDriver,
+                                                                const Standard_Boolean theIsCompact)
+{
+  if (myDrivers.IsNull())
+  {
+    myDrivers = AttributeDrivers (theMessageDriver);
+  }
+  if (myDrivers.IsNull())
+  {
+    return;
+  }
+
+  Handle(BinMDF_ADriver) aDriver;
+  myDrivers->GetDriver (STANDARD_TYPE(TNaming_NamedShape), aDriver);
+  Handle(BinMNaming_NamedShapeDriver) aShapesDriver = Handle(BinMNaming_NamedShapeDriver)::DownCast (aDriver);
+  if (aShapesDriver.IsNull())
+  {
+    throw Standard_NotImplemented ("Internal Error - TNaming_NamedShape is not found!");
+  }
+
+  aShapesDriver->SetCompactTriangulation (theIsCompact);
+}
+
 //=======================================================================
 //function : WriteShapeSection
 //purpose  : Implements WriteShapeSection
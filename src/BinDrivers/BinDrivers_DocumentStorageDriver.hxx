@@ -60,6 +60,14 @@ public:
   Standard_EXPORT void SetWithNormals(const Handle(Message_Messenger)& theMessageDriver,
                                          const Standard_Boolean theWithTriangulation);
 
+  //! Return true if triangulation should be stored in compact form.
+  Standard_EXPORT Standard_Boolean IsCompactTriangulation() const;
+
+  //! Set if triangulation should be stored in compact form (lossy, with quantized nodes);
+  //! requires document format version 11 or later.
+  Standard_EXPORT void SetCompactTriangulation (const Handle(Message_Messenger)& theMessageDriver,
+                                                const Standard_Boolean theIsCompact);
+
   //! Enables writing in the quick part access mode.
   Standard_EXPORT void EnableQuickPartWriting(const Handle(Message_Messenger)& theMessageDriver,
                                               const Standard_Boolean theValue) Standard_OVERRIDE;
@@ -147,6 +147,8 @@ BinMNaming_NamedShapeDriver::BinMNaming_NamedShapeDriver
        myShapeSet (NULL),
        myWithTriangles (Standard_False),
        myWithNormals  (Standard_False),
+       myIsCompactTriangulation (Standard_False),
+       myIsDeferredTriangulation (Standard_False),
        myIsQuickPart (Standard_False)
 {
 }
@@ -313,7 +315,10 @@ void BinMNaming_NamedShapeDriver::WriteShapeSection (Standard_OStream& theOS,
   theOS << SHAPESET;
   if (theDocVer >= TDocStd_FormatVersion_VERSION_11)
   {
-    ShapeSet (Standard_False)->SetFormatNb (BinTools_FormatVersion_VERSION_4);
+    // compact triangulation requires the format with tables of item sizes
+    ShapeSet (Standard_False)->SetFormatNb (myIsCompactTriangulation
+                                          ? BinTools_FormatVersion_VERSION_5
+                                          : BinTools_FormatVersion_VERSION_4);
   }
   else
   {
@@ -375,16 +380,46 @@ BinTools_ShapeSetBase* BinMNaming_NamedShapeDriver::ShapeSet (const Standard_Boo
       if (theReading)
         myShapeSet = new BinTools_ShapeReader();
       else
+      {
         myShapeSet = new BinTools_ShapeWriter();
+        // compact triangulation records are not known to readers of earlier formats
+        myShapeSet->SetFormatNb (myIsCompactTriangulation
+                               ? BinTools_FormatVersion_VERSION_5
+                               : BinTools_FormatVersion_CURRENT);
+      }
     }
     else
       myShapeSet = new BinTools_ShapeSet();
     myShapeSet->SetWithTriangles(myWithTriangles);
     myShapeSet->SetWithNormals(myWithNormals);
+    myShapeSet->SetCompactTriangulation (myIsCompactTriangulation);
+    myShapeSet->SetDeferredTriangulation (myIsDeferredTriangulation);
   }
   return myShapeSet;
 }
 
+//=======================================================================
+//function : SetCompactTriangulation
+//purpose  :
+//=======================================================================
+void BinMNaming_NamedShapeDriver::SetCompactTriangulation (const Standard_Boolean theIsCompact)
+{
+  myIsCompactTriangulation = theIsCompact;
+  if (myShapeSet)
+    myShapeSet->SetCompactTriangulation (theIsCompact);
+}
+
+//=======================================================================
+//function : SetDeferredTriangulation
+//purpose  :
+//=======================================================================
+void BinMNaming_NamedShapeDriver::SetDeferredTriangulation (const Standard_Boolean theIsDeferred)
+{
+  myIsDeferredTriangulation = theIsDeferred;
+  if (myShapeSet)
+    myShapeSet->SetDeferredTriangulation (theIsDeferred);
+}
+
 //=======================================================================
 //function : GetShapesLocations
 //purpose  : 
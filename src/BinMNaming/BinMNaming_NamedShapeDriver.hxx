@@ -69,6 +69,14 @@ public:
   void SetWithTriangles (const Standard_Boolean isWithTriangles);
   //! set whether to store triangulation with normals
   void SetWithNormals (const Standard_Boolean isWithNormals);
+  //! Return true if triangulation should be stored in compact form.
+  Standard_Boolean IsCompactTriangulation() const { return myIsCompactTriangulation; }
+  //! Set whether to store triangulation in compact form (see BinTools_CompactTriangulation).
+  Standard_EXPORT void SetCompactTriangulation (const Standard_Boolean theIsCompact);
+  //! Return true if compact triangulation should be decoded on demand on reading.
+  Standard_Boolean IsDeferredTriangulation() const { return myIsDeferredTriangulation; }
+  //! Set whether to keep compact triangulation encoded on reading until Poly_Triangulation::LoadDeferredData().
+  Standard_EXPORT void SetDeferredTriangulation (const Standard_Boolean theIsDeferred);
   //! get the shapes locations
   Standard_EXPORT BinTools_LocationSet& GetShapesLocations() const;
 
@@ -89,6 +97,8 @@ private:
   BinTools_ShapeSetBase *myShapeSet;
   Standard_Boolean myWithTriangles;
   Standard_Boolean myWithNormals;
+  Standard_Boolean myIsCompactTriangulation;
+  Standard_Boolean myIsDeferredTriangulation;
   //! Enables storing of whole shape data just in the attribute, not in a separated shapes section
   Standard_Boolean myIsQuickPart;
 
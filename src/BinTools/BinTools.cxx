@@ -179,10 +179,26 @@ void BinTools::Write (const TopoDS_Shape& theShape,
                       const Standard_Boolean theWithNormals,
                       const BinTools_FormatVersion theVersion,
                       const Message_ProgressRange& theRange)
+{
+  Write (theShape, theStream, theWithTriangles, theWithNormals, Standard_False, theVersion, theRange);
+}
+
+//=======================================================================
+//function : Write
+//purpose  :
+//=======================================================================
+void BinTools::Write (const TopoDS_Shape& theShape,
+                      Standard_OStream& theStream,
+                      const Standard_Boolean theWithTriangles,
+                      const Standard_Boolean theWithNormals,
+                      const Standard_Boolean theIsCompactTriangulation,
+                      const BinTools_FormatVersion theVersion,
+                      const Message_ProgressRange& theRange)
 {
   BinTools_ShapeSet aShapeSet;
   aShapeSet.SetWithTriangles(theWithTriangles);
   aShapeSet.SetWithNormals(theWithNormals);
+  aShapeSet.SetCompactTriangulation (theIsCompactTriangulation);
   aShapeSet.SetFormatNb (theVersion);
   aShapeSet.Add (theShape);
   aShapeSet.Write (theStream, theRange);
@@ -213,6 +229,21 @@ Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape,
                                   const Standard_Boolean theWithNormals,
                                   const BinTools_FormatVersion theVersion,
                                   const Message_ProgressRange& theRange)
+{
+  return Write (theShape, theFile, theWithTriangles, theWithNormals, Standard_False, theVersion, theRange);
+}
+
+//=======================================================================
+//function : Write
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape,
+                                  const Standard_CString theFile,
+                                  const Standard_Boolean theWithTriangles,
+                                  const Standard_Boolean theWithNormals,
+                                  const Standard_Boolean theIsCompactTriangulation,
+                                  const BinTools_FormatVersion theVersion,
+                                  const Message_ProgressRange& theRange)
 {
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::ostream> aStream = aFileSystem->OpenOStream (theFile, std::ios::out | std::ios::binary);
@@ -220,7 +251,7 @@ Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape,
   if (aStream.get() == NULL || !aStream->good())
     return Standard_False;
 
-  Write (theShape, *aStream, theWithTriangles, theWithNormals, theVersion, theRange);
+  Write (theShape, *aStream, theWithTriangles, theWithNormals, theIsCompactTriangulation, theVersion, theRange);
   aStream->flush();
   return aStream->good();
 }
@@ -82,6 +82,24 @@ public:
                                     const BinTools_FormatVersion theVersion,
                                     const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! Writes the shape to the stream in binary format of specified version.
+  //! @param theShape [in]         the shape to write
+  //! @param theStream [in][out]   the stream to output shape into
+  //! @param theWithTriangles [in] flag which specifies whether to save shape with (TRUE) or without (FALSE) triangles;
+  //!                              has no effect on triangulation-only geometry
+  //! @param theWithNormals [in]   flag which specifies whether to save triangulation with (TRUE) or without (FALSE) normals;
+  //!                              has no effect on triangulation-only geometry
+  //! @param theIsCompactTriangulation [in] flag which specifies whether to save triangulation in compact lossy form
+  //!                              (see BinTools_CompactTriangulation); requires BinTools_FormatVersion_VERSION_5 or later
+  //! @param theVersion [in]       the BinTools format version
+  //! @param theRange              the range of progress indicator to fill in
+  Standard_EXPORT static void Write (const TopoDS_Shape& theShape, Standard_OStream& theStream,
+                                     const Standard_Boolean theWithTriangles,
+                                     const Standard_Boolean theWithNormals,
+                                     const Standard_Boolean theIsCompactTriangulation,
+                                     const BinTools_FormatVersion theVersion,
+                                     const Message_ProgressRange& theRange = Message_ProgressRange());
+
   //! Reads a shape from <theStream> and returns it in <theShape>.
   Standard_EXPORT static void Read (TopoDS_Shape& theShape, Standard_IStream& theStream,
                                     const Message_ProgressRange& theRange = Message_ProgressRange());
@@ -114,6 +132,25 @@ public:
                                                  const BinTools_FormatVersion theVersion,
                                                  const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! Writes the shape to the file in binary format of specified version.
+  //! @param theShape [in]         the shape to write
+  //! @param theFile [in]          the path to file to output shape into
+  //! @param theWithTriangles [in] flag which specifies whether to save shape with (TRUE) or without (FALSE) triangles;
+  //!                              has no effect on triangulation-only geometry
+  //! @param theWithNormals [in]   flag which specifies whether to save triangulation with (TRUE) or without (FALSE) normals;
+  //!                              has no effect on triangulation-only geometry
+  //! @param theIsCompactTriangulation [in] flag which specifies whether to save triangulation in compact lossy form
+  //!                              (see BinTools_CompactTriangulation); requires BinTools_FormatVersion_VERSION_5 or later
+  //! @param theVersion [in]       the BinTools format version
+  //! @param theRange              the range of progress indicator to fill in
+  Standard_EXPORT static Standard_Boolean Write (const TopoDS_Shape& theShape,
+                                                 const Standard_CString theFile,
+                                                 const Standard_Boolean theWithTriangles,
+                                                 const Standard_Boolean theWithNormals,
+                                                 const Standard_Boolean theIsCompactTriangulation,
+                                                 const BinTools_FormatVersion theVersion,
+                                                 const Message_ProgressRange& theRange = Message_ProgressRange());
+
   //! Reads a shape from <theFile> and returns it in <theShape>.
   Standard_EXPORT static Standard_Boolean Read
     (TopoDS_Shape& theShape, const Standard_CString theFile,
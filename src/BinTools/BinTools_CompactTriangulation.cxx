@@ -0,0 +1,543 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_CompactTriangulation.hxx>
+
+#include <BinTools.hxx>
+#include <gp.hxx>
+#include <Standard_ProgramError.hxx>
+
+#include <string.h>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(BinTools_CompactTriangulation, Poly_Triangulation)
+
+namespace
+{
+  //! Version of encoded data layout.
+  static const Standard_Byte THE_ENCODING_VERSION = 1;
+
+  //! Flags of encoded data.
+  enum
+  {
+    BinTools_CompactFlag_UVNodes = 0x01,
+    BinTools_CompactFlag_Normals = 0x02
+  };
+
+  //! Maximum value of packed normal coordinate.
+  static const Standard_Real THE_NORMAL_SCALE = 32767.0;
+
+  //! Map signed integer to unsigned one with small absolute values mapped to small values.
+  inline uint64_t zigZagEncode (const int64_t theValue)
+  {
+    return (uint64_t(theValue) << 1) ^ uint64_t(theValue >> 63);
+  }
+
+  //! Inverse of zigZagEncode().
+  inline int64_t zigZagDecode (const uint64_t theValue)
+  {
+    return int64_t(theValue >> 1) ^ -int64_t(theValue & 1);
+  }
+
+  //! Auxiliary tool for encoding values into byte array.
+  class BinTools_CompactWriter
+  {
+  public:
+    BinTools_CompactWriter (std::vector<Standard_Byte>& theData) : myData (&theData) {}
+
+    void PutByte (const Standard_Byte theValue) { myData->push_back (theValue); }
+
+    //! Write unsigned value as LEB128 variable-length integer.
+    void PutVarUInt (uint64_t theValue)
+    {
+      while (theValue >= 0x80)
+      {
+        myData->push_back (Standard_Byte((theValue & 0x7F) | 0x80));
+        theValue >>= 7;
+      }
+      myData->push_back (Standard_Byte(theValue));
+    }
+
+    //! Write signed value as zig-zag LEB128 variable-length integer.
+    void PutVarInt (const int64_t theValue) { PutVarUInt (zigZagEncode (theValue)); }
+
+    //! Write real value as 8 bytes in little-endian order.
+    void PutReal (const Standard_Real theValue)
+    {
+      uint64_t aBits = 0;
+      memcpy (&aBits, &theValue, sizeof(aBits));
+      for (int aByteIter = 0; aByteIter < 8; ++aByteIter)
+      {
+        myData->push_back (Standard_Byte(aBits >> (aByteIter * 8)));
+      }
+    }
+
+  private:
+    std::vector<Standard_Byte>* myData;
+  };
+
+  //! Auxiliary tool for decoding values from byte array with range checks.
+  class BinTools_CompactReader
+  {
+  public:
+    BinTools_CompactReader (const Standard_Byte* theData, const Standard_Size theSize)
+    : myIter (theData), myEnd (theData + theSize), myHasFailed (false) {}
+
+    //! Return TRUE if reading went out of data range or data is corrupted.
+    bool HasFailed() const { return myHasFailed; }
+
+    //! Return number of bytes left to read.
+    Standard_Size NbBytesLeft() const { return Standard_Size(myEnd - myIter); }
+
+    Standard_Byte GetByte()
+    {
+      if (myIter >= myEnd)
+      {
+        myHasFailed = true;
+        return 0;
+      }
+      return *myIter++;
+    }
+
+    uint64_t GetVarUInt()
+    {
+      uint64_t aValue = 0;
+      for (int aShift = 0; aShift < 64; aShift += 7)
+      {
+        if (myIter >= myEnd)
+        {
+          myHasFailed = true;
+          return 0;
+        }
+        const Standard_Byte aByte = *myIter++;
+        aValue |= uint64_t(aByte & 0x7F) << aShift;
+        if ((aByte & 0x80) == 0)
+        {
+          return aValue;
+        }
+      }
+      myHasFailed = true;
+      return 0;
+    }
+
+    int64_t GetVarInt() { return zigZagDecode (GetVarUInt()); }
+
+    Standard_Real GetReal()
+    {
+      if (myEnd - myIter < 8)
+      {
+        myHasFailed = true;
+        return 0.0;
+      }
+      uint64_t aBits = 0;
+      for (int aByteIter = 0; aByteIter < 8; ++aByteIter)
+      {
+        aBits |= uint64_t(*myIter++) << (aByteIter * 8);
+      }
+      Standard_Real aValue = 0.0;
+      memcpy (&aValue, &aBits, sizeof(aValue));
+      return aValue;
+    }
+
+  private:
+    const Standard_Byte* myIter;
+    const Standard_Byte* myEnd;
+    bool                 myHasFailed;
+  };
+
+  //! Header of encoded data.
+  struct BinTools_CompactHeader
+  {
+    Standard_Byte    Flags;
+    Standard_Integer NbNodes;
+    Standard_Integer NbTriangles;
+    Standard_Real    Deflection;
+
+    BinTools_CompactHeader() : Flags (0), NbNodes (0), NbTriangles (0), Deflection (0.0) {}
+
+    //! Read header; returns FALSE if header is invalid.
+    bool Read (BinTools_CompactReader& theReader)
+    {
+      if (theReader.GetByte() != THE_ENCODING_VERSION)
+      {
+        return false;
+      }
+      Flags = theReader.GetByte();
+      const uint64_t aNbNodes = theReader.GetVarUInt();
+      const uint64_t aNbTris  = theReader.GetVarUInt();
+      Deflection = theReader.GetReal();
+      if (theReader.HasFailed()
+       || aNbNodes > uint64_t(IntegerLast())
+       || aNbTris  > uint64_t(IntegerLast()))
+      {
+        return false;
+      }
+
+      // each node and each triangle is encoded by at least 3 varints (1 byte each),
+      // so that corrupted counts are rejected before allocating arrays
+      if (aNbNodes * 3 + aNbTris * 3 > uint64_t(theReader.NbBytesLeft()))
+      {
+        return false;
+      }
+      NbNodes     = Standard_Integer(aNbNodes);
+      NbTriangles = Standard_Integer(aNbTris);
+      return true;
+    }
+  };
+
+  //! Pack unit vector into two octahedral coordinates.
+  static void packNormal (const gp_Vec3f& theNorm, int64_t& theX, int64_t& theY)
+  {
+    const Standard_Real aSum = Abs (theNorm.x()) + Abs (theNorm.y()) + Abs (theNorm.z());
+    Standard_Real anX = 0.0, anY = 0.0;
+    if (aSum > gp::Resolution())
+    {
+      anX = theNorm.x() / aSum;
+      anY = theNorm.y() / aSum;
+      if (theNorm.z() < 0.0)
+      {
+        const Standard_Real aFoldX = (1.0 - Abs (anY)) * (anX >= 0.0 ? 1.0 : -1.0);
+        const Standard_Real aFoldY = (1.0 - Abs (anX)) * (anY >= 0.0 ? 1.0 : -1.0);
+        anX = aFoldX;
+        anY = aFoldY;
+      }
+    }
+    theX = int64_t(Floor (anX * THE_NORMAL_SCALE + 0.5));
+    theY = int64_t(Floor (anY * THE_NORMAL_SCALE + 0.5));
+  }
+
+  //! Unpack unit vector from two octahedral coordinates.
+  static gp_Vec3f unpackNormal (const int64_t theX, const int64_t theY)
+  {
+    Standard_Real anX = Standard_Real(theX) / THE_NORMAL_SCALE;
+    Standard_Real anY = Standard_Real(theY) / THE_NORMAL_SCALE;
+    const Standard_Real aZ = 1.0 - Abs (anX) - Abs (anY);
+    if (aZ < 0.0)
+    {
+      const Standard_Real anUnfoldX = (1.0 - Abs (anY)) * (anX >= 0.0 ? 1.0 : -1.0);
+      const Standard_Real anUnfoldY = (1.0 - Abs (anX)) * (anY >= 0.0 ? 1.0 : -1.0);
+      anX = anUnfoldX;
+      anY = anUnfoldY;
+    }
+    gp_Vec3f aNorm ((float )anX, (float )anY, (float )aZ);
+    const float aModulus = aNorm.Modulus();
+    if (aModulus > 0.0f)
+    {
+      aNorm /= aModulus;
+    }
+    return aNorm;
+  }
+}
+
+// =======================================================================
+// function : Write
+// purpose  :
+// =======================================================================
+void BinTools_CompactTriangulation::Write (Standard_OStream& theStream,
+                                           const Handle(Poly_Triangulation)& theTriangulation,
+                                           const Standard_Boolean theToWriteNormals,
+                                           const Standard_Integer theNbPosBits)
+{
+  Standard_ProgramError_Raise_if (theNbPosBits < 8 || theNbPosBits > 30,
+                                  "BinTools_CompactTriangulation::Write() - number of position bits is out of range");
+
+  if (Handle(BinTools_CompactTriangulation) aCompact = Handle(BinTools_CompactTriangulation)::DownCast (theTriangulation))
+  {
+    if (!aCompact->HasGeometry()
+      && aCompact->HasDeferredData())
+    {
+      const Handle(NCollection_Buffer)& anEncoded = aCompact->EncodedData();
+      const bool hasEncodedNormals = anEncoded->Size() > 1
+                                  && (anEncoded->Data()[1] & BinTools_CompactFlag_Normals) != 0;
+      if (hasEncodedNormals && !theToWriteNormals)
+      {
+        // decode not yet loaded triangulation to write it without normals;
+        Handle(Poly_Triangulation) aDecoded = new Poly_Triangulation();
+        if (decode (anEncoded->Data(), anEncoded->Size(), aDecoded))
+        {
+          Write (theStream, aDecoded, Standard_False, theNbPosBits);
+          return;
+        }
+      }
+
+      // pass through encoded data of not yet loaded triangulation
+      BinTools::PutInteger (theStream, Standard_Integer(anEncoded->Size()));
+      theStream.write ((const char* )anEncoded->Data(), (std::streamsize )anEncoded->Size());
+      return;
+    }
+  }
+
+  const Standard_Integer aNbNodes     = theTriangulation->NbNodes();
+  const Standard_Integer aNbTriangles = theTriangulation->NbTriangles();
+  const bool hasUV      = theTriangulation->HasUVNodes();
+  const bool hasNormals = theToWriteNormals && theTriangulation->HasNormals();
+
+  std::vector<Standard_Byte> aData;
+  aData.reserve (64 + size_t(aNbNodes) * (hasUV ? 10 : 6) + size_t(aNbTriangles) * 4);
+  BinTools_CompactWriter aWriter (aData);
+  aWriter.PutByte (THE_ENCODING_VERSION);
+  aWriter.PutByte (Standard_Byte((hasUV      ? BinTools_CompactFlag_UVNodes : 0)
+                               | (hasNormals ? BinTools_CompactFlag_Normals : 0)));
+  aWriter.PutVarUInt (uint64_t(aNbNodes));
+  aWriter.PutVarUInt (uint64_t(aNbTriangles));
+  aWriter.PutReal (theTriangulation->Deflection());
+  if (aNbNodes > 0)
+  {
+    // quantize positions into the grid with the same step along all axes
+    gp_XYZ aMin = theTriangulation->Node (1).XYZ(), aMax = aMin;
+    for (Standard_Integer aNodeIter = 2; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      const gp_XYZ aNode = theTriangulation->Node (aNodeIter).XYZ();
+      aMin.SetCoord (Min (aMin.X(), aNode.X()), Min (aMin.Y(), aNode.Y()), Min (aMin.Z(), aNode.Z()));
+      aMax.SetCoord (Max (aMax.X(), aNode.X()), Max (aMax.Y(), aNode.Y()), Max (aMax.Z(), aNode.Z()));
+    }
+    const Standard_Real aMaxQuant = Standard_Real((1 << theNbPosBits) - 1);
+    const gp_XYZ aRange = aMax - aMin;
+    const Standard_Real aMaxRange = Max (aRange.X(), Max (aRange.Y(), aRange.Z()));
+    const Standard_Real aStep = aMaxRange > 0.0 ? aMaxRange / aMaxQuant : 1.0;
+    aWriter.PutReal (aMin.X());
+    aWriter.PutReal (aMin.Y());
+    aWriter.PutReal (aMin.Z());
+    aWriter.PutReal (aStep);
+    int64_t aPrev[3] = { 0, 0, 0 };
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      const gp_XYZ aNode = theTriangulation->Node (aNodeIter).XYZ() - aMin;
+      for (Standard_Integer aCompIter = 0; aCompIter < 3; ++aCompIter)
+      {
+        const int64_t aQuant = int64_t(Floor (aNode.GetData()[aCompIter] / aStep + 0.5));
+        aWriter.PutVarInt (aQuant - aPrev[aCompIter]);
+        aPrev[aCompIter] = aQuant;
+      }
+    }
+
+    if (hasUV)
+    {
+      // quantize UV nodes with individual step per axis
+      gp_XY aMinUV = theTriangulation->UVNode (1).XY(), aMaxUV = aMinUV;
+      for (Standard_Integer aNodeIter = 2; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        const gp_XY aUV = theTriangulation->UVNode (aNodeIter).XY();
+        aMinUV.SetCoord (Min (aMinUV.X(), aUV.X()), Min (aMinUV.Y(), aUV.Y()));
+        aMaxUV.SetCoord (Max (aMaxUV.X(), aUV.X()), Max (aMaxUV.Y(), aUV.Y()));
+      }
+      const gp_XY aRangeUV = aMaxUV - aMinUV;
+      const gp_XY aStepUV (aRangeUV.X() > 0.0 ? aRangeUV.X() / aMaxQuant : 1.0,
+                           aRangeUV.Y() > 0.0 ? aRangeUV.Y() / aMaxQuant : 1.0);
+      aWriter.PutReal (aMinUV.X());
+      aWriter.PutReal (aMinUV.Y());
+      aWriter.PutReal (aStepUV.X());
+      aWriter.PutReal (aStepUV.Y());
+      int64_t aPrevUV[2] = { 0, 0 };
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        const gp_XY aUV = theTriangulation->UVNode (aNodeIter).XY() - aMinUV;
+        const int64_t aQuantU = int64_t(Floor (aUV.X() / aStepUV.X() + 0.5));
+        const int64_t aQuantV = int64_t(Floor (aUV.Y() / aStepUV.Y() + 0.5));
+        aWriter.PutVarInt (aQuantU - aPrevUV[0]);
+        aWriter.PutVarInt (aQuantV - aPrevUV[1]);
+        aPrevUV[0] = aQuantU;
+        aPrevUV[1] = aQuantV;
+      }
+    }
+
+    if (hasNormals)
+    {
+      gp_Vec3f aNorm;
+      int64_t aPrevNorm[2] = { 0, 0 };
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        theTriangulation->Normal (aNodeIter, aNorm);
+        int64_t aPacked[2] = { 0, 0 };
+        packNormal (aNorm, aPacked[0], aPacked[1]);
+        aWriter.PutVarInt (aPacked[0] - aPrevNorm[0]);
+        aWriter.PutVarInt (aPacked[1] - aPrevNorm[1]);
+        aPrevNorm[0] = aPacked[0];
+        aPrevNorm[1] = aPacked[1];
+      }
+    }
+  }
+
+  Standard_Integer aPrevFirst = 0;
+  for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+  {
+    const Poly_Triangle aTri = theTriangulation->Triangle (aTriIter);
+    aWriter.PutVarInt (int64_t(aTri.Value (1)) - aPrevFirst);
+    aWriter.PutVarInt (int64_t(aTri.Value (2)) - aTri.Value (1));
+    aWriter.PutVarInt (int64_t(aTri.Value (3)) - aTri.Value (1));
+    aPrevFirst = aTri.Value (1);
+  }
+
+  BinTools::PutInteger (theStream, Standard_Integer(aData.size()));
+  theStream.write ((const char* )aData.data(), (std::streamsize )aData.size());
+}
+
+// =======================================================================
+// function : Read
+// purpose  :
+// =======================================================================
+Handle(Poly_Triangulation) BinTools_CompactTriangulation::Read (Standard_IStream& theStream,
+                                                                const Standard_Boolean theToDefer)
+{
+  Standard_Integer aSize = 0;
+  BinTools::GetInteger (theStream, aSize);
+  if (!theStream.good()
+    || aSize <= 0)
+  {
+    return Handle(Poly_Triangulation)();
+  }
+
+  Handle(NCollection_Buffer) aData = new NCollection_Buffer (NCollection_BaseAllocator::CommonBaseAllocator());
+  if (!aData->Allocate (Standard_Size(aSize))
+   || !theStream.read ((char* )aData->ChangeData(), aSize))
+  {
+    return Handle(Poly_Triangulation)();
+  }
+
+  if (theToDefer)
+  {
+    return new BinTools_CompactTriangulation (aData);
+  }
+
+  Handle(Poly_Triangulation) aResult = new Poly_Triangulation();
+  if (!decode (aData->Data(), aData->Size(), aResult))
+  {
+    return Handle(Poly_Triangulation)();
+  }
+  return aResult;
+}
+
+// =======================================================================
+// function : BinTools_CompactTriangulation
+// purpose  :
+// =======================================================================
+BinTools_CompactTriangulation::BinTools_CompactTriangulation (const Handle(NCollection_Buffer)& theData)
+: myData (theData),
+  myNbDefNodes (0),
+  myNbDefTriangles (0)
+{
+  BinTools_CompactReader aReader (theData->Data(), theData->Size());
+  BinTools_CompactHeader aHeader;
+  if (!aHeader.Read (aReader))
+  {
+    throw Standard_ProgramError ("BinTools_CompactTriangulation - invalid encoded data");
+  }
+  myNbDefNodes     = aHeader.NbNodes;
+  myNbDefTriangles = aHeader.NbTriangles;
+  myDeflection     = aHeader.Deflection;
+}
+
+// =======================================================================
+// function : loadDeferredData
+// purpose  :
+// =======================================================================
+Standard_Boolean BinTools_CompactTriangulation::loadDeferredData (const Handle(OSD_FileSystem)& ,
+                                                                  const Handle(Poly_Triangulation)& theDestTriangulation) const
+{
+  return !myData.IsNull()
+      && decode (myData->Data(), myData->Size(), theDestTriangulation);
+}
+
+// =======================================================================
+// function : decode
+// purpose  :
+// =======================================================================
+Standard_Boolean BinTools_CompactTriangulation::decode (const Standard_Byte* theData,
+                                                        const Standard_Size theSize,
+                                                        const Handle(Poly_Triangulation)& theDest)
+{
+  BinTools_CompactReader aReader (theData, theSize);
+  BinTools_CompactHeader aHeader;
+  if (!aHeader.Read (aReader))
+  {
+    return false;
+  }
+
+  const bool hasUV      = (aHeader.Flags & BinTools_CompactFlag_UVNodes) != 0;
+  const bool hasNormals = (aHeader.Flags & BinTools_CompactFlag_Normals) != 0;
+  theDest->Clear();
+  theDest->Deflection (aHeader.Deflection);
+  theDest->ResizeNodes (aHeader.NbNodes, false);
+  theDest->ResizeTriangles (aHeader.NbTriangles, false);
+  if (aHeader.NbNodes > 0)
+  {
+    gp_XYZ aMin;
+    aMin.SetX (aReader.GetReal());
+    aMin.SetY (aReader.GetReal());
+    aMin.SetZ (aReader.GetReal());
+    const Standard_Real aStep = aReader.GetReal();
+    int64_t aQuant[3] = { 0, 0, 0 };
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aHeader.NbNodes; ++aNodeIter)
+    {
+      aQuant[0] += aReader.GetVarInt();
+      aQuant[1] += aReader.GetVarInt();
+      aQuant[2] += aReader.GetVarInt();
+      theDest->SetNode (aNodeIter, gp_Pnt (aMin.X() + Standard_Real(aQuant[0]) * aStep,
+                                           aMin.Y() + Standard_Real(aQuant[1]) * aStep,
+                                           aMin.Z() + Standard_Real(aQuant[2]) * aStep));
+    }
+
+    if (hasUV)
+    {
+      theDest->AddUVNodes();
+      gp_XY aMinUV, aStepUV;
+      aMinUV.SetX  (aReader.GetReal());
+      aMinUV.SetY  (aReader.GetReal());
+      aStepUV.SetX (aReader.GetReal());
+      aStepUV.SetY (aReader.GetReal());
+      int64_t aQuantUV[2] = { 0, 0 };
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aHeader.NbNodes; ++aNodeIter)
+      {
+        aQuantUV[0] += aReader.GetVarInt();
+        aQuantUV[1] += aReader.GetVarInt();
+        theDest->SetUVNode (aNodeIter, gp_Pnt2d (aMinUV.X() + Standard_Real(aQuantUV[0]) * aStepUV.X(),
+                                                 aMinUV.Y() + Standard_Real(aQuantUV[1]) * aStepUV.Y()));
+      }
+    }
+
+    if (hasNormals)
+    {
+      theDest->AddNormals();
+      int64_t aPacked[2] = { 0, 0 };
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aHeader.NbNodes; ++aNodeIter)
+      {
+        aPacked[0] += aReader.GetVarInt();
+        aPacked[1] += aReader.GetVarInt();
+        theDest->SetNormal (aNodeIter, unpackNormal (aPacked[0], aPacked[1]));
+      }
+    }
+  }
+
+  int64_t aFirst = 0;
+  for (Standard_Integer aTriIter = 1; aTriIter <= aHeader.NbTriangles; ++aTriIter)
+  {
+    aFirst += aReader.GetVarInt();
+    const int64_t aSecond = aFirst + aReader.GetVarInt();
+    const int64_t aThird  = aFirst + aReader.GetVarInt();
+    if (aFirst  < 1 || aFirst  > aHeader.NbNodes
+     || aSecond < 1 || aSecond > aHeader.NbNodes
+     || aThird  < 1 || aThird  > aHeader.NbNodes)
+    {
+      theDest->Clear();
+      return false;
+    }
+    theDest->SetTriangle (aTriIter, Poly_Triangle (Standard_Integer(aFirst), Standard_Integer(aSecond), Standard_Integer(aThird)));
+  }
+
+  if (aReader.HasFailed())
+  {
+    theDest->Clear();
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_CompactTriangulation_HeaderFile
+#define _BinTools_CompactTriangulation_HeaderFile
+
+#include <NCollection_Buffer.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_IStream.hxx>
+#include <Standard_OStream.hxx>
+
+//! Compact binary encoding of triangulation and triangulation with deferred decoding of such data.
+//!
+//! Encoding is lossy and defined as following:
+//! - node positions are quantized into integer grid within triangulation bounding box
+//!   (with the same step along all axes) and written as variable-length deltas to previous node;
+//! - UV nodes are quantized in the same way within UV range (with individual step per axis);
+//! - normals are packed into two 16-bit octahedral coordinates;
+//! - triangle nodes are written as variable-length deltas to the first node of triangle
+//!   (and first node - as delta to first node of previous triangle).
+//! Encoded data is written with leading 32-bit size, so that it can be skipped or kept for deferred decoding.
+//!
+//! Object of this class keeps encoded data in memory and decodes it on LoadDeferredData(),
+//! so that it can be put into TopoDS_Face instead of decoded triangulation to postpone decoding
+//! until triangulation is actually needed (see BRepTools::LoadTriangulation()).
+class BinTools_CompactTriangulation : public Poly_Triangulation
+{
+  DEFINE_STANDARD_RTTIEXT(BinTools_CompactTriangulation, Poly_Triangulation)
+public:
+
+  //! Default number of bits for quantization of node positions.
+  static const Standard_Integer THE_DEFAULT_POSITION_BITS = 20;
+
+  //! Writes triangulation in compact form.
+  //! @param[in] theStream         output stream
+  //! @param[in] theTriangulation  triangulation to write
+  //! @param[in] theToWriteNormals write normals (when defined by triangulation);
+  //!                              not yet loaded BinTools_CompactTriangulation is written as is
+  //!                              unless its normals should be skipped
+  //! @param[in] theNbPosBits      number of quantization bits for node positions within [8, 30] range
+  Standard_EXPORT static void Write (Standard_OStream& theStream,
+                                     const Handle(Poly_Triangulation)& theTriangulation,
+                                     const Standard_Boolean theToWriteNormals,
+                                     const Standard_Integer theNbPosBits = THE_DEFAULT_POSITION_BITS);
+
+  //! Reads triangulation written by Write().
+  //! @param[in] theStream  input stream
+  //! @param[in] theToDefer when TRUE, returns BinTools_CompactTriangulation keeping encoded data for deferred decoding;
+  //!                       otherwise returns decoded Poly_Triangulation
+  //! @return triangulation or NULL on reading error
+  Standard_EXPORT static Handle(Poly_Triangulation) Read (Standard_IStream& theStream,
+                                                          const Standard_Boolean theToDefer);
+
+public:
+
+  //! Creates deferred triangulation from encoded data (without leading size).
+  //! Throws exception if data header is invalid.
+  Standard_EXPORT BinTools_CompactTriangulation (const Handle(NCollection_Buffer)& theData);
+
+  //! Returns encoded data.
+  const Handle(NCollection_Buffer)& EncodedData() const { return myData; }
+
+  //! Returns number of nodes for deferred loading.
+  virtual Standard_Integer NbDeferredNodes() const Standard_OVERRIDE { return myNbDefNodes; }
+
+  //! Returns number of triangles for deferred loading.
+  virtual Standard_Integer NbDeferredTriangles() const Standard_OVERRIDE { return myNbDefTriangles; }
+
+protected:
+
+  //! Decodes triangulation data from memory; file system is unused.
+  Standard_EXPORT virtual Standard_Boolean loadDeferredData (const Handle(OSD_FileSystem)& theFileSystem,
+                                                             const Handle(Poly_Triangulation)& theDestTriangulation) const Standard_OVERRIDE;
+
+  //! Decodes triangulation from encoded data into destination triangulation.
+  Standard_EXPORT static Standard_Boolean decode (const Standard_Byte* theData,
+                                                  const Standard_Size theSize,
+                                                  const Handle(Poly_Triangulation)& theDest);
+
+protected:
+
+  Handle(NCollection_Buffer) myData;
+  Standard_Integer           myNbDefNodes;
+  Standard_Integer           myNbDefTriangles;
+
+};
+
+#endif // _BinTools_CompactTriangulation_HeaderFile
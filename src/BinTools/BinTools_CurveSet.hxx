@@ -51,6 +51,9 @@ public:
   
   //! Returns the Curve of index <I>.
   Standard_EXPORT Handle(Geom_Curve) Curve (const Standard_Integer I) const;
+
+  //! Returns number of curves in the set.
+  Standard_Integer NbCurves() const { return myMap.Extent(); }
   
   //! Returns the index of <L>.
   Standard_EXPORT Standard_Integer Index (const Handle(Geom_Curve)& C) const;
@@ -26,13 +26,15 @@ enum BinTools_FormatVersion
   BinTools_FormatVersion_VERSION_4 = 4, //!< Stores per-vertex normal information in case
                                         //!  of triangulation-only Faces, because
                                         //!  no analytical geometry to restore normals
+  BinTools_FormatVersion_VERSION_5 = 5, //!< Writes table of item sizes in front of curves, surfaces and
+                                        //!  triangulations sections, so that their items can be decoded in parallel
   BinTools_FormatVersion_CURRENT = BinTools_FormatVersion_VERSION_4 //!< Current version
 };
 
 enum
 {
   BinTools_FormatVersion_LOWER   = BinTools_FormatVersion_VERSION_1,
-  BinTools_FormatVersion_UPPER   = BinTools_FormatVersion_VERSION_4
+  BinTools_FormatVersion_UPPER   = BinTools_FormatVersion_VERSION_5
 };
 
 #endif
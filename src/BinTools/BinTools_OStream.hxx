@@ -37,6 +37,10 @@ public:
   Standard_EXPORT void WriteReference (const uint64_t& thePosition);
   //! Writes an identifier of shape type and orientation into the stream.
   Standard_EXPORT void WriteShape (const TopAbs_ShapeEnum& theType, const TopAbs_Orientation& theOrientation);
+  //! Returns the original OStream.
+  Standard_OStream& Stream() { return *myStream; }
+  //! Makes up to date the myPosition because myStream was used outside and position is changed.
+  void UpdatePosition() { myPosition = uint64_t (myStream->tellp()); }
 
 
   //! Writes an object type to the stream.
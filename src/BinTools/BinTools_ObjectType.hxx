@@ -38,6 +38,7 @@ enum BinTools_ObjectType
   BinTools_ObjectType_EmptyPolygonOnTriangulation,
   BinTools_ObjectType_Triangulation,
   BinTools_ObjectType_EmptyTriangulation,
+  BinTools_ObjectType_CompactTriangulation, //!< triangulation encoded by BinTools_CompactTriangulation
   BinTools_ObjectType_EmptyShape = 198, //!< identifier of the null shape
   BinTools_ObjectType_EndShape = 199, //!< identifier of the shape record end
   // here is the space for TopAbs_ShapeEnum+Orientation types
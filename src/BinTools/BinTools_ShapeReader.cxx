@@ -12,6 +12,7 @@
 // commercial license or contractual agreement.
 
 #include <BinTools_ShapeReader.hxx>
+#include <BinTools_CompactTriangulation.hxx>
 
 #include <BinTools_Curve2dSet.hxx>
 #include <BinTools_CurveSet.hxx>
@@ -598,5 +599,15 @@ Handle(Poly_Triangulation) BinTools_ShapeReader::ReadTriangulation (BinTools_ISt
 
     myTriangulationPos.Bind (aPosition, aResult);
   }
+  else if (aType == BinTools_ObjectType_CompactTriangulation)
+  {
+    aResult = BinTools_CompactTriangulation::Read (theStream.Stream(), IsDeferredTriangulation());
+    theStream.UpdatePosition();
+    if (aResult.IsNull())
+    {
+      throw Standard_Failure ("BinTools_ShapeReader::Read: invalid compact triangulation");
+    }
+    myTriangulationPos.Bind (aPosition, aResult);
+  }
   return aResult;
 }
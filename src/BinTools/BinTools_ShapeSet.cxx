@@ -15,6 +15,7 @@
 
 
 #include <BinTools.hxx>
+#include <BinTools_CompactTriangulation.hxx>
 #include <BinTools_Curve2dSet.hxx>
 #include <BinTools_ShapeSet.hxx>
 #include <BinTools_SurfaceSet.hxx>
@@ -34,6 +35,9 @@
 #include <BRep_Tool.hxx>
 #include <BRep_TVertex.hxx>
 #include <BRepTools.hxx>
+#include <Geom2d_Curve.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
 #include <Poly_Polygon3D.hxx>
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Triangulation.hxx>
@@ -45,9 +49,461 @@
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <Message_ProgressRange.hxx>
+#include <NCollection_Buffer.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ArrayStreamBuffer.hxx>
 
+#include <atomic>
 #include <string.h>
 
+namespace
+{
+  //! Write triangulation data.
+  static void writeTriangulation (Standard_OStream& theStream,
+                                  const Handle(Poly_Triangulation)& theTriangulation,
+                                  const Standard_Boolean theToWriteNormals,
+                                  const Standard_Boolean theHasNormalsFlag)
+  {
+    const Standard_Integer aNbNodes     = theTriangulation->NbNodes();
+    const Standard_Integer aNbTriangles = theTriangulation->NbTriangles();
+    BinTools::PutInteger(theStream, aNbNodes);
+    BinTools::PutInteger(theStream, aNbTriangles);
+    BinTools::PutBool(theStream, theTriangulation->HasUVNodes() ? 1 : 0);
+    if (theHasNormalsFlag)
+    {
+      BinTools::PutBool(theStream, (theTriangulation->HasNormals() && theToWriteNormals) ? 1 : 0);
+    }
+    BinTools::PutReal(theStream, theTriangulation->Deflection());
+
+    // write the 3d nodes
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      const gp_Pnt aPnt = theTriangulation->Node (aNodeIter);
+      BinTools::PutReal(theStream, aPnt.X());
+      BinTools::PutReal(theStream, aPnt.Y());
+      BinTools::PutReal(theStream, aPnt.Z());
+    }
+
+    if (theTriangulation->HasUVNodes())
+    {
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        const gp_Pnt2d aUV = theTriangulation->UVNode (aNodeIter);
+        BinTools::PutReal(theStream, aUV.X());
+        BinTools::PutReal(theStream, aUV.Y());
+      }
+    }
+
+    for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+    {
+      const Poly_Triangle aTri = theTriangulation->Triangle (aTriIter);
+      BinTools::PutInteger(theStream, aTri.Value (1));
+      BinTools::PutInteger(theStream, aTri.Value (2));
+      BinTools::PutInteger(theStream, aTri.Value (3));
+    }
+
+    // write the normals
+    if (theHasNormalsFlag
+     && theTriangulation->HasNormals()
+     && theToWriteNormals)
+    {
+      gp_Vec3f aNormal;
+      for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+      {
+        theTriangulation->Normal (aNormalIter, aNormal);
+        BinTools::PutShortReal (theStream, aNormal.x());
+        BinTools::PutShortReal (theStream, aNormal.y());
+        BinTools::PutShortReal (theStream, aNormal.z());
+      }
+    }
+  }
+
+  //! Read triangulation data.
+  static Handle(Poly_Triangulation) readTriangulation (Standard_IStream& theStream,
+                                                       const Standard_Boolean theHasNormalsFlag,
+                                                       Standard_Boolean& theHasNormals)
+  {
+    Standard_Integer aNbNodes = 0, aNbTriangles = 0;
+    Standard_Boolean hasUV = Standard_False;
+    Standard_Real aDefl = 0.0;
+    theHasNormals = Standard_False;
+    BinTools::GetInteger(theStream, aNbNodes);
+    BinTools::GetInteger(theStream, aNbTriangles);
+    BinTools::GetBool(theStream, hasUV);
+    if (theHasNormalsFlag)
+    {
+      BinTools::GetBool(theStream, theHasNormals);
+    }
+    BinTools::GetReal(theStream, aDefl); //deflection
+    Handle(Poly_Triangulation) aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, theHasNormals);
+    aTriangulation->Deflection (aDefl);
+
+    gp_Pnt aNode;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      BinTools::GetReal(theStream, aNode.ChangeCoord().ChangeCoord (1));
+      BinTools::GetReal(theStream, aNode.ChangeCoord().ChangeCoord (2));
+      BinTools::GetReal(theStream, aNode.ChangeCoord().ChangeCoord (3));
+      aTriangulation->SetNode (aNodeIter, aNode);
+    }
+
+    if (hasUV)
+    {
+      gp_Pnt2d aNode2d;
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        BinTools::GetReal(theStream, aNode2d.ChangeCoord().ChangeCoord (1));
+        BinTools::GetReal(theStream, aNode2d.ChangeCoord().ChangeCoord (2));
+        aTriangulation->SetUVNode (aNodeIter, aNode2d);
+      }
+    }
+
+    // read the triangles
+    Standard_Integer aTriNodes[3] = {};
+    for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+    {
+      BinTools::GetInteger(theStream, aTriNodes[0]);
+      BinTools::GetInteger(theStream, aTriNodes[1]);
+      BinTools::GetInteger(theStream, aTriNodes[2]);
+      aTriangulation->SetTriangle (aTriIter, Poly_Triangle (aTriNodes[0], aTriNodes[1], aTriNodes[2]));
+    }
+
+    if (theHasNormals)
+    {
+      gp_Vec3f aNormal;
+      for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+      {
+        BinTools::GetShortReal(theStream, aNormal.x());
+        BinTools::GetShortReal(theStream, aNormal.y());
+        BinTools::GetShortReal(theStream, aNormal.z());
+        aTriangulation->SetNormal (aNormalIter, aNormal);
+      }
+    }
+    return aTriangulation;
+  }
+
+  //! Triangulation item of the section.
+  struct BinTools_TriangulationItem
+  {
+    Handle(Poly_Triangulation) Triangulation;
+    Standard_Boolean           HasNormals;
+    Standard_Boolean           IsCompact;  //!< item is encoded by BinTools_CompactTriangulation
+    Standard_Boolean           ToDefer;    //!< keep compact item encoded on reading
+
+    BinTools_TriangulationItem() : HasNormals (Standard_False), IsCompact (Standard_False), ToDefer (Standard_False) {}
+  };
+
+  //! Section item readers.
+  static void readSectionItem (Standard_IStream& theStream, Handle(Geom2d_Curve)& theItem) { BinTools_Curve2dSet::ReadCurve2d (theStream, theItem); }
+  static void readSectionItem (Standard_IStream& theStream, Handle(Geom_Curve)& theItem)   { BinTools_CurveSet::ReadCurve (theStream, theItem); }
+  static void readSectionItem (Standard_IStream& theStream, Handle(Geom_Surface)& theItem) { BinTools_SurfaceSet::ReadSurface (theStream, theItem); }
+  static void readSectionItem (Standard_IStream& theStream, BinTools_TriangulationItem& theItem)
+  {
+    if (theItem.IsCompact)
+    {
+      theItem.Triangulation = BinTools_CompactTriangulation::Read (theStream, theItem.ToDefer);
+      if (theItem.Triangulation.IsNull())
+      {
+        throw Standard_Failure ("BinTools_ShapeSet::Read: invalid compact triangulation");
+      }
+      theItem.HasNormals = theItem.Triangulation->HasNormals();
+      return;
+    }
+    theItem.Triangulation = readTriangulation (theStream, Standard_True, theItem.HasNormals);
+  }
+
+  //! Functor decoding items of the section in parallel threads.
+  template<class TheItem>
+  class SectionDecodingFunctor
+  {
+  public:
+    SectionDecodingFunctor (const char* theData,
+                            const NCollection_Array1<Standard_Size>& theOffsets,
+                            NCollection_Array1<TheItem>& theItems)
+    : myData (theData), myOffsets (&theOffsets), myItems (&theItems), myHasFailed (false) {}
+
+    //! Return TRUE if decoding of some item has failed.
+    bool HasFailed() const { return myHasFailed; }
+
+    void operator() (Standard_Integer theIndex) const
+    {
+      const Standard_Size anOffset = myOffsets->Value (theIndex - 1);
+      Standard_ArrayStreamBuffer aStreamBuffer (myData + anOffset, myOffsets->Value (theIndex) - anOffset);
+      std::istream aStream (&aStreamBuffer);
+      try
+      {
+        readSectionItem (aStream, myItems->ChangeValue (theIndex));
+      }
+      catch (Standard_Failure const&)
+      {
+        myHasFailed = true;
+      }
+    }
+
+  private:
+    const char*                              myData;
+    const NCollection_Array1<Standard_Size>* myOffsets;
+    NCollection_Array1<TheItem>*             myItems;
+    mutable std::atomic<bool>                myHasFailed;
+  };
+
+  //! Read header of section (BinTools_FormatVersion_VERSION_5).
+  //! @param[in] theStream  input stream
+  //! @param[out] theName   section name
+  //! @return number of items within section
+  static Standard_Integer readSectionHeader (Standard_IStream& theStream,
+                                             TCollection_AsciiString& theName)
+  {
+    char aHeader[255];
+    theStream >> aHeader;
+    if (theStream.fail())
+    {
+      throw Standard_Failure ("BinTools_ShapeSet::Read: unexpected end of geometry section");
+    }
+    theName = aHeader;
+
+    Standard_Integer aNbItems = 0;
+    theStream >> aNbItems;
+    theStream.get(); // remove LF
+    return aNbItems;
+  }
+
+  //! Read items of section (BinTools_FormatVersion_VERSION_5) which starts with the table of item sizes,
+  //! and decode them in parallel.
+  //! @param[in] theStream    input stream
+  //! @param[in] theName      section name
+  //! @param[in] theNbItems   number of items within section
+  //! @param[out] theItems    decoded items
+  //! @param[in] theInitItem  initial value of items defining decoding parameters
+  template<class TheItem>
+  static void readIndexedSectionItems (Standard_IStream& theStream,
+                                       const TCollection_AsciiString& theName,
+                                       const Standard_Integer theNbItems,
+                                       NCollection_Array1<TheItem>& theItems,
+                                       const TheItem& theInitItem = TheItem())
+  {
+    if (theNbItems <= 0)
+    {
+      return;
+    }
+
+    NCollection_Array1<Standard_Size> anOffsets (0, theNbItems);
+    anOffsets.SetValue (0, 0);
+    for (Standard_Integer anItemIter = 1; anItemIter <= theNbItems; ++anItemIter)
+    {
+      Standard_Integer anItemSize = 0;
+      BinTools::GetInteger (theStream, anItemSize);
+      if (anItemSize < 0)
+      {
+        throw Standard_Failure ((TCollection_AsciiString ("BinTools_ShapeSet::Read: corrupted ") + theName + " section").ToCString());
+      }
+      anOffsets.SetValue (anItemIter, anOffsets.Value (anItemIter - 1) + (Standard_Size )anItemSize);
+    }
+
+    // read the whole section at once and decode items from memory;
+    // section size is a sum of 32-bit item sizes and may exceed 2 GiB
+    const Standard_Size aDataSize = anOffsets.Last();
+    NCollection_Buffer aData (NCollection_BaseAllocator::CommonBaseAllocator());
+    if (aDataSize > 0
+     && (!aData.Allocate (aDataSize)
+      || !theStream.read ((char* )aData.ChangeData(), (std::streamsize )aDataSize)))
+    {
+      throw Standard_Failure ((TCollection_AsciiString ("BinTools_ShapeSet::Read: unexpected end of ") + theName + " section").ToCString());
+    }
+
+    theItems.Resize (1, theNbItems, false);
+    theItems.Init (theInitItem);
+    SectionDecodingFunctor<TheItem> aFunctor ((const char* )aData.Data(), anOffsets, theItems);
+    OSD_Parallel::For (1, theNbItems + 1, aFunctor);
+    if (aFunctor.HasFailed())
+    {
+      throw Standard_Failure ((TCollection_AsciiString ("BinTools_ShapeSet::Read: failed to decode ") + theName + " section").ToCString());
+    }
+  }
+
+  //! Read section (BinTools_FormatVersion_VERSION_5) which starts with the table of item sizes,
+  //! and decode its items in parallel.
+  //! @param[in] theStream  input stream
+  //! @param[in] theName    section name
+  //! @param[out] theItems  decoded items
+  template<class TheItem>
+  static void readIndexedSection (Standard_IStream& theStream,
+                                  const char* theName,
+                                  NCollection_Array1<TheItem>& theItems)
+  {
+    TCollection_AsciiString aName;
+    const Standard_Integer aNbItems = readSectionHeader (theStream, aName);
+    if (aName != theName)
+    {
+      throw Standard_Failure ((TCollection_AsciiString ("BinTools_ShapeSet::Read: Not a ") + theName + " section").ToCString());
+    }
+    readIndexedSectionItems (theStream, aName, aNbItems, theItems);
+  }
+
+  //! Collect geometry of the set into array.
+  static void collectSectionItems (const BinTools_Curve2dSet& theSet, NCollection_Array1<Handle(Geom2d_Curve)>& theItems)
+  {
+    if (theSet.NbCurves2d() > 0)
+    {
+      theItems.Resize (1, theSet.NbCurves2d(), false);
+      for (Standard_Integer anIter = 1; anIter <= theSet.NbCurves2d(); ++anIter)
+      {
+        theItems.SetValue (anIter, theSet.Curve2d (anIter));
+      }
+    }
+  }
+  static void collectSectionItems (const BinTools_CurveSet& theSet, NCollection_Array1<Handle(Geom_Curve)>& theItems)
+  {
+    if (theSet.NbCurves() > 0)
+    {
+      theItems.Resize (1, theSet.NbCurves(), false);
+      for (Standard_Integer anIter = 1; anIter <= theSet.NbCurves(); ++anIter)
+      {
+        theItems.SetValue (anIter, theSet.Curve (anIter));
+      }
+    }
+  }
+  static void collectSectionItems (const BinTools_SurfaceSet& theSet, NCollection_Array1<Handle(Geom_Surface)>& theItems)
+  {
+    if (theSet.NbSurfaces() > 0)
+    {
+      theItems.Resize (1, theSet.NbSurfaces(), false);
+      for (Standard_Integer anIter = 1; anIter <= theSet.NbSurfaces(); ++anIter)
+      {
+        theItems.SetValue (anIter, theSet.Surface (anIter));
+      }
+    }
+  }
+
+  //! Section item writers.
+  static void writeSectionItem (Standard_OStream& theStream, const Handle(Geom2d_Curve)& theItem)
+  {
+    BinTools_OStream aStream (theStream);
+    BinTools_Curve2dSet::WriteCurve2d (theItem, aStream);
+  }
+  static void writeSectionItem (Standard_OStream& theStream, const Handle(Geom_Curve)& theItem)
+  {
+    BinTools_OStream aStream (theStream);
+    BinTools_CurveSet::WriteCurve (theItem, aStream);
+  }
+  static void writeSectionItem (Standard_OStream& theStream, const Handle(Geom_Surface)& theItem)
+  {
+    BinTools_OStream aStream (theStream);
+    BinTools_SurfaceSet::WriteSurface (theItem, aStream);
+  }
+  static void writeSectionItem (Standard_OStream& theStream, const BinTools_TriangulationItem& theItem)
+  {
+    if (theItem.IsCompact)
+    {
+      BinTools_CompactTriangulation::Write (theStream, theItem.Triangulation, theItem.HasNormals);
+      return;
+    }
+    writeTriangulation (theStream, theItem.Triangulation, theItem.HasNormals, Standard_True);
+  }
+
+  //! Stream buffer counting the number of written bytes without storing them.
+  class SizeCounterStreamBuffer : public std::streambuf
+  {
+  public:
+    SizeCounterStreamBuffer() : mySize (0) {}
+
+    //! Return the number of written bytes.
+    uint64_t Size() const { return mySize; }
+
+  protected:
+    virtual std::streamsize xsputn (const char* , std::streamsize theCount) Standard_OVERRIDE
+    {
+      mySize += (uint64_t )theCount;
+      return theCount;
+    }
+    virtual int_type overflow (int_type theChar) Standard_OVERRIDE
+    {
+      if (!traits_type::eq_int_type (theChar, traits_type::eof()))
+      {
+        ++mySize;
+      }
+      return traits_type::not_eof (theChar);
+    }
+
+  private:
+    uint64_t mySize;
+  };
+
+  //! Check that the size of encoded item fits the table of sizes.
+  static Standard_Integer checkedItemSize (const uint64_t theSize, const char* theName)
+  {
+    if (theSize > (uint64_t )IntegerLast())
+    {
+      throw Standard_Failure ((TCollection_AsciiString ("BinTools_ShapeSet::Write: too large item in ") + theName + " section").ToCString());
+    }
+    return (Standard_Integer )theSize;
+  }
+
+  //! Write section (BinTools_FormatVersion_VERSION_5) with the table of item sizes in front of items data.
+  //! @param[in] theStream output stream
+  //! @param[in] theName   section name
+  //! @param[in] theItems  items to write
+  template<class TheItem>
+  static void writeIndexedSection (Standard_OStream& theStream,
+                                   const char* theName,
+                                   const NCollection_Array1<TheItem>& theItems)
+  {
+    const Standard_Integer aNbItems = theItems.IsEmpty() ? 0 : theItems.Size();
+    theStream << theName << " " << aNbItems << "\n";
+    if (aNbItems == 0)
+    {
+      return;
+    }
+
+    // items are written directly to the stream after the table of sizes
+    // filled with zeros, which is then patched with the actual sizes;
+    // in case of not seekable stream the sizes are computed by preliminary dry run
+    NCollection_Array1<Standard_Integer> aSizes (1, aNbItems);
+    const std::streampos aTablePos = theStream.tellp();
+    const Standard_Boolean isSeekable = aTablePos != std::streampos (-1);
+    if (!isSeekable)
+    {
+      for (Standard_Integer anItemIter = 1; anItemIter <= aNbItems; ++anItemIter)
+      {
+        SizeCounterStreamBuffer aCounter;
+        std::ostream aCounterStream (&aCounter);
+        writeSectionItem (aCounterStream, theItems.Value (theItems.Lower() + anItemIter - 1));
+        aSizes.ChangeValue (anItemIter) = checkedItemSize (aCounter.Size(), theName);
+      }
+    }
+    else
+    {
+      aSizes.Init (0);
+    }
+
+    for (Standard_Integer anItemIter = 1; anItemIter <= aNbItems; ++anItemIter)
+    {
+      BinTools::PutInteger (theStream, aSizes.Value (anItemIter));
+    }
+    for (Standard_Integer anItemIter = 1; anItemIter <= aNbItems; ++anItemIter)
+    {
+      const std::streampos anItemPos = theStream.tellp();
+      writeSectionItem (theStream, theItems.Value (theItems.Lower() + anItemIter - 1));
+      if (isSeekable)
+      {
+        aSizes.ChangeValue (anItemIter) = checkedItemSize ((uint64_t )(theStream.tellp() - anItemPos), theName);
+      }
+    }
+    if (!isSeekable)
+    {
+      return;
+    }
+
+    const std::streampos aSectionEnd = theStream.tellp();
+    theStream.seekp (aTablePos);
+    for (Standard_Integer anItemIter = 1; anItemIter <= aNbItems; ++anItemIter)
+    {
+      BinTools::PutInteger (theStream, aSizes.Value (anItemIter));
+    }
+    theStream.seekp (aSectionEnd);
+  }
+}
+
 //=======================================================================
 //function : BinTools_ShapeSet
 //purpose  :
@@ -268,6 +724,54 @@ void  BinTools_ShapeSet::WriteGeometry (Standard_OStream& OS,
                                         const Message_ProgressRange& theRange)const
 {
   Message_ProgressScope aPS(theRange, "Writing geometry", 6);
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    // curves, surfaces and triangulations are written with tables of item sizes
+    NCollection_Array1<Handle(Geom2d_Curve)> aCurves2d;
+    collectSectionItems (myCurves2d, aCurves2d);
+    writeIndexedSection (OS, "Curve2ds", aCurves2d);
+    aPS.Next();
+    if (!aPS.More())
+      return;
+
+    NCollection_Array1<Handle(Geom_Curve)> aCurves;
+    collectSectionItems (myCurves, aCurves);
+    writeIndexedSection (OS, "Curves", aCurves);
+    aPS.Next();
+    if (!aPS.More())
+      return;
+
+    WritePolygon3D(OS, aPS.Next());
+    if (!aPS.More())
+      return;
+    WritePolygonOnTriangulation(OS, aPS.Next());
+    if (!aPS.More())
+      return;
+
+    NCollection_Array1<Handle(Geom_Surface)> aSurfaces;
+    collectSectionItems (mySurfaces, aSurfaces);
+    writeIndexedSection (OS, "Surfaces", aSurfaces);
+    aPS.Next();
+    if (!aPS.More())
+      return;
+
+    NCollection_Array1<BinTools_TriangulationItem> aTriangulations;
+    if (!myTriangulations.IsEmpty())
+    {
+      aTriangulations.Resize (1, myTriangulations.Extent(), false);
+      for (Standard_Integer aTriIter = 1; aTriIter <= myTriangulations.Extent(); ++aTriIter)
+      {
+        BinTools_TriangulationItem& anItem = aTriangulations.ChangeValue (aTriIter);
+        anItem.Triangulation = myTriangulations.FindKey (aTriIter);
+        anItem.HasNormals    = myTriangulations.FindFromIndex (aTriIter);
+        anItem.IsCompact     = IsCompactTriangulation();
+      }
+    }
+    writeIndexedSection (OS, IsCompactTriangulation() ? "CompactTriangulations" : "Triangulations", aTriangulations);
+    aPS.Next();
+    return;
+  }
+
   myCurves2d.Write(OS, aPS.Next());
   if (!aPS.More())
     return;
@@ -532,6 +1036,67 @@ void BinTools_ShapeSet::ReadGeometry (Standard_IStream& IS,
 {
 
   Message_ProgressScope aPS(theRange, "Reading geometry", 6);
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    // items of curves, surfaces and triangulations sections are decoded in parallel
+    NCollection_Array1<Handle(Geom2d_Curve)> aCurves2d;
+    readIndexedSection (IS, "Curve2ds", aCurves2d);
+    for (NCollection_Array1<Handle(Geom2d_Curve)>::Iterator anIter (aCurves2d); anIter.More(); anIter.Next())
+    {
+      myCurves2d.Add (anIter.Value());
+    }
+    aPS.Next();
+    if (!aPS.More())
+      return;
+
+    NCollection_Array1<Handle(Geom_Curve)> aCurves;
+    readIndexedSection (IS, "Curves", aCurves);
+    for (NCollection_Array1<Handle(Geom_Curve)>::Iterator anIter (aCurves); anIter.More(); anIter.Next())
+    {
+      myCurves.Add (anIter.Value());
+    }
+    aPS.Next();
+    if (!aPS.More())
+      return;
+
+    ReadPolygon3D(IS, aPS.Next());
+    if (!aPS.More())
+      return;
+    ReadPolygonOnTriangulation(IS, aPS.Next());
+    if (!aPS.More())
+      return;
+
+    NCollection_Array1<Handle(Geom_Surface)> aSurfaces;
+    readIndexedSection (IS, "Surfaces", aSurfaces);
+    for (NCollection_Array1<Handle(Geom_Surface)>::Iterator anIter (aSurfaces); anIter.More(); anIter.Next())
+    {
+      mySurfaces.Add (anIter.Value());
+    }
+    aPS.Next();
+    if (!aPS.More())
+      return;
+
+    // triangulations section is written either in compact or in regular form
+    TCollection_AsciiString aTriSectionName;
+    const Standard_Integer aNbTriangulations = readSectionHeader (IS, aTriSectionName);
+    BinTools_TriangulationItem aTriInitItem;
+    aTriInitItem.IsCompact = aTriSectionName == "CompactTriangulations";
+    aTriInitItem.ToDefer   = aTriInitItem.IsCompact && IsDeferredTriangulation();
+    if (!aTriInitItem.IsCompact
+      && aTriSectionName != "Triangulations")
+    {
+      throw Standard_Failure ("BinTools_ShapeSet::Read: Not a Triangulations section");
+    }
+    NCollection_Array1<BinTools_TriangulationItem> aTriangulations;
+    readIndexedSectionItems (IS, aTriSectionName, aNbTriangulations, aTriangulations, aTriInitItem);
+    for (NCollection_Array1<BinTools_TriangulationItem>::Iterator anIter (aTriangulations); anIter.More(); anIter.Next())
+    {
+      myTriangulations.Add (anIter.Value().Triangulation, anIter.Value().HasNormals);
+    }
+    aPS.Next();
+    return;
+  }
+
   myCurves2d.Read(IS, aPS.Next());
   if (!aPS.More())
     return;
@@ -1433,61 +1998,9 @@ void BinTools_ShapeSet::WriteTriangulation (Standard_OStream& OS,
     Message_ProgressScope aPS(theRange, "Writing triangulation", aNbTriangulations);
     for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More(); ++aTriangulationIter, aPS.Next())
     {
-      const Handle(Poly_Triangulation)& aTriangulation = myTriangulations.FindKey (aTriangulationIter);
-      Standard_Boolean NeedToWriteNormals = myTriangulations.FindFromIndex(aTriangulationIter);
-      const Standard_Integer aNbNodes     = aTriangulation->NbNodes();
-      const Standard_Integer aNbTriangles = aTriangulation->NbTriangles();
-      BinTools::PutInteger(OS, aNbNodes);
-      BinTools::PutInteger(OS, aNbTriangles);
-      BinTools::PutBool(OS, aTriangulation->HasUVNodes() ? 1 : 0);
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
-      {
-        BinTools::PutBool(OS, (aTriangulation->HasNormals() && NeedToWriteNormals) ? 1 : 0);
-      }
-      BinTools::PutReal(OS, aTriangulation->Deflection());
-
-      // write the 3d nodes
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      {
-        const gp_Pnt aPnt = aTriangulation->Node (aNodeIter);
-        BinTools::PutReal(OS, aPnt.X());
-        BinTools::PutReal(OS, aPnt.Y());
-        BinTools::PutReal(OS, aPnt.Z());
-      }
-
-      if (aTriangulation->HasUVNodes())
-      {
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          const gp_Pnt2d aUV = aTriangulation->UVNode (aNodeIter);
-          BinTools::PutReal(OS, aUV.X());
-          BinTools::PutReal(OS, aUV.Y());
-        }
-      }
-
-      for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
-      {
-        const Poly_Triangle aTri = aTriangulation->Triangle (aTriIter);
-        BinTools::PutInteger(OS, aTri.Value (1));
-        BinTools::PutInteger(OS, aTri.Value (2));
-        BinTools::PutInteger(OS, aTri.Value (3));
-      }
-
-      // write the normals
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
-      {
-        if (aTriangulation->HasNormals() && NeedToWriteNormals)
-        {
-          gp_Vec3f aNormal;
-          for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
-          {
-            aTriangulation->Normal (aNormalIter, aNormal);
-            BinTools::PutShortReal (OS, aNormal.x());
-            BinTools::PutShortReal (OS, aNormal.y());
-            BinTools::PutShortReal (OS, aNormal.z());
-          }
-        }
-      }
+      writeTriangulation (OS, myTriangulations.FindKey (aTriangulationIter),
+                          myTriangulations.FindFromIndex (aTriangulationIter),
+                          FormatNb() >= BinTools_FormatVersion_VERSION_4);
     }
   }
   catch (Standard_Failure const& anException)
@@ -1522,64 +2035,8 @@ void BinTools_ShapeSet::ReadTriangulation (Standard_IStream& IS,
     Message_ProgressScope aPS(theRange, "Reading triangulation", aNbTriangulations);
     for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More(); ++aTriangulationIter, aPS.Next())
     {
-      Standard_Integer aNbNodes = 0, aNbTriangles = 0;
-      Standard_Boolean hasUV = Standard_False;
       Standard_Boolean hasNormals = Standard_False;
-      Standard_Real aDefl = 0.0;
-      BinTools::GetInteger(IS, aNbNodes);
-      BinTools::GetInteger(IS, aNbTriangles);
-      BinTools::GetBool(IS, hasUV);
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
-      {
-        BinTools::GetBool(IS, hasNormals);
-      }
-      BinTools::GetReal(IS, aDefl); //deflection
-      Handle(Poly_Triangulation) aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
-      aTriangulation->Deflection (aDefl);
-
-      gp_Pnt aNode;
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      {
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (1));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (2));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (3));
-        aTriangulation->SetNode (aNodeIter, aNode);
-      }
-
-      if (hasUV)
-      {
-        gp_Pnt2d aNode2d;
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (1));
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (2));
-          aTriangulation->SetUVNode (aNodeIter, aNode2d);
-        }
-      }
-
-      // read the triangles
-      Standard_Integer aTriNodes[3] = {};
-      for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
-      {
-        BinTools::GetInteger(IS, aTriNodes[0]);
-        BinTools::GetInteger(IS, aTriNodes[1]);
-        BinTools::GetInteger(IS, aTriNodes[2]);
-        aTriangulation->SetTriangle (aTriIter, Poly_Triangle (aTriNodes[0], aTriNodes[1], aTriNodes[2]));
-      }
-      //IS.ignore(sizeof(Standard_Real) * (hasUV ? 5 : 3) * aNbNodes + sizeof(Standard_Integer) * 3 * aNbTriangles);
-
-      if (hasNormals)
-      {
-        gp_Vec3f aNormal;
-        for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
-        {
-          BinTools::GetShortReal(IS, aNormal.x());
-          BinTools::GetShortReal(IS, aNormal.y());
-          BinTools::GetShortReal(IS, aNormal.z());
-          aTriangulation->SetNormal (aNormalIter, aNormal);
-        }
-      }
-
+      Handle(Poly_Triangulation) aTriangulation = readTriangulation (IS, FormatNb() >= BinTools_FormatVersion_VERSION_4, hasNormals);
       myTriangulations.Add (aTriangulation, hasNormals);
     }
   }
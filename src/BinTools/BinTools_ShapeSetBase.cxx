@@ -21,7 +21,8 @@ const Standard_CString BinTools_ShapeSetBase::THE_ASCII_VERSIONS[BinTools_Format
   "Open CASCADE Topology V1 (c)",
   "Open CASCADE Topology V2 (c)",
   "Open CASCADE Topology V3 (c)",
-  "Open CASCADE Topology V4, (c) Open Cascade"
+  "Open CASCADE Topology V4, (c) Open Cascade",
+  "Open CASCADE Topology V5, (c) Open Cascade"
 };
 
 //=======================================================================
@@ -44,7 +45,9 @@ Standard_OStream& operator << (Standard_OStream& OS, const gp_Pnt& P)
 BinTools_ShapeSetBase::BinTools_ShapeSetBase()
   : myFormatNb (BinTools_FormatVersion_CURRENT),
     myWithTriangles (Standard_False),
-    myWithNormals (Standard_False)
+    myWithNormals (Standard_False),
+    myIsCompactTriangulation (Standard_False),
+    myIsDeferredTriangulation (Standard_False)
 {}
 
 //=======================================================================
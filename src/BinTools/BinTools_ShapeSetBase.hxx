@@ -54,6 +54,18 @@ public:
   //! Ignored (always written) if face defines only triangulation (no surface).
   void SetWithNormals(const Standard_Boolean theWithNormals) { myWithNormals = theWithNormals; }
 
+  //! Return true if triangulation should be stored in compact form (see BinTools_CompactTriangulation).
+  Standard_Boolean IsCompactTriangulation() const { return myIsCompactTriangulation; }
+  //! Define if triangulation should be stored in compact form (lossy, with quantized nodes);
+  //! FALSE by default. Requires format BinTools_FormatVersion_VERSION_5 or later, ignored by earlier versions.
+  void SetCompactTriangulation (const Standard_Boolean theIsCompact) { myIsCompactTriangulation = theIsCompact; }
+
+  //! Return true if compact triangulation should be decoded on demand.
+  Standard_Boolean IsDeferredTriangulation() const { return myIsDeferredTriangulation; }
+  //! Define if compact triangulation should be kept encoded on reading
+  //! and decoded only on Poly_Triangulation::LoadDeferredData() call; FALSE by default.
+  void SetDeferredTriangulation (const Standard_Boolean theIsDeferred) { myIsDeferredTriangulation = theIsDeferred; }
+
   //! Sets the BinTools_FormatVersion.
   Standard_EXPORT void SetFormatNb (const Standard_Integer theFormatNb);
 
@@ -107,6 +119,8 @@ private:
   Standard_Integer myFormatNb;
   Standard_Boolean myWithTriangles;
   Standard_Boolean myWithNormals;
+  Standard_Boolean myIsCompactTriangulation;
+  Standard_Boolean myIsDeferredTriangulation;
 };
 
 #endif // _BinTools_ShapeSet_HeaderFile
@@ -12,6 +12,7 @@
 // commercial license or contractual agreement.
 
 #include <BinTools_ShapeWriter.hxx>
+#include <BinTools_CompactTriangulation.hxx>
 #include <BinTools_LocationSet.hxx>
 
 #include <TopoDS.hxx>
@@ -465,6 +466,14 @@ void BinTools_ShapeWriter::WriteTriangulation (BinTools_OStream& theStream,
     return;
   }
   myTriangulationPos.Bind (theTriangulation, theStream.Position());
+  if (IsCompactTriangulation()
+   && FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    theStream << BinTools_ObjectType_CompactTriangulation;
+    BinTools_CompactTriangulation::Write (theStream.Stream(), theTriangulation, theNeedToWriteNormals);
+    theStream.UpdatePosition();
+    return;
+  }
   theStream << BinTools_ObjectType_Triangulation;
 
   const Standard_Integer aNbNodes = theTriangulation->NbNodes();
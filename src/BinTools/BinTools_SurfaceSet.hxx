@@ -51,6 +51,9 @@ public:
   
   //! Returns the Surface of index <I>.
   Standard_EXPORT Handle(Geom_Surface) Surface (const Standard_Integer I) const;
+
+  //! Returns number of surfaces in the set.
+  Standard_Integer NbSurfaces() const { return myMap.Extent(); }
   
   //! Returns the index of <L>.
   Standard_EXPORT Standard_Integer Index (const Handle(Geom_Surface)& S) const;
@@ -23,6 +23,7 @@
 #include <BRepTools_ShapeSet.hxx>
 #include <BRepTools_WireExplorer.hxx>
 #include <BinTools.hxx>
+#include <BinTools_ShapeSet.hxx>
 #include <DBRep_DrawableShape.hxx>
 #include <Draw_Appli.hxx>
 #include <Draw_ProgressIndicator.hxx>
@@ -1440,6 +1441,7 @@ static Standard_Integer writebrep (Draw_Interpretor& theDI,
   Standard_Boolean isBinaryFormat(Standard_False);
   Standard_Boolean isWithTriangles(Standard_True);
   Standard_Boolean isWithNormals(Standard_False);
+  Standard_Boolean isCompactTriangulation(Standard_False);
   if (!strcasecmp (theArgVec[0], "binsave"))
   {
     isBinaryFormat = Standard_True;
@@ -1477,6 +1479,10 @@ static Standard_Integer writebrep (Draw_Interpretor& theDI,
         isWithNormals = !isWithNormals;
       }
     }
+    else if (aParam == "-compact")
+    {
+      isCompactTriangulation = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
     else if (aShapeName.IsEmpty())
     {
       aShapeName = theArgVec[anArgIter];
@@ -1519,10 +1525,19 @@ static Standard_Integer writebrep (Draw_Interpretor& theDI,
       return 1;
     }
 
+    if (isCompactTriangulation
+     && aVersion > 0
+     && aVersion < BinTools_FormatVersion_VERSION_5)
+    {
+      theDI << "Error: compact triangulation requires binary format version 5 or later";
+      return 1;
+    }
+
     BinTools_FormatVersion aBinToolsVersion = aVersion > 0
                                             ? static_cast<BinTools_FormatVersion> (aVersion)
-                                            : BinTools_FormatVersion_CURRENT;
-    if (!BinTools::Write (aShape, aFileName.ToCString(), isWithTriangles, isWithNormals, aBinToolsVersion, aProgress->Start()))
+                                            : (isCompactTriangulation ? BinTools_FormatVersion_VERSION_5 : BinTools_FormatVersion_CURRENT);
+    if (!BinTools::Write (aShape, aFileName.ToCString(), isWithTriangles, isWithNormals,
+                          isCompactTriangulation, aBinToolsVersion, aProgress->Start()))
     {
       theDI << "Cannot write to the file " << aFileName;
       return 1;
@@ -1530,6 +1545,11 @@ static Standard_Integer writebrep (Draw_Interpretor& theDI,
   }
   else
   {
+    if (isCompactTriangulation)
+    {
+      theDI << "Error: compact triangulation is supported only by binary format";
+      return 1;
+    }
     if (aVersion > TopTools_FormatVersion_UPPER)
     {
       theDI << "Syntax error: unknown format version";
@@ -1563,14 +1583,37 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
                                   Standard_Integer theNbArgs,
                                   const char** theArgVec)
 {
-  if (theNbArgs != 3)
+  Standard_CString aFileName  = NULL;
+  Standard_CString aShapeName = NULL;
+  bool isDeferredTriangulation = false;
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString aParam (theArgVec[anArgIter]);
+    aParam.LowerCase();
+    if (aParam == "-deferred")
+    {
+      isDeferredTriangulation = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aFileName == NULL)
+    {
+      aFileName = theArgVec[anArgIter];
+    }
+    else if (aShapeName == NULL)
+    {
+      aShapeName = theArgVec[anArgIter];
+    }
+    else
+    {
+      theDI << "Syntax error: unknown argument '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aShapeName == NULL)
   {
     theDI << "Syntax error: wrong number of arguments";
     return 1;
   }
 
-  Standard_CString aFileName  = theArgVec[1];
-  Standard_CString aShapeName = theArgVec[2];
   bool isBinaryFormat = true;
   {
     // probe file header to recognize format
@@ -1594,7 +1637,29 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
 
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator (theDI);
   TopoDS_Shape aShape;
-  if (isBinaryFormat)
+  if (isBinaryFormat
+   && isDeferredTriangulation)
+  {
+    const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+    std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (aFileName, std::ios::in | std::ios::binary);
+    if (aStream.get() == NULL)
+    {
+      theDI << "Error: cannot read from the file '" << aFileName << "'";
+      return 1;
+    }
+
+    BinTools_ShapeSet aShapeSet;
+    aShapeSet.SetWithTriangles (Standard_True);
+    aShapeSet.SetDeferredTriangulation (Standard_True);
+    aShapeSet.Read (*aStream, aProgress->Start());
+    aShapeSet.ReadSubs (aShape, *aStream, aShapeSet.NbShapes());
+    if (!aStream->good())
+    {
+      theDI << "Error: cannot read from the file '" << aFileName << "'";
+      return 1;
+    }
+  }
+  else if (isBinaryFormat)
   {
     if (!BinTools::Read (aShape, aFileName, aProgress->Start()))
     {
@@ -1604,6 +1669,11 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
   }
   else
   {
+    if (isDeferredTriangulation)
+    {
+      theDI << "Error: deferred triangulation is supported only by binary format";
+      return 1;
+    }
     if (!BRepTools::Read (aShape, aFileName, BRep_Builder(), aProgress->Start()))
     {
       theDI << "Error: cannot read from the file '" << aFileName << "'";
@@ -1718,19 +1788,24 @@ void  DBRep::BasicCommands(Draw_Interpretor& theCommands)
                    __FILE__, XProgress,"DE: General");
   theCommands.Add("writebrep",
                   "writebrep shape filename [-binary {0|1}]=0 [-version Version]=4"
-                  "\n\t\t:                          [-triangles {0|1}]=1 [-normals {0|1}]=0"
+                  "\n\t\t:                          [-triangles {0|1}]=1 [-normals {0|1}]=0 [-compact {0|1}]=0"
                   "\n\t\t: Save the shape in the ASCII (default) or binary format file."
                   "\n\t\t:  -binary  write into the binary format (ASCII when unspecified)"
                   "\n\t\t:  -version a number of format version to save;"
                   "\n\t\t:           ASCII  versions: 1, 2 and 3    (3 for ASCII  when unspecified);"
-                  "\n\t\t:           Binary versions: 1, 2, 3 and 4 (4 for Binary when unspecified)."
+                  "\n\t\t:           Binary versions: 1, 2, 3, 4 and 5 (4 for Binary when unspecified);"
+                  "\n\t\t:           binary version 5 allows parallel decoding of geometry on reading."
                   "\n\t\t:  -triangles write triangulation data (TRUE when unspecified)."
                   "\n\t\t:           Ignored (always written) if face defines only triangulation (no surface)."
-                  "\n\t\t:  -normals include vertex normals while writing triangulation data (FALSE when unspecified).",
+                  "\n\t\t:  -normals include vertex normals while writing triangulation data (FALSE when unspecified)."
+                  "\n\t\t:  -compact write triangulation in compact lossy form with quantized nodes (FALSE when unspecified);"
+                  "\n\t\t:           requires binary format version 5 (used when version is unspecified).",
                   __FILE__, writebrep, g);
   theCommands.Add("readbrep",
-                  "readbrep filename shape"
-                  "\n\t\t: Restore the shape from the binary or ASCII format file.",
+                  "readbrep filename shape [-deferred {0|1}]=0"
+                  "\n\t\t: Restore the shape from the binary or ASCII format file."
+                  "\n\t\t:  -deferred keep triangulation written in compact form encoded until it is loaded"
+                  "\n\t\t:            (see command trlateload).",
                   __FILE__, readbrep, g);
   theCommands.Add("binsave", "binsave shape filename", __FILE__, writebrep, g);
   theCommands.Add("binrestore",
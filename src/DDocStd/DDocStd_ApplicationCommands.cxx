@@ -14,6 +14,7 @@
 // commercial license or contractual agreement.
 
 #include <DDocStd.hxx>
+#include <BinDrivers_DocumentRetrievalDriver.hxx>
 #include <Draw_Interpretor.hxx>
 #include <Draw_Viewer.hxx>
 #include <Draw_ProgressIndicator.hxx>
@@ -29,6 +30,7 @@
 #include <PCDM_ReaderFilter.hxx>
 
 #include <OSD_FileSystem.hxx>
+#include <Standard_ErrorHandler.hxx>
 #include <TDocStd_PathParser.hxx>
 
 #include <AIS_InteractiveContext.hxx>
@@ -111,6 +113,34 @@ static Standard_Integer DDocStd_NewDocument (Draw_Interpretor& di,
   return 1;
 }
 
+//=======================================================================
+//function : setDeferredTriangulation
+//purpose  : Setup BinOcaf/BinXCAF retrieval drivers to decode compact triangulation on demand
+//=======================================================================
+static void setDeferredTriangulation (const Handle(TDocStd_Application)& theApp,
+                                      const Standard_Boolean theIsDeferred)
+{
+  const char* aFormats[2] = { "BinOcaf", "BinXCAF" };
+  for (Standard_Integer aFormatIter = 0; aFormatIter < 2; ++aFormatIter)
+  {
+    Handle(BinDrivers_DocumentRetrievalDriver) aDriver;
+    try
+    {
+      OCC_CATCH_SIGNALS
+      aDriver = Handle(BinDrivers_DocumentRetrievalDriver)::DownCast (theApp->ReaderFromFormat (aFormats[aFormatIter]));
+    }
+    catch (Standard_Failure const&)
+    {
+      // the format is not registered
+      continue;
+    }
+    if (!aDriver.IsNull())
+    {
+      aDriver->SetDeferredTriangulation (theApp->MessageDriver(), theIsDeferred);
+    }
+  }
+}
+
 //=======================================================================
 //function : Open
 //purpose  : 
@@ -128,6 +158,7 @@ static Standard_Integer DDocStd_Open (Draw_Interpretor& di,
     PCDM_ReaderStatus theStatus;
 
     Standard_Boolean anUseStream = Standard_False;
+    Standard_Boolean isDeferredTriangulation = Standard_False;
     Handle(PCDM_ReaderFilter) aFilter = new PCDM_ReaderFilter;
     for ( Standard_Integer i = 3; i < nb; i++ )
     {
@@ -145,6 +176,10 @@ static Standard_Integer DDocStd_Open (Draw_Interpretor& di,
         di << "standard SEEKABLE stream is used\n";
         anUseStream = Standard_True;
       }
+      else if (anArg == "-deferredTriangulation")
+      {
+        isDeferredTriangulation = Standard_True;
+      }
       else if (anArg.StartsWith("-skip"))
       {
         TCollection_AsciiString anAttrType = anArg.SubString(6, anArg.Length());
@@ -170,6 +205,10 @@ static Standard_Integer DDocStd_Open (Draw_Interpretor& di,
       return 1;
     }
     Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
+    if (isDeferredTriangulation)
+    {
+      setDeferredTriangulation (A, Standard_True);
+    }
     if (anUseStream)
     {
       const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
@@ -181,6 +220,10 @@ static Standard_Integer DDocStd_Open (Draw_Interpretor& di,
     {
       theStatus = A->Open (path, D, aFilter , aProgress->Start());
     }
+    if (isDeferredTriangulation)
+    {
+      setDeferredTriangulation (A, Standard_False);
+    }
     if (theStatus == PCDM_RS_OK && !D.IsNull())
     {
       if (!aFilter->IsAppendMode())
@@ -608,9 +651,10 @@ void DDocStd::ApplicationCommands(Draw_Interpretor& theCommands)
 		  __FILE__, DDocStd_NewDocument, g);  
 
   theCommands.Add("Open",
-		  "Open path docname [-stream] [-skipAttribute] [-readAttribute] [-readPath] [-append|-overwrite]"
+		  "Open path docname [-stream] [-skipAttribute] [-readAttribute] [-readPath] [-append|-overwrite] [-deferredTriangulation]"
        "\n\t\t The options are:"
        "\n\t\t   -stream : opens path as a stream"
+       "\n\t\t   -deferredTriangulation : keep compact triangulation of binary document encoded until it is loaded (see trlateload)"
        "\n\t\t   -skipAttribute : class name of the attribute to skip during open, for example -skipTDF_Reference"
        "\n\t\t   -readAttribute : class name of the attribute to read only during open, for example -readTDataStd_Name loads only such attributes"
        "\n\t\t   -append : to read file into already existing document once again, append new attributes and don't touch existing"
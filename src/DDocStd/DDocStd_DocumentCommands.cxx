@@ -457,6 +457,18 @@ static Standard_Integer DDocStd_StoreTriangulation (Draw_Interpretor& theDi,
       theDi << (aDriverXCaf->IsWithNormals() ? "1" : "0");
       continue;
     }
+    if (aParam == "-compact")
+    {
+      const Standard_Boolean isCompact = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+      aDriverXCaf->SetCompactTriangulation (anApp->MessageDriver(), isCompact);
+      aDriverOcaf->SetCompactTriangulation (anApp->MessageDriver(), isCompact);
+      continue;
+    }
+    if (aParam == "-getcompact")
+    {
+      theDi << (aDriverXCaf->IsCompactTriangulation() ? "1" : "0");
+      continue;
+    }
   }
   return 0;
 }
@@ -493,9 +505,10 @@ void DDocStd::DocumentCommands(Draw_Interpretor& theCommands)
 		   __FILE__, DDocStd_DumpDocument, g);   
 
   theCommands.Add ("StoreTriangulation",
-                   "StoreTriangulation [toStore={0|1}] [-normals=off] [-noNormals=on]"
+                   "StoreTriangulation [toStore={0|1}] [-normals=off] [-noNormals=on] [-compact {0|1}]=0"
                    "\n\t\t:  -normals -noNormals write triangulation normals."
                    "\n\t\t:  Ignored (always off) if toStore=0 or skipped"
+                   "\n\t\t:  -compact write triangulation in compact lossy form with quantized nodes."
                    "\nSetup BinXCAF/BinOcaf storage drivers to write triangulation",
                    __FILE__, DDocStd_StoreTriangulation, g);
 
@@ -54,12 +54,16 @@
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
 #include <Precision.hxx>
+#include <NCollection_Array1.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NullObject.hxx>
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
+#include <algorithm>
+
 static const Standard_Real PosTol = Precision::PConfusion()*0.5;
 
 IMPLEMENT_STANDARD_RTTIEXT(GeomAdaptor_Surface, Adaptor3d_Surface)
@@ -803,6 +807,145 @@ void GeomAdaptor_Surface::D1(const Standard_Real U,
   }
 }
 
+//=======================================================================
+//function : D0Batch
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D0Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                   TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionMismatch_Raise_if (thePoints.Length() != theUVs.Length(),
+                                       "GeomAdaptor_Surface::D0Batch: wrong size of the output array");
+  const Standard_Integer aShift = thePoints.Lower() - theUVs.Lower();
+  switch (mySurfaceType)
+  {
+  case GeomAbs_BezierSurface:
+  case GeomAbs_BSplineSurface:
+  {
+    NCollection_Array1<Standard_Integer> anOrder (theUVs.Lower(), theUVs.Upper());
+    orderBySpans (theUVs, anOrder);
+    for (Standard_Integer i = anOrder.Lower(); i <= anOrder.Upper(); ++i)
+    {
+      const Standard_Integer anIndex = anOrder (i);
+      const gp_Pnt2d& aUV = theUVs (anIndex);
+      if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid (aUV.X(), aUV.Y()))
+        RebuildCache (aUV.X(), aUV.Y());
+      mySurfaceCache->D0 (aUV.X(), aUV.Y(), thePoints (anIndex + aShift));
+    }
+    break;
+  }
+
+  case GeomAbs_OffsetSurface:
+  case GeomAbs_SurfaceOfExtrusion:
+  case GeomAbs_SurfaceOfRevolution:
+    Standard_NoSuchObject_Raise_if(myNestedEvaluator.IsNull(),
+        "GeomAdaptor_Surface::D0Batch: evaluator is not initialized");
+    for (Standard_Integer i = theUVs.Lower(); i <= theUVs.Upper(); ++i)
+    {
+      myNestedEvaluator->D0 (theUVs (i).X(), theUVs (i).Y(), thePoints (i + aShift));
+    }
+    break;
+
+  default:
+    for (Standard_Integer i = theUVs.Lower(); i <= theUVs.Upper(); ++i)
+    {
+      mySurface->D0 (theUVs (i).X(), theUVs (i).Y(), thePoints (i + aShift));
+    }
+  }
+}
+
+//=======================================================================
+//function : D1Batch
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D1Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                   TColgp_Array1OfPnt&         thePoints,
+                                   TColgp_Array1OfVec&         theD1U,
+                                   TColgp_Array1OfVec&         theD1V) const
+{
+  if (mySurfaceType != GeomAbs_BezierSurface &&
+      mySurfaceType != GeomAbs_BSplineSurface)
+  {
+    Adaptor3d_Surface::D1Batch (theUVs, thePoints, theD1U, theD1V);
+    return;
+  }
+
+  Standard_DimensionMismatch_Raise_if (thePoints.Length() != theUVs.Length() ||
+                                       theD1U.Length()    != theUVs.Length() ||
+                                       theD1V.Length()    != theUVs.Length(),
+                                       "GeomAdaptor_Surface::D1Batch: wrong size of the output arrays");
+  const Standard_Integer aShiftP = thePoints.Lower() - theUVs.Lower();
+  const Standard_Integer aShiftU = theD1U.Lower()    - theUVs.Lower();
+  const Standard_Integer aShiftV = theD1V.Lower()    - theUVs.Lower();
+
+  NCollection_Array1<Standard_Integer> anOrder (theUVs.Lower(), theUVs.Upper());
+  orderBySpans (theUVs, anOrder);
+  for (Standard_Integer i = anOrder.Lower(); i <= anOrder.Upper(); ++i)
+  {
+    const Standard_Integer anIndex = anOrder (i);
+    const Standard_Real aU = theUVs (anIndex).X();
+    const Standard_Real aV = theUVs (anIndex).Y();
+    if (Abs (aU - myUFirst) <= myTolU || Abs (aU - myULast) <= myTolU ||
+        Abs (aV - myVFirst) <= myTolV || Abs (aV - myVLast) <= myTolV)
+    {
+      // the points on the boundaries need special treatment
+      GeomAdaptor_Surface::D1 (aU, aV, thePoints (anIndex + aShiftP),
+                               theD1U (anIndex + aShiftU), theD1V (anIndex + aShiftV));
+      continue;
+    }
+
+    if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid (aU, aV))
+      RebuildCache (aU, aV);
+    mySurfaceCache->D1 (aU, aV, thePoints (anIndex + aShiftP),
+                        theD1U (anIndex + aShiftU), theD1V (anIndex + aShiftV));
+  }
+}
+
+//=======================================================================
+//function : orderBySpans
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::orderBySpans (const TColgp_Array1OfPnt2d&           theUVs,
+                                        NCollection_Array1<Standard_Integer>& theOrder) const
+{
+  for (Standard_Integer i = theUVs.Lower(); i <= theUVs.Upper(); ++i)
+  {
+    theOrder (i) = i;
+  }
+  if (myBSplineSurface.IsNull() || theUVs.Length() < 2)
+  {
+    // single span
+    return;
+  }
+
+  // Sort the points by the knot spans containing them keeping the initial order
+  // of the points inside of the span. Location of the spans is approximate
+  // (e.g. for periodic surfaces), it only reduces the number of cache rebuilds.
+  const TColStd_Array1OfReal& aUKnots = myBSplineSurface->UKnots();
+  const TColStd_Array1OfReal& aVKnots = myBSplineSurface->VKnots();
+  NCollection_Array1<Standard_Integer> aSpans (theUVs.Lower(), theUVs.Upper());
+  for (Standard_Integer i = theUVs.Lower(); i <= theUVs.Upper(); ++i)
+  {
+    Standard_Integer aUSpan = 0, aVSpan = 0;
+    BSplCLib::Hunt (aUKnots, theUVs (i).X(), aUSpan);
+    BSplCLib::Hunt (aVKnots, theUVs (i).Y(), aVSpan);
+    aSpans (i) = aUSpan * (aVKnots.Length() + 1) + aVSpan;
+  }
+
+  struct SpanComparator
+  {
+    const NCollection_Array1<Standard_Integer>& Spans;
+    bool operator() (const Standard_Integer theIndex1, const Standard_Integer theIndex2) const
+    {
+      return Spans (theIndex1) < Spans (theIndex2);
+    }
+  } aComparator = { aSpans };
+  std::stable_sort (theOrder.begin(), theOrder.end(), aComparator);
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -172,6 +172,20 @@ public:
   //! the derivatives are computed on the current interval.
   //! else the derivatives are computed on the basis surface.
   Standard_EXPORT void D3 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV, gp_Vec& D3U, gp_Vec& D3V, gp_Vec& D3UUV, gp_Vec& D3UVV) const Standard_OVERRIDE;
+
+  //! Computes the points of the surface for the array of parameters.
+  //! For B-spline surfaces the points are evaluated span by span,
+  //! so that the cache is built only once per span for the whole array.
+  Standard_EXPORT void D0Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                TColgp_Array1OfPnt&         thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the surface for the array of parameters.
+  //! For B-spline surfaces the points are evaluated span by span,
+  //! so that the cache is built only once per span for the whole array.
+  Standard_EXPORT void D1Batch (const TColgp_Array1OfPnt2d& theUVs,
+                                TColgp_Array1OfPnt&         thePoints,
+                                TColgp_Array1OfVec&         theD1U,
+                                TColgp_Array1OfVec&         theD1V) const Standard_OVERRIDE;
   
   //! Computes the derivative of order Nu in the
   //! direction U and Nv in the direction V at the point P(U, V).
@@ -260,6 +274,11 @@ private:
   //! \param theV second parameter to identify the span for caching
   Standard_EXPORT void RebuildCache (const Standard_Real theU, const Standard_Real theV) const;
 
+  //! Fills the order of evaluation of the array of parameters
+  //! grouping the parameters lying in the same B-spline span.
+  Standard_EXPORT void orderBySpans (const TColgp_Array1OfPnt2d&           theUVs,
+                                     NCollection_Array1<Standard_Integer>& theOrder) const;
+
   protected:
 
   Handle(Geom_Surface) mySurface;
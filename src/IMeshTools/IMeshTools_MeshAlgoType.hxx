@@ -20,6 +20,8 @@ enum IMeshTools_MeshAlgoType
   IMeshTools_MeshAlgoType_DEFAULT = -1, //!< use global default (IMeshTools_MeshAlgoType_Watson or CSF_MeshAlgo)
   IMeshTools_MeshAlgoType_Watson  = 0,  //!< generate 2D Delaunay triangulation based on Watson algorithm (BRepMesh_MeshAlgoFactory)
   IMeshTools_MeshAlgoType_Delabella,    //!< generate 2D Delaunay triangulation based on Delabella algorithm (BRepMesh_DelabellaMeshAlgoFactory)
+  IMeshTools_MeshAlgoType_Structured,   //!< generate structured grids on the faces with rectangular parametric domain (BRepMesh_StructuredMeshAlgoFactory)
+  IMeshTools_MeshAlgoType_Lawson,       //!< generate 2D Delaunay triangulation by incremental insertion with Lawson flips (BRepMesh_LawsonMeshAlgoFactory)
 };
 
 #endif
@@ -32,6 +32,7 @@ struct IMeshTools_Parameters {
     DeflectionInterior(-1.0),
     MinSize (-1.0),
     InParallel (Standard_False),
+    InParallelFace (Standard_False),
     Relative (Standard_False),
     InternalVerticesMode (Standard_True),
     ControlSurfaceDeflection (Standard_True),
@@ -39,7 +40,10 @@ struct IMeshTools_Parameters {
     CleanModel (Standard_True),
     AdjustMinSize (Standard_False),
     ForceFaceDeflection (Standard_False),
-    AllowQualityDecrease (Standard_False)
+    AllowQualityDecrease (Standard_False),
+    NbLODs (1),
+    LODRatio (2.0),
+    SinglePrecisionNodes (Standard_False)
   {
   }
 
@@ -72,6 +76,15 @@ struct IMeshTools_Parameters {
   //! Switches on/off multi-thread computation
   Standard_Boolean                                 InParallel;
 
+  //! Switches on/off multi-thread processing of the interior of a single face.
+  //! The base triangulation of large face is built by the strips of its domain triangulated
+  //! in parallel and joined by the flips of edges around the seams (see BRepMesh_DelaunayBaseMeshAlgo);
+  //! the classification of the interior nodes and the evaluation of control points
+  //! are also done in parallel chunks. That is useful when the meshing time is dominated
+  //! by few big faces and parallelization over faces (InParallel) does not help.
+  //! Disabled by default.
+  Standard_Boolean                                 InParallelFace;
+
   //! Switches on/off relative computation of edge tolerance<br>
   //! If true, deflection used for the polygonalisation of each edge will be 
   //! <defle> * Size of Edge. The deflection used for the faces will be the 
@@ -104,6 +117,20 @@ struct IMeshTools_Parameters {
   //! Allows/forbids the decrease of the quality of the generated mesh
   //! over the existing one.
   Standard_Boolean                                 AllowQualityDecrease;
+
+  //! Number of levels of detail generated by BRepMesh_IncrementalMesh in one pass.
+  //! Each face gets the list of triangulations from the finest (active) one,
+  //! built with the given linear deflections, to the coarsest one.
+  //! Value 1 (default) means the usual meshing with single triangulation per face.
+  Standard_Integer                                 NbLODs;
+
+  //! Ratio of the linear deflections (and min size) of the consecutive levels of detail.
+  Standard_Real                                    LODRatio;
+
+  //! Stores 3D and UV nodes of the resulting triangulations with single precision
+  //! (see Poly_Triangulation::SetDoublePrecision()), that halves the memory taken by nodes.
+  //! Disabled by default.
+  Standard_Boolean                                 SinglePrecisionNodes;
 };
 
 #endif
@@ -1244,6 +1244,7 @@ void IntPatch_Intersection::ParamParamPerfom(const Handle(Adaptor3d_Surface)&  t
                                              const GeomAbs_SurfaceType typs2)
 {
   IntPatch_PrmPrmIntersection interpp;
+  interpp.SetSamplingCache(mySamplingCache);
   //
   if(!theD1->DomainIsInfinite() && !theD2->DomainIsInfinite())
   {
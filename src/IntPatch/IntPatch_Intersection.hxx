@@ -21,6 +21,7 @@
 #include <IntPatch_SequenceOfPoint.hxx>
 #include <IntPatch_SequenceOfLine.hxx>
 #include <IntSurf_ListOfPntOn2S.hxx>
+#include <IntPolyh_SamplingCache.hxx>
 #include <GeomAbs_SurfaceType.hxx>
 #include <NCollection_Vector.hxx>
 
@@ -61,6 +62,15 @@ public:
   //! algorithms  to    compute the  distance between to
   //! points in their respective parametric spaces.
   Standard_EXPORT void SetTolerances (const Standard_Real TolArc, const Standard_Real TolTang, const Standard_Real UVMaxStep, const Standard_Real Fleche);
+
+  //! Sets the cache of the samplings of the surfaces used by the
+  //! Parametric - Parametric intersection (see IntPolyh_SamplingCache).
+  //! The cache allows sharing the sampling of the same surface between
+  //! its intersections with different surfaces.
+  void SetSamplingCache (const Handle(IntPolyh_SamplingCache)& theCache)
+  {
+    mySamplingCache = theCache;
+  }
   
   //! Flag theIsReqToKeepRLine has been entered only for
   //! compatibility with TopOpeBRep package. It shall be deleted
@@ -197,6 +207,7 @@ private:
   Standard_Real myV1Start;
   Standard_Real myU2Start;
   Standard_Real myV2Start;
+  Handle(IntPolyh_SamplingCache) mySamplingCache;
 
 
 };
@@ -2176,12 +2176,12 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
 
     if ( D1->IsUniformSampling() || D2->IsUniformSampling() )
     {
-      pInterference = new IntPolyh_Intersection(Surf1,NbU1,NbV1,Surf2,NbU2,NbV2);
+      pInterference = new IntPolyh_Intersection(Surf1,NbU1,NbV1,Surf2,NbU2,NbV2,mySamplingCache);
     }
     else
     {
       pInterference = new IntPolyh_Intersection(Surf1, anUpars1, aVpars1, 
-        Surf2, anUpars2, aVpars2 );
+        Surf2, anUpars2, aVpars2, mySamplingCache);
     }
 
     if ( !pInterference )
@@ -19,6 +19,7 @@
 
 #include <Adaptor3d_Surface.hxx>
 #include <IntPatch_SequenceOfLine.hxx>
+#include <IntPolyh_SamplingCache.hxx>
 #include <IntSurf_ListOfPntOn2S.hxx>
 
 class Adaptor3d_TopolTool;
@@ -40,6 +41,13 @@ public:
   
   //! Empty Constructor
   Standard_EXPORT IntPatch_PrmPrmIntersection();
+
+  //! Sets the cache of the samplings of the surfaces to be used
+  //! by the intersection of their triangulations (see IntPolyh_SamplingCache).
+  void SetSamplingCache (const Handle(IntPolyh_SamplingCache)& theCache)
+  {
+    mySamplingCache = theCache;
+  }
   
   //! Performs the intersection between <Caro1>  and
   //! <Caro2>.  Associated Polyhedrons <Polyhedron1>
@@ -145,6 +153,7 @@ private:
   Standard_Boolean done;
   Standard_Boolean empt;
   IntPatch_SequenceOfLine SLin;
+  Handle(IntPolyh_SamplingCache) mySamplingCache;
 
 
 };
@@ -59,7 +59,8 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
                                              const Standard_Integer            theNbSV1,
                                              const Handle(Adaptor3d_Surface)& theS2,
                                              const Standard_Integer            theNbSU2,
-                                             const Standard_Integer            theNbSV2)
+                                             const Standard_Integer            theNbSV2,
+                                             const Handle(IntPolyh_SamplingCache)& theCache)
 {
   mySurf1 = theS1;
   mySurf2 = theS2;
@@ -67,6 +68,7 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
   myNbSV1 = theNbSV1;
   myNbSU2 = theNbSU2;
   myNbSV2 = theNbSV2;
+  mySamplingCache = theCache;
   myIsDone = Standard_False;
   myIsParallel = Standard_False;
   mySectionLines.Init(1000);
@@ -83,7 +85,8 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
                                              const TColStd_Array1OfReal&       theVPars1,
                                              const Handle(Adaptor3d_Surface)& theS2,
                                              const TColStd_Array1OfReal&       theUPars2,
-                                             const TColStd_Array1OfReal&       theVPars2)
+                                             const TColStd_Array1OfReal&       theVPars2,
+                                             const Handle(IntPolyh_SamplingCache)& theCache)
 {
   mySurf1 = theS1;
   mySurf2 = theS2;
@@ -91,6 +94,7 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
   myNbSV1 = theVPars1.Length();
   myNbSU2 = theUPars2.Length();
   myNbSV2 = theVPars2.Length();
+  mySamplingCache = theCache;
   myIsDone = Standard_False;
   myIsParallel = Standard_False;
   mySectionLines.Init(1000);
@@ -176,8 +180,17 @@ void IntPolyh_Intersection::Perform(const TColStd_Array1OfReal& theUPars1,
   myIsDone = Standard_True;
 
   // Compute the deflection of the given sampling if it is not set
-  Standard_Real aDeflTol1 = IntPolyh_Tools::ComputeDeflection(mySurf1, theUPars1, theVPars1);
-  Standard_Real aDeflTol2 = IntPolyh_Tools::ComputeDeflection(mySurf2, theUPars2, theVPars2);
+  Standard_Real aDeflTol1, aDeflTol2;
+  if (mySamplingCache.IsNull())
+  {
+    aDeflTol1 = IntPolyh_Tools::ComputeDeflection(mySurf1, theUPars1, theVPars1);
+    aDeflTol2 = IntPolyh_Tools::ComputeDeflection(mySurf2, theUPars2, theVPars2);
+  }
+  else
+  {
+    aDeflTol1 = mySamplingCache->Deflection(mySurf1, theUPars1, theVPars1);
+    aDeflTol2 = mySamplingCache->Deflection(mySurf2, theUPars2, theVPars2);
+  }
 
   // Perform standard intersection
   IntPolyh_PMaillageAffinage pMaillageStd = 0;
@@ -283,9 +296,21 @@ Standard_Boolean IntPolyh_Intersection::PerformAdv(const TColStd_Array1OfReal& t
                                                    Standard_Integer&           theNbCouples)
 {
   // Compute the points on the surface and normal directions in these points
-  IntPolyh_ArrayOfPointNormal aPoints1, aPoints2;
-  IntPolyh_Tools::FillArrayOfPointNormal(mySurf1, theUPars1, theVPars1, aPoints1);
-  IntPolyh_Tools::FillArrayOfPointNormal(mySurf2, theUPars2, theVPars2, aPoints2);
+  // or take them from the cache
+  const IntPolyh_ArrayOfPointNormal* aCachedPoints1 = NULL;
+  const IntPolyh_ArrayOfPointNormal* aCachedPoints2 = NULL;
+  if (!mySamplingCache.IsNull())
+  {
+    aCachedPoints1 = mySamplingCache->PointsNormals(mySurf1, theUPars1, theVPars1);
+    aCachedPoints2 = mySamplingCache->PointsNormals(mySurf2, theUPars2, theVPars2);
+  }
+  IntPolyh_ArrayOfPointNormal aLocalPoints1, aLocalPoints2;
+  if (!aCachedPoints1)
+    IntPolyh_Tools::FillArrayOfPointNormal(mySurf1, theUPars1, theVPars1, aLocalPoints1);
+  if (!aCachedPoints2)
+    IntPolyh_Tools::FillArrayOfPointNormal(mySurf2, theUPars2, theVPars2, aLocalPoints2);
+  const IntPolyh_ArrayOfPointNormal& aPoints1 = aCachedPoints1 ? *aCachedPoints1 : aLocalPoints1;
+  const IntPolyh_ArrayOfPointNormal& aPoints2 = aCachedPoints2 ? *aCachedPoints2 : aLocalPoints2;
 
   // Perform intersection with the different shifts of the triangles
   Standard_Boolean isDone =
@@ -348,8 +373,24 @@ Standard_Boolean IntPolyh_Intersection::PerformMaillage(const TColStd_Array1OfRe
                                   mySurf2, theUPars2.Length(), theVPars2.Length(),
                                   0);
 
-  theMaillage->FillArrayOfPnt(1, theUPars1, theVPars1, &theDeflTol1);
-  theMaillage->FillArrayOfPnt(2, theUPars2, theVPars2, &theDeflTol2);
+  // Take the points of the sampling nets from the cache if possible
+  const TColgp_Array1OfPnt* aPoints1 = NULL;
+  const TColgp_Array1OfPnt* aPoints2 = NULL;
+  if (!mySamplingCache.IsNull())
+  {
+    aPoints1 = mySamplingCache->Points(mySurf1, theUPars1, theVPars1);
+    aPoints2 = mySamplingCache->Points(mySurf2, theUPars2, theVPars2);
+  }
+
+  if (aPoints1)
+    theMaillage->FillArrayOfPnt(1, *aPoints1, theUPars1, theVPars1, &theDeflTol1);
+  else
+    theMaillage->FillArrayOfPnt(1, theUPars1, theVPars1, &theDeflTol1);
+
+  if (aPoints2)
+    theMaillage->FillArrayOfPnt(2, *aPoints2, theUPars2, theVPars2, &theDeflTol2);
+  else
+    theMaillage->FillArrayOfPnt(2, theUPars2, theVPars2, &theDeflTol2);
 
   Standard_Integer FinTTC = ComputeIntersection(theMaillage);
 
@@ -23,6 +23,7 @@
 #include <IntPolyh_ArrayOfTangentZones.hxx>
 #include <IntPolyh_ListOfCouples.hxx>
 #include <IntPolyh_PMaillageAffinage.hxx>
+#include <IntPolyh_SamplingCache.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
 //! API algorithm for intersection of two surfaces by intersection
@@ -39,6 +40,10 @@
 //! if intersection has been performed correctly. It can be done by calling
 //! the *IsDone()* method.
 //!
+//! The sampling of the surfaces (points, normals and deflection of the
+//! sampling nets) can be taken from the cache shared between several
+//! intersections of the same surfaces (see IntPolyh_SamplingCache).
+//!
 //! The results of intersection are the intersection lines and points.
 class IntPolyh_Intersection
 {
@@ -57,22 +62,26 @@ public: //! @name Constructors
   //! size of the sampling nets:
   //! - <theNbSU1> x <theNbSV1> - for the first surface <theS1>;
   //! - <theNbSU2> x <theNbSV2> - for the second surface <theS2>.
+  //! If given, the sampling of the surfaces is taken from the cache <theCache>.
   //! Performs intersection.
   Standard_EXPORT IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& theS1,
                                         const Standard_Integer            theNbSU1,
                                         const Standard_Integer            theNbSV1,
                                         const Handle(Adaptor3d_Surface)& theS2,
                                         const Standard_Integer            theNbSU2,
-                                        const Standard_Integer            theNbSV2);
+                                        const Standard_Integer            theNbSV2,
+                                        const Handle(IntPolyh_SamplingCache)& theCache = Handle(IntPolyh_SamplingCache)());
 
   //! Constructor for intersection of two surfaces with the precomputed sampling.
+  //! If given, the sampling of the surfaces is taken from the cache <theCache>.
   //! Performs intersection.
   Standard_EXPORT IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& theS1,
                                         const TColStd_Array1OfReal&       theUPars1,
                                         const TColStd_Array1OfReal&       theVPars1,
                                         const Handle(Adaptor3d_Surface)& theS2,
                                         const TColStd_Array1OfReal&       theUPars2,
-                                        const TColStd_Array1OfReal&       theVPars2);
+                                        const TColStd_Array1OfReal&       theVPars2,
+                                        const Handle(IntPolyh_SamplingCache)& theCache = Handle(IntPolyh_SamplingCache)());
 
 
 public: //! @name Getting the results
@@ -205,6 +214,7 @@ private: //! @name Fields
   Standard_Integer myNbSV1;                    //!< Number of samples in V direction for first surface
   Standard_Integer myNbSU2;                    //!< Number of samples in U direction for second surface
   Standard_Integer myNbSV2;                    //!< Number of samples in V direction for second surface
+  Handle(IntPolyh_SamplingCache) mySamplingCache; //!< Cache of the sampling of the surfaces
   // Results
   Standard_Boolean myIsDone;                   //!< State of the operation
   IntPolyh_ArrayOfSectionLines mySectionLines; //!< Section lines
@@ -208,15 +208,17 @@ private:
 };
 
 //=======================================================================
-//function : GetInterferingTriangles
-//purpose  : Returns indices of the triangles with interfering bounding boxes
+//function : SelectInterferingTriangles
+//purpose  : Selects the couples of triangles with interfering bounding boxes.
+//           The couples in the selector are sorted by the indices of
+//           the triangles of the first and then of the second surface.
 //=======================================================================
 static
-  void GetInterferingTriangles(IntPolyh_ArrayOfTriangles& theTriangles1,
-                               const IntPolyh_ArrayOfPoints& thePoints1,
-                               IntPolyh_ArrayOfTriangles& theTriangles2,
-                               const IntPolyh_ArrayOfPoints& thePoints2,
-                               IntPolyh_IndexedDataMapOfIntegerListOfInteger& theCouples)
+  void SelectInterferingTriangles(IntPolyh_ArrayOfTriangles& theTriangles1,
+                                  const IntPolyh_ArrayOfPoints& thePoints1,
+                                  IntPolyh_ArrayOfTriangles& theTriangles2,
+                                  const IntPolyh_ArrayOfPoints& thePoints2,
+                                  IntPolyh_BoxBndTreeSelector& theSelector)
 {
   // Use linear builder for BVH construction
   opencascade::handle<BVH_LinearBuilder<Standard_Real, 3>> aLBuilder =
@@ -252,10 +254,28 @@ static
   aBBTree2.Build();
 
   // 3. Perform selection of the interfering triangles
+  theSelector.SetBVHSets (&aBBTree1, &aBBTree2);
+  theSelector.Select();
+  theSelector.Sort();
+  // The trees are local, keep only the selected couples
+  theSelector.SetBVHSets (NULL, NULL);
+}
+
+//=======================================================================
+//function : GetInterferingTriangles
+//purpose  : Returns indices of the triangles with interfering bounding boxes
+//=======================================================================
+static
+  void GetInterferingTriangles(IntPolyh_ArrayOfTriangles& theTriangles1,
+                               const IntPolyh_ArrayOfPoints& thePoints1,
+                               IntPolyh_ArrayOfTriangles& theTriangles2,
+                               const IntPolyh_ArrayOfPoints& thePoints2,
+                               IntPolyh_IndexedDataMapOfIntegerListOfInteger& theCouples)
+{
   IntPolyh_BoxBndTreeSelector aSelector;
-  aSelector.SetBVHSets (&aBBTree1, &aBBTree2);
-  aSelector.Select();
-  aSelector.Sort();
+  SelectInterferingTriangles(theTriangles1, thePoints1,
+                             theTriangles2, thePoints2,
+                             aSelector);
 
   const std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& aPairs = aSelector.Pairs();
   const Standard_Integer aNbPairs = static_cast<Standard_Integer>(aPairs.size());
@@ -369,12 +389,36 @@ void IntPolyh_MaillageAffinage::FillArrayOfPnt
    const TColStd_Array1OfReal& Upars,
    const TColStd_Array1OfReal& Vpars,
    const Standard_Real *theDeflTol)
+{
+  Handle(Adaptor3d_Surface)& aS=(SurfID==1)? MaSurface1:MaSurface2;
+  // Compute the points of the sampling net
+  TColgp_Array1OfPnt aPoints(0, Upars.Length()*Vpars.Length() - 1);
+  Standard_Integer iCnt = 0;
+  for (Standard_Integer i = Upars.Lower(); i <= Upars.Upper(); ++i) {
+    for (Standard_Integer j = Vpars.Lower(); j <= Vpars.Upper(); ++j) {
+      aPoints.SetValue(iCnt++, aS->Value(Upars(i), Vpars(j)));
+    }
+  }
+  // Fill array of points
+  FillArrayOfPnt(SurfID, aPoints, Upars, Vpars, theDeflTol);
+}
+
+//=======================================================================
+//function : FillArrayOfPnt
+//purpose  : Fill the array of points with the precomputed points
+//           of the sampling net
+//=======================================================================
+void IntPolyh_MaillageAffinage::FillArrayOfPnt
+  (const Standard_Integer SurfID,
+   const TColgp_Array1OfPnt& thePoints,
+   const TColStd_Array1OfReal& Upars,
+   const TColStd_Array1OfReal& Vpars,
+   const Standard_Real *theDeflTol)
 {
   Standard_Boolean bDegI, bDeg;
   Standard_Integer aNbU, aNbV, iCnt, i, j;
   Standard_Integer aID1, aID2, aJD1, aJD2;
   Standard_Real aTol, aU, aV, aX, aY, aZ;
-  gp_Pnt aP;
   //
   aNbU=(SurfID==1)? NbSamplesU1 : NbSamplesU2;
   aNbV=(SurfID==1)? NbSamplesV1 : NbSamplesV2;
@@ -398,7 +442,7 @@ void IntPolyh_MaillageAffinage::FillArrayOfPnt
     aU=Upars(i);
     for(j=1; j<=aNbV; ++j){
       aV=Vpars(j);
-      aP=aS->Value(aU, aV);
+      const gp_Pnt& aP=thePoints(thePoints.Lower() + iCnt);
       aP.Coord(aX, aY, aZ);
       IntPolyh_Point& aIP=TPoints[iCnt];
       aIP.Set(aX, aY, aZ, aU, aV);
@@ -1248,79 +1292,49 @@ Standard_Integer IntPolyh_MaillageAffinage::TriContact
   if(minSR(P1.Y(),P2.Y(),P3.Y())>maxSR(Q1.Y(),Q2.Y(),Q3.Y())) return(0);
   if(minSR(P1.Z(),P2.Z(),P3.Z())>maxSR(Q1.Z(),Q2.Z(),Q3.Z())) return(0);
     
-  IntPolyh_Point p1, p2, p3;
-  IntPolyh_Point q1, q2, q3;
-  IntPolyh_Point e1, e2, e3;
-  IntPolyh_Point f1, f2, f3;
-  IntPolyh_Point g1, g2, g3;
-  IntPolyh_Point h1, h2, h3;
-  IntPolyh_Point n1, m1;
-  IntPolyh_Point z;
-
-  IntPolyh_Point ef11, ef12, ef13;
-  IntPolyh_Point ef21, ef22, ef23;
-  IntPolyh_Point ef31, ef32, ef33;
-
-  z.SetX(0.0);  z.SetY(0.0);  z.SetZ(0.0);
-
+  // Translate the triangles to the first point of the first one
+  const IntPolyh_Point p1;
+  const IntPolyh_Point p2 = P2 - P1;
+  const IntPolyh_Point p3 = P3 - P1;
+  const IntPolyh_Point q1 = Q1 - P1;
+  const IntPolyh_Point q2 = Q2 - P1;
+  const IntPolyh_Point q3 = Q3 - P1;
+
+  // Edges of the triangles
+  const IntPolyh_Point e[3] = { p2 - p1, p3 - p2, p1 - p3 };
+  const IntPolyh_Point f[3] = { q2 - q1, q3 - q2, q1 - q3 };
+
+  // Now the testing is done.
+  // The separating axes are computed on demand in the order of
+  // decreasing probability of separation, to reject the most of
+  // the couples of triangles before computing all of them.
+  IntPolyh_Point n1, m1, ax;
+
+  n1.Cross(e[0], e[1]); //normal to the first triangle
+  if (!project6(n1, p1, p2, p3, q1, q2, q3)) return 0; //T2 is not higher or lower than T1
 
-  p1.SetX(P1.X() - P1.X());  p1.SetY(P1.Y() - P1.Y());  p1.SetZ(P1.Z() - P1.Z());
-  p2.SetX(P2.X() - P1.X());  p2.SetY(P2.Y() - P1.Y());  p2.SetZ(P2.Z() - P1.Z());
-  p3.SetX(P3.X() - P1.X());  p3.SetY(P3.Y() - P1.Y());  p3.SetZ(P3.Z() - P1.Z());
-  
-  q1.SetX(Q1.X() - P1.X());  q1.SetY(Q1.Y() - P1.Y());  q1.SetZ(Q1.Z() - P1.Z());
-  q2.SetX(Q2.X() - P1.X());  q2.SetY(Q2.Y() - P1.Y());  q2.SetZ(Q2.Z() - P1.Z());
-  q3.SetX(Q3.X() - P1.X());  q3.SetY(Q3.Y() - P1.Y());  q3.SetZ(Q3.Z() - P1.Z());
-  
-  e1.SetX(p2.X() - p1.X());  e1.SetY(p2.Y() - p1.Y());  e1.SetZ(p2.Z() - p1.Z());
-  e2.SetX(p3.X() - p2.X());  e2.SetY(p3.Y() - p2.Y());  e2.SetZ(p3.Z() - p2.Z());
-  e3.SetX(p1.X() - p3.X());  e3.SetY(p1.Y() - p3.Y());  e3.SetZ(p1.Z() - p3.Z());
+  m1.Cross(f[0], f[1]); //normal to the second triangle
+  if (!project6(m1, p1, p2, p3, q1, q2, q3)) return 0; //T1 is not higher of lower than T2
 
-  f1.SetX(q2.X() - q1.X());  f1.SetY(q2.Y() - q1.Y());  f1.SetZ(q2.Z() - q1.Z());
-  f2.SetX(q3.X() - q2.X());  f2.SetY(q3.Y() - q2.Y());  f2.SetZ(q3.Z() - q2.Z());
-  f3.SetX(q1.X() - q3.X());  f3.SetY(q1.Y() - q3.Y());  f3.SetZ(q1.Z() - q3.Z());
-  
-  n1.Cross(e1, e2); //normal to the first triangle
-  m1.Cross(f1, f2); //normal to the second triangle
-
-  g1.Cross(e1, n1); 
-  g2.Cross(e2, n1);
-  g3.Cross(e3, n1);
-  h1.Cross(f1, m1);
-  h2.Cross(f2, m1);
-  h3.Cross(f3, m1);
-
-  ef11.Cross(e1, f1);
-  ef12.Cross(e1, f2);
-  ef13.Cross(e1, f3);
-  ef21.Cross(e2, f1);
-  ef22.Cross(e2, f2);
-  ef23.Cross(e2, f3);
-  ef31.Cross(e3, f1);
-  ef32.Cross(e3, f2);
-  ef33.Cross(e3, f3);
-  
-  // Now the testing is done
+  for (Standard_Integer i = 0; i < 3; ++i)
+  {
+    for (Standard_Integer j = 0; j < 3; ++j)
+    {
+      ax.Cross(e[i], f[j]);
+      if (!project6(ax, p1, p2, p3, q1, q2, q3)) return 0;
+    }
+  }
 
-  if (!project6(n1, p1, p2, p3, q1, q2, q3)) return 0; //T2 is not higher or lower than T1
-  if (!project6(m1, p1, p2, p3, q1, q2, q3)) return 0; //T1 is not higher of lower than T2
-  
-  if (!project6(ef11, p1, p2, p3, q1, q2, q3)) return 0; 
-  if (!project6(ef12, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef13, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef21, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef22, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef23, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef31, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef32, p1, p2, p3, q1, q2, q3)) return 0;
-  if (!project6(ef33, p1, p2, p3, q1, q2, q3)) return 0;
-
-  if (!project6(g1, p1, p2, p3, q1, q2, q3)) return 0; //T2 is outside of T1 in the plane of T1
-  if (!project6(g2, p1, p2, p3, q1, q2, q3)) return 0; //T2 is outside of T1 in the plane of T1
-  if (!project6(g3, p1, p2, p3, q1, q2, q3)) return 0; //T2 is outside of T1 in the plane of T1
-  if (!project6(h1, p1, p2, p3, q1, q2, q3)) return 0; //T1 is outside of T2 in the plane of T2
-  if (!project6(h2, p1, p2, p3, q1, q2, q3)) return 0; //T1 is outside of T2 in the plane of T2
-  if (!project6(h3, p1, p2, p3, q1, q2, q3)) return 0; //T1 is outside of T2 in the plane of T2
+  for (Standard_Integer i = 0; i < 3; ++i)
+  {
+    ax.Cross(e[i], n1);
+    if (!project6(ax, p1, p2, p3, q1, q2, q3)) return 0; //T2 is outside of T1 in the plane of T1
+  }
+  for (Standard_Integer i = 0; i < 3; ++i)
+  {
+    ax.Cross(f[i], m1);
+    if (!project6(ax, p1, p2, p3, q1, q2, q3)) return 0; //T1 is outside of T2 in the plane of T2
+  }
 
   //Calculation of cosinus angle between two normals
   Standard_Real SqModn1=-1.0;
@@ -2338,42 +2352,41 @@ Standard_Integer IntPolyh_MaillageAffinage::TriangleEdgeContact
 //=======================================================================
 Standard_Integer IntPolyh_MaillageAffinage::TriangleCompare ()
 {
-  // Find couples with interfering bounding boxes
-  IntPolyh_IndexedDataMapOfIntegerListOfInteger aDMILI;
-  GetInterferingTriangles(TTriangles1, TPoints1,
-                          TTriangles2, TPoints2,
-                          aDMILI);
-  if (aDMILI.IsEmpty()) {
+  // Find couples with interfering bounding boxes.
+  // The sorted couples are treated directly, in the same order
+  // as the triangles of the first surface and then of the second one.
+  IntPolyh_BoxBndTreeSelector aSelector;
+  SelectInterferingTriangles(TTriangles1, TPoints1,
+                             TTriangles2, TPoints2,
+                             aSelector);
+  const std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& aPairs = aSelector.Pairs();
+  if (aPairs.empty()) {
     return 0;
   }
   //
   Standard_Real CoupleAngle = -2.0;
   //
   // Intersection of the triangles
-  Standard_Integer i, aNb = aDMILI.Extent();
-  for (i = 1; i <= aNb; ++i) {
-    const Standard_Integer i_S1 = aDMILI.FindKey(i);
+  const Standard_Integer aNbPairs = static_cast<Standard_Integer>(aPairs.size());
+  for (Standard_Integer i = 0; i < aNbPairs; ++i) {
+    const Standard_Integer i_S1 = aPairs[i].ID1;
+    const Standard_Integer i_S2 = aPairs[i].ID2;
     IntPolyh_Triangle &Triangle1 =  TTriangles1[i_S1];
+    IntPolyh_Triangle &Triangle2 =  TTriangles2[i_S2];
+    //
     const IntPolyh_Point& P1 = TPoints1[Triangle1.FirstPoint()];
     const IntPolyh_Point& P2 = TPoints1[Triangle1.SecondPoint()];
     const IntPolyh_Point& P3 = TPoints1[Triangle1.ThirdPoint()];
+    const IntPolyh_Point& Q1 = TPoints2[Triangle2.FirstPoint()];
+    const IntPolyh_Point& Q2 = TPoints2[Triangle2.SecondPoint()];
+    const IntPolyh_Point& Q3 = TPoints2[Triangle2.ThirdPoint()];
     //
-    const TColStd_ListOfInteger& aLI2 = aDMILI(i);
-    TColStd_ListOfInteger::Iterator aItLI(aLI2);
-    for (; aItLI.More(); aItLI.Next()) {
-      const Standard_Integer i_S2 = aItLI.Value();
-      IntPolyh_Triangle &Triangle2 =  TTriangles2[i_S2];
-      const IntPolyh_Point& Q1 = TPoints2[Triangle2.FirstPoint()];
-      const IntPolyh_Point& Q2 = TPoints2[Triangle2.SecondPoint()];
-      const IntPolyh_Point& Q3 = TPoints2[Triangle2.ThirdPoint()];
+    if (TriContact(P1, P2, P3, Q1, Q2, Q3, CoupleAngle)) {
+      IntPolyh_Couple aCouple(i_S1, i_S2, CoupleAngle);
+      TTrianglesContacts.Append(aCouple);
       //
-      if (TriContact(P1, P2, P3, Q1, Q2, Q3, CoupleAngle)) {
-        IntPolyh_Couple aCouple(i_S1, i_S2, CoupleAngle);
-        TTrianglesContacts.Append(aCouple);
-        //
-        Triangle1.SetIntersection(Standard_True);
-        Triangle2.SetIntersection(Standard_True);
-      }
+      Triangle1.SetIntersection(Standard_True);
+      Triangle2.SetIntersection(Standard_True);
     }
   }
   return TTrianglesContacts.Extent();
@@ -23,6 +23,7 @@
 #include <IntPolyh_ArrayOfEdges.hxx>
 #include <IntPolyh_ArrayOfTriangles.hxx>
 #include <IntPolyh_ListOfCouples.hxx>
+#include <TColgp_Array1OfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
 #include <IntPolyh_ArrayOfPointNormal.hxx>
 #include <IntPolyh_ArrayOfSectionLines.hxx>
@@ -72,6 +73,17 @@ public:
                                        const TColStd_Array1OfReal& Vpars,
                                        const Standard_Real *theDeflTol = NULL);
 
+  //! Fills an array of points of one surface with the given points
+  //! <thePoints> of the sampling net <Upars> x <Vpars>
+  //! (U parameter changes slower than V parameter);
+  //! If given, <theDeflTol> is the deflection tolerance of the given sampling.
+  //! standard (default) method
+  Standard_EXPORT void FillArrayOfPnt (const Standard_Integer SurfID,
+                                       const TColgp_Array1OfPnt& thePoints,
+                                       const TColStd_Array1OfReal& Upars,
+                                       const TColStd_Array1OfReal& Vpars,
+                                       const Standard_Real *theDeflTol = NULL);
+
   //! isShiftFwd flag is added. The purpose is to define shift
   //! of points along normal to the surface in this point. The
   //! shift length represents maximal deflection of triangulation.
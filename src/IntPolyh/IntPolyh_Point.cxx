@@ -102,43 +102,6 @@ IntPolyh_Point IntPolyh_Point::Multiplication(const Standard_Real RR)const
   return res;
 }
 //=======================================================================
-//function : SquareModulus
-//purpose  : 
-//=======================================================================
-Standard_Real IntPolyh_Point::SquareModulus()const
-{
-  Standard_Real res=myX*myX+myY*myY+myZ*myZ;
-  return res;
-}
-
-//=======================================================================
-//function : SquareDistance
-//purpose  : 
-//=======================================================================
-Standard_Real IntPolyh_Point::SquareDistance(const IntPolyh_Point &P2)const
-{
-  Standard_Real res=(myX-P2.myX)*(myX-P2.myX)+(myY-P2.myY)*(myY-P2.myY)+(myZ-P2.myZ)*(myZ-P2.myZ);
-  return res;
-}
-//=======================================================================
-//function : Dot
-//purpose  : 
-//=======================================================================
-Standard_Real IntPolyh_Point::Dot(const IntPolyh_Point &b ) const
-{ 
-  Standard_Real t=myX*b.myX+myY*b.myY+myZ*b.myZ;
-  return t;
-}
-//=======================================================================
-//function : Cross
-//purpose  : 
-//=======================================================================
-void IntPolyh_Point::Cross(const IntPolyh_Point &a,const IntPolyh_Point &b){ 
-  myX=a.myY*b.myZ-a.myZ*b.myY;
-  myY=a.myZ*b.myX-a.myX*b.myZ;
-  myZ=a.myX*b.myY-a.myY*b.myX;
-}
-//=======================================================================
 //function : Dump
 //purpose  : 
 //=======================================================================
@@ -144,13 +144,30 @@ public:
     return Multiplication(rr);
   }
   //! Square modulus
-  Standard_EXPORT Standard_Real SquareModulus() const;
+  Standard_Real SquareModulus() const
+  {
+    return myX * myX + myY * myY + myZ * myZ;
+  }
   //! Square distance to the other point
-  Standard_EXPORT Standard_Real SquareDistance (const IntPolyh_Point& P2) const;
+  Standard_Real SquareDistance (const IntPolyh_Point& P2) const
+  {
+    const Standard_Real dx = myX - P2.myX;
+    const Standard_Real dy = myY - P2.myY;
+    const Standard_Real dz = myZ - P2.myZ;
+    return dx * dx + dy * dy + dz * dz;
+  }
   //! Dot
-  Standard_EXPORT Standard_Real Dot (const IntPolyh_Point& P2) const;
+  Standard_Real Dot (const IntPolyh_Point& P2) const
+  {
+    return myX * P2.myX + myY * P2.myY + myZ * P2.myZ;
+  }
   //! Cross
-  Standard_EXPORT void Cross (const IntPolyh_Point& P1, const IntPolyh_Point& P2);
+  void Cross (const IntPolyh_Point& P1, const IntPolyh_Point& P2)
+  {
+    myX = P1.myY * P2.myZ - P1.myZ * P2.myY;
+    myY = P1.myZ * P2.myX - P1.myX * P2.myZ;
+    myZ = P1.myX * P2.myY - P1.myY * P2.myX;
+  }
   //! Dump
   Standard_EXPORT void Dump() const;
   //! Dump
@@ -0,0 +1,193 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <IntPolyh_SamplingCache.hxx>
+
+#include <GeomAdaptor_Surface.hxx>
+#include <IntPolyh_Tools.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(IntPolyh_SamplingCache, Standard_Transient)
+
+namespace
+{
+  //! Checks if the arrays of parameters are identical
+  static Standard_Boolean IsSameParameters (const TColStd_Array1OfReal& thePars1,
+                                            const TColStd_Array1OfReal& thePars2)
+  {
+    if (thePars1.Length() != thePars2.Length())
+    {
+      return Standard_False;
+    }
+    for (Standard_Integer i = thePars1.Lower(), j = thePars2.Lower(); i <= thePars1.Upper(); ++i, ++j)
+    {
+      if (thePars1 (i) != thePars2 (j))
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+}
+
+//=======================================================================
+//function : IntPolyh_SamplingCache
+//purpose  :
+//=======================================================================
+IntPolyh_SamplingCache::IntPolyh_SamplingCache()
+: myNbSamplings (0),
+  myNbReused (0)
+{
+}
+
+//=======================================================================
+//function : ~IntPolyh_SamplingCache
+//purpose  :
+//=======================================================================
+IntPolyh_SamplingCache::~IntPolyh_SamplingCache()
+{
+  Clear();
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void IntPolyh_SamplingCache::Clear()
+{
+  for (NCollection_DataMap<Handle(Standard_Transient), NCollection_List<Sampling*> >::Iterator anIt (mySamplings);
+       anIt.More(); anIt.Next())
+  {
+    for (NCollection_List<Sampling*>::Iterator aItL (anIt.Value()); aItL.More(); aItL.Next())
+    {
+      delete aItL.Value();
+    }
+  }
+  mySamplings.Clear();
+  myNbSamplings = 0;
+  myNbReused = 0;
+}
+
+//=======================================================================
+//function : sampling
+//purpose  :
+//=======================================================================
+IntPolyh_SamplingCache::Sampling* IntPolyh_SamplingCache::sampling
+  (const Handle(Adaptor3d_Surface)& theSurf,
+   const TColStd_Array1OfReal& theUPars,
+   const TColStd_Array1OfReal& theVPars)
+{
+  Handle(GeomAdaptor_Surface) aGAS = Handle(GeomAdaptor_Surface)::DownCast (theSurf);
+  if (aGAS.IsNull() || aGAS->Surface().IsNull())
+  {
+    return NULL;
+  }
+
+  NCollection_List<Sampling*>* aList = mySamplings.ChangeSeek (aGAS->Surface());
+  if (aList == NULL)
+  {
+    aList = mySamplings.Bound (aGAS->Surface(), NCollection_List<Sampling*>());
+  }
+  else
+  {
+    for (NCollection_List<Sampling*>::Iterator aItL (*aList); aItL.More(); aItL.Next())
+    {
+      Sampling* aSampling = aItL.Value();
+      if (IsSameParameters (aSampling->UPars, theUPars) &&
+          IsSameParameters (aSampling->VPars, theVPars))
+      {
+        ++myNbReused;
+        return aSampling;
+      }
+    }
+  }
+
+  Sampling* aSampling = new Sampling (theUPars, theVPars);
+  aList->Append (aSampling);
+  ++myNbSamplings;
+  return aSampling;
+}
+
+//=======================================================================
+//function : Deflection
+//purpose  :
+//=======================================================================
+Standard_Real IntPolyh_SamplingCache::Deflection (const Handle(Adaptor3d_Surface)& theSurf,
+                                                  const TColStd_Array1OfReal& theUPars,
+                                                  const TColStd_Array1OfReal& theVPars)
+{
+  Sampling* aSampling = sampling (theSurf, theUPars, theVPars);
+  if (aSampling == NULL)
+  {
+    return IntPolyh_Tools::ComputeDeflection (theSurf, theUPars, theVPars);
+  }
+
+  if (aSampling->Deflection < 0.)
+  {
+    aSampling->Deflection = IntPolyh_Tools::ComputeDeflection (theSurf, theUPars, theVPars);
+  }
+  return aSampling->Deflection;
+}
+
+//=======================================================================
+//function : Points
+//purpose  :
+//=======================================================================
+const TColgp_Array1OfPnt* IntPolyh_SamplingCache::Points (const Handle(Adaptor3d_Surface)& theSurf,
+                                                          const TColStd_Array1OfReal& theUPars,
+                                                          const TColStd_Array1OfReal& theVPars)
+{
+  Sampling* aSampling = sampling (theSurf, theUPars, theVPars);
+  if (aSampling == NULL)
+  {
+    return NULL;
+  }
+
+  if (aSampling->Points.IsEmpty())
+  {
+    const Standard_Integer aNbU = theUPars.Length();
+    const Standard_Integer aNbV = theVPars.Length();
+    aSampling->Points.Resize (0, aNbU * aNbV - 1, Standard_False);
+    Standard_Integer iCnt = 0;
+    for (Standard_Integer i = theUPars.Lower(); i <= theUPars.Upper(); ++i)
+    {
+      const Standard_Real aU = theUPars (i);
+      for (Standard_Integer j = theVPars.Lower(); j <= theVPars.Upper(); ++j)
+      {
+        aSampling->Points.SetValue (iCnt++, theSurf->Value (aU, theVPars (j)));
+      }
+    }
+  }
+  return &aSampling->Points;
+}
+
+//=======================================================================
+//function : PointsNormals
+//purpose  :
+//=======================================================================
+const IntPolyh_ArrayOfPointNormal* IntPolyh_SamplingCache::PointsNormals
+  (const Handle(Adaptor3d_Surface)& theSurf,
+   const TColStd_Array1OfReal& theUPars,
+   const TColStd_Array1OfReal& theVPars)
+{
+  Sampling* aSampling = sampling (theSurf, theUPars, theVPars);
+  if (aSampling == NULL)
+  {
+    return NULL;
+  }
+
+  if (aSampling->PointsNormals.NbItems() == 0)
+  {
+    IntPolyh_Tools::FillArrayOfPointNormal (theSurf, theUPars, theVPars, aSampling->PointsNormals);
+  }
+  return &aSampling->PointsNormals;
+}
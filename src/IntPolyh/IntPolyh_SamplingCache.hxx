@@ -0,0 +1,117 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _IntPolyh_SamplingCache_HeaderFile
+#define _IntPolyh_SamplingCache_HeaderFile
+
+#include <Adaptor3d_Surface.hxx>
+#include <IntPolyh_ArrayOfPointNormal.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <Standard_Transient.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColStd_Array1OfReal.hxx>
+
+//! The cache of the samplings of the surfaces used by the intersection
+//! of the triangulations (IntPolyh_Intersection).
+//!
+//! When the same surface is intersected with many other surfaces
+//! (e.g. the same face interferes with many faces in Boolean operation),
+//! its sampling net is usually the same for all intersections.
+//! The cache allows computing the points of the net, the normals in these
+//! points and the deflection of the net only once for all of them.
+//!
+//! The samplings are identified by the underlying geometry of the adaptor
+//! and the exact values of the UV parameters of the net.
+//! Only the surfaces given by GeomAdaptor_Surface (and its descendants)
+//! are cached, as for them the identity of the geometry is known.
+//! For other adaptors the cache does not store anything.
+//!
+//! The cache is not thread-safe, each thread should use its own instance.
+class IntPolyh_SamplingCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(IntPolyh_SamplingCache, Standard_Transient)
+public:
+
+  //! Empty constructor
+  Standard_EXPORT IntPolyh_SamplingCache();
+
+  //! Destructor
+  Standard_EXPORT virtual ~IntPolyh_SamplingCache();
+
+  //! Returns the deflection of the sampling net of the surface
+  //! (see IntPolyh_Tools::ComputeDeflection()).
+  Standard_EXPORT Standard_Real Deflection (const Handle(Adaptor3d_Surface)& theSurf,
+                                            const TColStd_Array1OfReal& theUPars,
+                                            const TColStd_Array1OfReal& theVPars);
+
+  //! Returns the points of the sampling net of the surface
+  //! (U parameter changes slower than V parameter),
+  //! or NULL if the sampling of the surface cannot be cached.
+  Standard_EXPORT const TColgp_Array1OfPnt* Points (const Handle(Adaptor3d_Surface)& theSurf,
+                                                    const TColStd_Array1OfReal& theUPars,
+                                                    const TColStd_Array1OfReal& theVPars);
+
+  //! Returns the points of the sampling net of the surface with the normals
+  //! in these points (see IntPolyh_Tools::FillArrayOfPointNormal()),
+  //! or NULL if the sampling of the surface cannot be cached.
+  Standard_EXPORT const IntPolyh_ArrayOfPointNormal* PointsNormals (const Handle(Adaptor3d_Surface)& theSurf,
+                                                                    const TColStd_Array1OfReal& theUPars,
+                                                                    const TColStd_Array1OfReal& theVPars);
+
+  //! Returns the number of cached samplings
+  Standard_Integer NbSamplings() const { return myNbSamplings; }
+
+  //! Returns the number of requests answered by the already cached samplings
+  Standard_Integer NbReused() const { return myNbReused; }
+
+  //! Removes all cached samplings
+  Standard_EXPORT void Clear();
+
+private:
+
+  IntPolyh_SamplingCache (const IntPolyh_SamplingCache&) Standard_DELETE;
+  IntPolyh_SamplingCache& operator= (const IntPolyh_SamplingCache&) Standard_DELETE;
+
+  //! Cached sampling net of the surface
+  struct Sampling
+  {
+    TColStd_Array1OfReal        UPars;           //!< U parameters of the net
+    TColStd_Array1OfReal        VPars;           //!< V parameters of the net
+    Standard_Real               Deflection;      //!< Deflection of the net (negative if not computed yet)
+    TColgp_Array1OfPnt          Points;          //!< Points of the net (empty if not computed yet)
+    IntPolyh_ArrayOfPointNormal PointsNormals;   //!< Points with normals (empty if not computed yet)
+
+    Sampling (const TColStd_Array1OfReal& theUPars,
+              const TColStd_Array1OfReal& theVPars)
+    : UPars (theUPars), VPars (theVPars), Deflection (-1.)
+    {}
+  };
+
+  //! Finds the sampling of the surface with given parameters or adds the new one.
+  //! Returns NULL if the surface cannot be cached.
+  Sampling* sampling (const Handle(Adaptor3d_Surface)& theSurf,
+                      const TColStd_Array1OfReal& theUPars,
+                      const TColStd_Array1OfReal& theVPars);
+
+private:
+
+  NCollection_DataMap<Handle(Standard_Transient), NCollection_List<Sampling*> > mySamplings;
+  Standard_Integer myNbSamplings;
+  Standard_Integer myNbReused;
+
+};
+
+DEFINE_STANDARD_HANDLE(IntPolyh_SamplingCache, Standard_Transient)
+
+#endif // _IntPolyh_SamplingCache_HeaderFile
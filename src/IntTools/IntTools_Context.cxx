@@ -25,6 +25,7 @@
 #include <Geom2dHatch_Intersector.hxx>
 #include <Geom_BoundedCurve.hxx>
 #include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
 #include <GeomAdaptor_Curve.hxx>
 #include <GeomAPI_ProjectPointOnCurve.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
@@ -65,6 +66,7 @@ IntTools_Context::IntTools_Context()
   myBndBoxDataMap(100, myAllocator),
   mySurfAdaptorMap(100, myAllocator),
   myOBBMap(100, myAllocator),
+  mySurfaceMap(100, myAllocator),
   myCreateFlag(0),
   myPOnSTolerance(1.e-12)
 {
@@ -87,6 +89,7 @@ IntTools_Context::IntTools_Context
   myBndBoxDataMap(100, myAllocator),
   mySurfAdaptorMap(100, myAllocator),
   myOBBMap(100, myAllocator),
+  mySurfaceMap(100, myAllocator),
   myCreateFlag(1),
   myPOnSTolerance(1.e-12)
 {
@@ -222,6 +225,14 @@ Standard_Boolean IntTools_Context::IsInfiniteFace
 //=======================================================================
 IntTools_FClass2d& IntTools_Context::FClass2d(const TopoDS_Face& aF)
 {
+  if (!mySharedCache.IsNull())
+  {
+    if (IntTools_FClass2d* pSharedFClass2d = mySharedCache->FClass2d (aF))
+    {
+      return *pSharedFClass2d;
+    }
+  }
+  //
   IntTools_FClass2d* pFClass2d = NULL;
   if (!myFClass2dMap.Find (aF, pFClass2d))
   {
@@ -345,6 +356,34 @@ BRepAdaptor_Surface& IntTools_Context::SurfaceAdaptor
   return *pBAS;
 }
 
+//=======================================================================
+//function : Surface
+//purpose  : 
+//=======================================================================
+const Handle(Geom_Surface)& IntTools_Context::Surface
+  (const TopoDS_Face& theFace)
+{
+  Handle(Geom_Surface)* pS = mySurfaceMap.ChangeSeek (theFace);
+  if (pS == NULL)
+  {
+    pS = mySurfaceMap.Bound (theFace, BRep_Tool::Surface (theFace));
+  }
+  return *pS;
+}
+
+//=======================================================================
+//function : SamplingCache
+//purpose  : 
+//=======================================================================
+const Handle(IntPolyh_SamplingCache)& IntTools_Context::SamplingCache()
+{
+  if (mySamplingCache.IsNull())
+  {
+    mySamplingCache = new IntPolyh_SamplingCache();
+  }
+  return mySamplingCache;
+}
+
 //=======================================================================
 //function : Hatcher
 //purpose  : 
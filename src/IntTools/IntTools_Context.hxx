@@ -26,6 +26,9 @@
 #include <Standard_Transient.hxx>
 #include <TopAbs_State.hxx>
 #include <BRepAdaptor_Surface.hxx>
+#include <IntTools_SharedCache.hxx>
+#include <IntPolyh_SamplingCache.hxx>
+class Geom_Surface;
 class IntTools_FClass2d;
 class TopoDS_Face;
 class GeomAPI_ProjectPointOnSurf;
@@ -95,6 +98,18 @@ Standard_EXPORT virtual  ~IntTools_Context();
   //! Returns a reference to surface adaptor for given face
   Standard_EXPORT BRepAdaptor_Surface& SurfaceAdaptor (const TopoDS_Face& theFace);
 
+  //! Returns the surface of the given face taking into account its location.
+  //! Unlike BRep_Tool::Surface() the transformed copy of the surface of
+  //! located face is built only once, so that the same face always gets
+  //! the same surface.
+  Standard_EXPORT const Handle(Geom_Surface)& Surface (const TopoDS_Face& theFace);
+
+  //! Returns the cache of the samplings of the surfaces used
+  //! for intersection of the triangulations of the surfaces.
+  //! The samplings are identified by the surfaces, thus to share them
+  //! between intersections the surfaces should be taken by Surface() method.
+  Standard_EXPORT const Handle(IntPolyh_SamplingCache)& SamplingCache();
+
   //! Builds and stores an Oriented Bounding Box for the shape.
   //! Returns a reference to OBB.
   Standard_EXPORT Bnd_OBB& OBB(const TopoDS_Shape& theShape,
@@ -235,6 +250,19 @@ Standard_EXPORT virtual  ~IntTools_Context();
   //! correct value for all projectors
   Standard_EXPORT void SetPOnSProjectionTolerance (const Standard_Real theValue);
 
+  //! Sets the cache of the tools shared with the contexts of other threads.
+  //! The tools available in the shared cache are taken from there
+  //! instead of building them in this context.
+  void SetSharedCache (const Handle(IntTools_SharedCache)& theCache)
+  {
+    mySharedCache = theCache;
+  }
+
+  //! Returns the cache of the tools shared with the contexts of other threads
+  const Handle(IntTools_SharedCache)& SharedCache() const
+  {
+    return mySharedCache;
+  }
 
 
   DEFINE_STANDARD_RTTIEXT(IntTools_Context,Standard_Transient)
@@ -252,8 +280,11 @@ protected:
   NCollection_DataMap<TopoDS_Shape, Bnd_Box*, TopTools_ShapeMapHasher> myBndBoxDataMap;
   NCollection_DataMap<TopoDS_Shape, BRepAdaptor_Surface*, TopTools_ShapeMapHasher> mySurfAdaptorMap;
   NCollection_DataMap<TopoDS_Shape, Bnd_OBB*, TopTools_ShapeMapHasher> myOBBMap; // Map of oriented bounding boxes
+  NCollection_DataMap<TopoDS_Shape, Handle(Geom_Surface), TopTools_ShapeMapHasher> mySurfaceMap;
   Standard_Integer myCreateFlag;
   Standard_Real myPOnSTolerance;
+  Handle(IntTools_SharedCache) mySharedCache;
+  Handle(IntPolyh_SamplingCache) mySamplingCache;
 
 private:
 
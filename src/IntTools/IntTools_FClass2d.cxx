@@ -661,6 +661,7 @@ TopAbs_State IntTools_FClass2d::Perform
       }
       //
 
+      Standard_Mutex::Sentry aLocker (myFExplorerMutex);
       if (myFExplorer.get() == NULL)
         myFExplorer.reset (new BRepClass_FaceExplorer (Face));
 
@@ -782,6 +783,7 @@ TopAbs_State IntTools_FClass2d::TestOnRestriction
     }
     else {  //-- TabOrien(1)=-1  Wrong  Wire 
 
+      Standard_Mutex::Sentry aLocker (myFExplorerMutex);
       if (myFExplorer.get() == NULL)
         myFExplorer.reset (new BRepClass_FaceExplorer (Face));
 
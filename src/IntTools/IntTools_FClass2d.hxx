@@ -23,6 +23,7 @@
 
 #include <BRepClass_FaceExplorer.hxx>
 #include <BRepTopAdaptor_SeqOfPtr.hxx>
+#include <Standard_Mutex.hxx>
 #include <TColStd_SequenceOfInteger.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopAbs_State.hxx>
@@ -85,6 +86,7 @@ private:
   Standard_Boolean myIsHole;
 
   mutable std::unique_ptr<BRepClass_FaceExplorer> myFExplorer;
+  mutable Standard_Mutex myFExplorerMutex; //!< Protects the face explorer to allow sharing the classifier between threads
 
 };
 
@@ -403,8 +403,10 @@ void IntTools_FaceFace::Perform (const TopoDS_Face& aF1,
   }
 
 
-  const Handle(Geom_Surface) S1=BRep_Tool::Surface(myFace1);
-  const Handle(Geom_Surface) S2=BRep_Tool::Surface(myFace2);
+  // Take the surfaces from the context to keep their identity
+  // for the cache of the samplings of the surfaces
+  const Handle(Geom_Surface) S1=myContext->Surface(myFace1);
+  const Handle(Geom_Surface) S2=myContext->Surface(myFace2);
 
   Standard_Real aFuzz = myFuzzyValue / 2.;
   myTolF1 = BRep_Tool::Tolerance(myFace1) + aFuzz;
@@ -508,6 +510,7 @@ void IntTools_FaceFace::Perform (const TopoDS_Face& aF1,
       Deflection /= 10.;
     }
     myIntersector.SetTolerances(TolArc, TolTang, UVMaxStep, Deflection); 
+    myIntersector.SetSamplingCache(myContext->SamplingCache());
   }
   
   if((aType1 != GeomAbs_BSplineSurface) &&
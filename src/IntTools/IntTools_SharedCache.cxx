@@ -0,0 +1,96 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <IntTools_SharedCache.hxx>
+
+#include <BRep_Tool.hxx>
+#include <IntTools_FClass2d.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(IntTools_SharedCache, Standard_Transient)
+
+//=======================================================================
+//function : IntTools_SharedCache
+//purpose  :
+//=======================================================================
+IntTools_SharedCache::IntTools_SharedCache()
+{
+}
+
+//=======================================================================
+//function : ~IntTools_SharedCache
+//purpose  :
+//=======================================================================
+IntTools_SharedCache::~IntTools_SharedCache()
+{
+  Clear();
+}
+
+//=======================================================================
+//function : AddFace
+//purpose  :
+//=======================================================================
+void IntTools_SharedCache::AddFace (const TopoDS_Face& theFace)
+{
+  if (theFace.IsNull() || myFaces.IsBound (theFace))
+  {
+    return;
+  }
+  TopoDS_Face aFF = theFace;
+  aFF.Orientation (TopAbs_FORWARD);
+  myFaces.Bind (aFF, new FaceSlot (aFF));
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void IntTools_SharedCache::Clear()
+{
+  for (NCollection_DataMap<TopoDS_Shape, FaceSlot*, TopTools_ShapeMapHasher>::Iterator anIt (myFaces);
+       anIt.More(); anIt.Next())
+  {
+    FaceSlot* aSlot = anIt.Value();
+    delete aSlot->FClass2d.load();
+    delete aSlot;
+  }
+  myFaces.Clear();
+}
+
+//=======================================================================
+//function : FClass2d
+//purpose  :
+//=======================================================================
+IntTools_FClass2d* IntTools_SharedCache::FClass2d (const TopoDS_Face& theFace) const
+{
+  FaceSlot* const* aSlotPtr = myFaces.Seek (theFace);
+  if (aSlotPtr == NULL)
+  {
+    return NULL;
+  }
+
+  FaceSlot* aSlot = *aSlotPtr;
+  IntTools_FClass2d* aFClass2d = aSlot->FClass2d.load (std::memory_order_acquire);
+  if (aFClass2d != NULL)
+  {
+    return aFClass2d;
+  }
+
+  // Build the classifier and publish it, unless another thread has been faster
+  IntTools_FClass2d* aNewFClass2d = new IntTools_FClass2d (aSlot->Face, BRep_Tool::Tolerance (aSlot->Face));
+  if (aSlot->FClass2d.compare_exchange_strong (aFClass2d, aNewFClass2d, std::memory_order_acq_rel))
+  {
+    return aNewFClass2d;
+  }
+  delete aNewFClass2d;
+  return aFClass2d;
+}
@@ -0,0 +1,89 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _IntTools_SharedCache_HeaderFile
+#define _IntTools_SharedCache_HeaderFile
+
+#include <NCollection_DataMap.hxx>
+#include <Standard_Transient.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+#include <atomic>
+
+class IntTools_FClass2d;
+
+//! The cache of the heavy geometrical tools to be shared between
+//! the intersection contexts (IntTools_Context) of parallel workers,
+//! so that the tools are built only once per shape for all threads.
+//!
+//! Only the tools which are safe for concurrent use are shared,
+//! currently these are the 2D classifiers of the faces (IntTools_FClass2d).
+//!
+//! The shapes for which the tools are to be shared have to be registered
+//! in the cache before the parallel processing (registration is not thread-safe).
+//! After that the lookup of the tools is lock-free: the set of registered
+//! shapes is not modified anymore, and each tool is built on first request
+//! and published atomically (in rare case of simultaneous first requests
+//! from several threads the redundant copies are discarded).
+//! The tools for not registered shapes are not provided by the cache.
+class IntTools_SharedCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(IntTools_SharedCache, Standard_Transient)
+public:
+
+  //! Empty constructor
+  Standard_EXPORT IntTools_SharedCache();
+
+  //! Destructor
+  Standard_EXPORT virtual ~IntTools_SharedCache();
+
+  //! Registers the face for sharing its classifier.
+  //! Should not be called concurrently with other methods.
+  Standard_EXPORT void AddFace (const TopoDS_Face& theFace);
+
+  //! Returns the number of registered faces
+  Standard_Integer NbFaces() const { return myFaces.Extent(); }
+
+  //! Removes all registered shapes and their tools.
+  //! Should not be called concurrently with other methods.
+  Standard_EXPORT void Clear();
+
+  //! Returns the classifier for the given face,
+  //! building it on the first request, or NULL if the face is not registered.
+  //! Thread-safe.
+  Standard_EXPORT IntTools_FClass2d* FClass2d (const TopoDS_Face& theFace) const;
+
+private:
+
+  IntTools_SharedCache (const IntTools_SharedCache&) Standard_DELETE;
+  IntTools_SharedCache& operator= (const IntTools_SharedCache&) Standard_DELETE;
+
+private:
+
+  //! Slot of the registered face
+  struct FaceSlot
+  {
+    TopoDS_Face                     Face;     //!< Face with FORWARD orientation
+    std::atomic<IntTools_FClass2d*> FClass2d; //!< Classifier, built on first request
+
+    FaceSlot (const TopoDS_Face& theFace) : Face (theFace), FClass2d (NULL) {}
+  };
+
+  NCollection_DataMap<TopoDS_Shape, FaceSlot*, TopTools_ShapeMapHasher> myFaces;
+
+};
+
+DEFINE_STANDARD_HANDLE(IntTools_SharedCache, Standard_Transient)
+
+#endif // _IntTools_SharedCache_HeaderFile
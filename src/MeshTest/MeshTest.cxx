@@ -19,6 +19,7 @@
 #include <stdio.h>
 
 #include <BRep_Builder.hxx>
+#include <BRep_CurveRepresentation.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
@@ -26,7 +27,9 @@
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepLib.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepMesh_WatertightMesh.hxx>
 #include <BRepTest.hxx>
+#include <BRepTest_Objects.hxx>
 #include <BRepTools.hxx>
 #include <CSLib.hxx>
 #include <DBRep.hxx>
@@ -38,9 +41,15 @@
 #include <IMeshData_Status.hxx>
 #include <Message.hxx>
 #include <Message_ProgressRange.hxx>
+#include <NCollection_Map.hxx>
+#include <NCollection_Vec3.hxx>
 #include <OSD_OpenFile.hxx>
+#include <Poly_Connect.hxx>
+#include <Poly_Decimator.hxx>
 #include <Poly_MergeNodesTool.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_TriangulationParameters.hxx>
+#include <Poly_VertexCacheOptimizer.hxx>
 #include <Prs3d_Drawer.hxx>
 #include <StdPrs_ToolTriangulatedShape.hxx>
 #include <TopExp_Explorer.hxx>
@@ -51,6 +60,8 @@
 #include <BRepMesh_FaceDiscret.hxx>
 #include <BRepMesh_MeshAlgoFactory.hxx>
 #include <BRepMesh_DelabellaMeshAlgoFactory.hxx>
+#include <BRepMesh_StructuredMeshAlgoFactory.hxx>
+#include <BRepMesh_LawsonMeshAlgoFactory.hxx>
 
 #include <algorithm>
 
@@ -92,6 +103,7 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
   TopoDS_ListOfShape aListOfShapes;
   IMeshTools_Parameters aMeshParams;
   bool hasDefl = false, hasAngDefl = false, isPrsDefl = false;
+  TopoDS_Shape aModifiedShape, anInitialShape;
 
   Handle(IMeshTools_Context) aContext = new BRepMesh_Context();
   for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
@@ -108,6 +120,11 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
     {
       aMeshParams.InParallel = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
     }
+    else if (aNameCase == "-parallelface"
+          || aNameCase == "-noparallelface")
+    {
+      aMeshParams.InParallelFace = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
+    }
     else if (aNameCase == "-int_vert_off")
     {
       aMeshParams.InternalVerticesMode = !Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
@@ -132,6 +149,43 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
     {
       aMeshParams.AllowQualityDecrease = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
     }
+    else if (aNameCase == "-singleprec"
+          || aNameCase == "-singleprecision")
+    {
+      aMeshParams.SinglePrecisionNodes = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aNameCase == "-lods"
+          && anArgIter + 1 < theNbArgs)
+    {
+      aMeshParams.NbLODs = Draw::Atoi (theArgVec[++anArgIter]);
+      if (aMeshParams.NbLODs < 1)
+      {
+        theDI << "Syntax error: invalid input parameter '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
+    else if (aNameCase == "-lodratio"
+          && anArgIter + 1 < theNbArgs)
+    {
+      aMeshParams.LODRatio = Draw::Atof (theArgVec[++anArgIter]);
+      if (aMeshParams.LODRatio <= 1.0)
+      {
+        theDI << "Syntax error: invalid input parameter '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
+    else if ((aNameCase == "-modified"
+           || aNameCase == "-history")
+          && anArgIter + 1 < theNbArgs)
+    {
+      TopoDS_Shape& aShapeArg = aNameCase == "-modified" ? aModifiedShape : anInitialShape;
+      aShapeArg = DBRep::Get (theArgVec[++anArgIter]);
+      if (aShapeArg.IsNull())
+      {
+        theDI << "Syntax error: null shapes are not allowed here '" << theArgVec[anArgIter] << "'\n";
+        return 1;
+      }
+    }
     else if (aNameCase == "-algo"
           && anArgIter + 1 < theNbArgs)
     {
@@ -149,6 +203,18 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
         aMeshParams.MeshAlgo = IMeshTools_MeshAlgoType_Delabella;
         aContext->SetFaceDiscret (new BRepMesh_FaceDiscret (new BRepMesh_DelabellaMeshAlgoFactory()));
       }
+      else if (anAlgoStr == "structured"
+            || anAlgoStr == "2")
+      {
+        aMeshParams.MeshAlgo = IMeshTools_MeshAlgoType_Structured;
+        aContext->SetFaceDiscret (new BRepMesh_FaceDiscret (new BRepMesh_StructuredMeshAlgoFactory()));
+      }
+      else if (anAlgoStr == "lawson"
+            || anAlgoStr == "3")
+      {
+        aMeshParams.MeshAlgo = IMeshTools_MeshAlgoType_Lawson;
+        aContext->SetFaceDiscret (new BRepMesh_FaceDiscret (new BRepMesh_LawsonMeshAlgoFactory()));
+      }
       else if (anAlgoStr == "-1"
             || anAlgoStr == "default")
       {
@@ -282,6 +348,31 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
   BRepMesh_IncrementalMesh aMesher;
   aMesher.SetShape (aShape);
   aMesher.ChangeParameters() = aMeshParams;
+  if (!anInitialShape.IsNull())
+  {
+    Handle(BRepTools_History) aHistory = BRepTest_Objects::History();
+    if (aHistory.IsNull())
+    {
+      theDI << "Error: no history is stored in the session\n";
+      return 1;
+    }
+    aMesher.SetModifiedFaces (aHistory, anInitialShape);
+  }
+  if (!aModifiedShape.IsNull())
+  {
+    TopTools_IndexedMapOfShape aModifiedFaces = aMesher.ModifiedFaces();
+    TopExp::MapShapes (aModifiedShape, TopAbs_FACE, aModifiedFaces);
+    aMesher.SetModifiedFaces (aModifiedFaces);
+  }
+  if (!anInitialShape.IsNull()
+   || !aModifiedShape.IsNull())
+  {
+    theDI << "Re-meshing of " << aMesher.ModifiedFaces().Extent() << " modified faces\n";
+    if (aMesher.ModifiedFaces().IsEmpty())
+    {
+      return 0;
+    }
+  }
   aMesher.Perform (aContext, aProgress->Start());
 
   theDI << "Meshing statuses: ";
@@ -1566,6 +1657,512 @@ static Standard_Integer TrMergeNodes (Draw_Interpretor& theDI, Standard_Integer
   return 0;
 }
 
+//=======================================================================
+//function : WatertightMesh
+//purpose  :
+//=======================================================================
+static Standard_Integer WatertightMesh (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs != 3)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get (theArgVec[2]);
+  if (aShape.IsNull())
+  {
+    theDI << "Syntax error: '" << theArgVec[2] << "' is not a shape\n";
+    return 1;
+  }
+
+  BRepMesh_WatertightMesh aMesh (aShape);
+  if (!aMesh.IsDone())
+  {
+    theDI << "Error: shape is not meshed\n";
+    return 1;
+  }
+
+  const Handle(Poly_Triangulation)& aTris = aMesh.Triangulation();
+
+  // count the free links of the mesh
+  Poly_Connect aConnect (aTris);
+  Standard_Integer aNbFreeLinks = 0;
+  for (Standard_Integer aTriIt = 1; aTriIt <= aTris->NbTriangles(); ++aTriIt)
+  {
+    Standard_Integer anAdj[3];
+    aConnect.Triangles (aTriIt, anAdj[0], anAdj[1], anAdj[2]);
+    for (Standard_Integer anIt = 0; anIt < 3; ++anIt)
+    {
+      if (anAdj[anIt] == 0)
+      {
+        ++aNbFreeLinks;
+      }
+    }
+  }
+
+  TopoDS_Face aFace;
+  BRep_Builder().MakeFace (aFace, aTris);
+  DBRep::Set (theArgVec[1], aFace);
+
+  theDI << "Faces: " << aMesh.NbFaces() << ", Triangles: " << aTris->NbTriangles()
+        << ", Nodes: " << aTris->NbNodes() << "\n";
+  theDI << "Free links: " << aNbFreeLinks << ", Not shared edges: " << aMesh.NbNotSharedEdges() << "\n";
+  return 0;
+}
+
+//=======================================================================
+//function : remapPolygon
+//purpose  : Returns the polygon on the decimated triangulation or NULL if some of its nodes have been removed
+//=======================================================================
+static Handle(Poly_PolygonOnTriangulation) remapPolygon (const Handle(Poly_PolygonOnTriangulation)& thePolygon,
+                                                         const Handle(Poly_Decimator)& theDecimator)
+{
+  if (thePolygon.IsNull())
+  {
+    return Handle(Poly_PolygonOnTriangulation)();
+  }
+
+  Handle(Poly_PolygonOnTriangulation) aNewPolygon = new Poly_PolygonOnTriangulation (thePolygon->NbNodes(), thePolygon->HasParameters());
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= thePolygon->NbNodes(); ++aNodeIter)
+  {
+    const Standard_Integer aNewNode = theDecimator->NodeIndex (thePolygon->Node (aNodeIter));
+    if (aNewNode == 0)
+    {
+      return Handle(Poly_PolygonOnTriangulation)();
+    }
+
+    aNewPolygon->SetNode (aNodeIter, aNewNode);
+    if (thePolygon->HasParameters())
+    {
+      aNewPolygon->SetParameter (aNodeIter, thePolygon->Parameter (aNodeIter));
+    }
+  }
+  aNewPolygon->Deflection (thePolygon->Deflection());
+  return aNewPolygon;
+}
+
+//=======================================================================
+//function : TrDecimate
+//purpose  :
+//=======================================================================
+static Standard_Integer TrDecimate (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs < 2)
+  {
+    theDI << "Syntax error: not enough arguments";
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get (theArgVec[1]);
+  if (aShape.IsNull())
+  {
+    theDI << "Syntax error: '" << theArgVec[1] << "' is not a shape";
+    return 1;
+  }
+
+  Standard_Real aRatio = 0.5, aMaxError = -1.0, aFeatureAngle = 0.0;
+  Standard_Integer aNbTris = 0;
+  bool toPreserveBoundary = true, toRunParallel = false;
+  Standard_Integer toKeepNodes = -1;
+  TCollection_AsciiString aResFace;
+  for (Standard_Integer anArgIter = 2; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase (theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgIter + 1 < theNbArgs
+     && anArgCase == "-ratio"
+     && Draw::ParseReal (theArgVec[anArgIter + 1], aRatio))
+    {
+      if (aRatio <= 0.0 || aRatio > 1.0)
+      {
+        theDI << "Syntax error: ratio should be within (0,1] range";
+        return 1;
+      }
+
+      ++anArgIter;
+    }
+    else if (anArgIter + 1 < theNbArgs
+          && (anArgCase == "-nbtriangles"
+           || anArgCase == "-nbtris")
+          && Draw::ParseInteger (theArgVec[anArgIter + 1], aNbTris))
+    {
+      if (aNbTris < 1)
+      {
+        theDI << "Syntax error: number of triangles should be positive";
+        return 1;
+      }
+
+      ++anArgIter;
+    }
+    else if (anArgIter + 1 < theNbArgs
+          && (anArgCase == "-maxerror"
+           || anArgCase == "-error")
+          && Draw::ParseReal (theArgVec[anArgIter + 1], aMaxError))
+    {
+      ++anArgIter;
+    }
+    else if (anArgIter + 1 < theNbArgs
+          && anArgCase == "-featureangle"
+          && Draw::ParseReal (theArgVec[anArgIter + 1], aFeatureAngle))
+    {
+      if (aFeatureAngle < 0.0 || aFeatureAngle > 180.0)
+      {
+        theDI << "Syntax error: angle should be within [0,180] range";
+        return 1;
+      }
+
+      ++anArgIter;
+      aFeatureAngle = aFeatureAngle * M_PI / 180.0;
+    }
+    else if (anArgCase == "-keepboundary"
+          || anArgCase == "-preserveboundary")
+    {
+      toPreserveBoundary = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-keepnodes")
+    {
+      toKeepNodes = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter) ? 1 : 0;
+    }
+    else if (anArgCase == "-parallel")
+    {
+      toRunParallel = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (anArgIter + 1 < theNbArgs
+          && anArgCase == "-oneface")
+    {
+      aResFace = theArgVec[++anArgIter];
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  // the nodes of the face triangulations should remain on the surfaces,
+  // while the nodes of the single mesh can be moved to optimal positions
+  if (toKeepNodes == -1)
+  {
+    toKeepNodes = aResFace.IsEmpty() ? 1 : 0;
+  }
+
+  // collect the triangulations to decimate
+  NCollection_Vector<TopoDS_Face> aFaces;
+  NCollection_Vector<Handle(Poly_Decimator)> aDecimatorsVec;
+  if (!aResFace.IsEmpty())
+  {
+    BRepMesh_WatertightMesh aMesh (aShape);
+    if (!aMesh.IsDone())
+    {
+      theDI << "Error: shape has no triangulation";
+      return 1;
+    }
+    aDecimatorsVec.Append (new Poly_Decimator (aMesh.Triangulation()));
+  }
+  else
+  {
+    TopTools_MapOfShape aProcessedFaces;
+    TopLoc_Location aDummy;
+    for (TopExp_Explorer aFaceIter (aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+    {
+      const TopoDS_Face& aFace = TopoDS::Face (aFaceIter.Value());
+      if (!aProcessedFaces.Add (aFace.Located (TopLoc_Location())))
+      {
+        continue;
+      }
+
+      const Handle(Poly_Triangulation)& aTris = BRep_Tool::Triangulation (aFace, aDummy);
+      if (aTris.IsNull()
+       || aTris->NbNodes() < 3
+       || aTris->NbTriangles() < 1)
+      {
+        continue;
+      }
+
+      aFaces.Append (aFace);
+      aDecimatorsVec.Append (new Poly_Decimator (aTris));
+    }
+  }
+
+  NCollection_Array1<Handle(Poly_Decimator)> aDecimators (0, aDecimatorsVec.Length() - 1);
+  for (Standard_Integer aDecimIter = 0; aDecimIter < aDecimatorsVec.Length(); ++aDecimIter)
+  {
+    const Handle(Poly_Decimator)& aDecimator = aDecimatorsVec.Value (aDecimIter);
+    aDecimator->SetTargetRatio (aRatio);
+    aDecimator->SetTargetNbTriangles (aNbTris);
+    aDecimator->SetMaxError (aMaxError);
+    aDecimator->SetFeatureAngle (aFeatureAngle);
+    aDecimator->SetPreserveBoundary (toPreserveBoundary);
+    aDecimator->SetKeepNodes (toKeepNodes == 1);
+    aDecimators.SetValue (aDecimIter, aDecimator);
+  }
+  Poly_Decimator::Perform (aDecimators, toRunParallel);
+
+  // put the results into the shape sequentially, as the edges are shared between faces
+  Standard_Integer aNbNodesOld = 0, aNbTrisOld = 0;
+  Standard_Integer aNbNodesNew = 0, aNbTrisNew = 0;
+  Standard_Real aMaxDecimError = 0.0;
+  BRep_Builder aBuilder;
+  for (Standard_Integer aDecimIter = 0; aDecimIter < aDecimatorsVec.Length(); ++aDecimIter)
+  {
+    const Handle(Poly_Decimator)& aDecimator = aDecimatorsVec.Value (aDecimIter);
+    const Handle(Poly_Triangulation)& anOldTris = aDecimator->Triangulation();
+    const Handle(Poly_Triangulation)& aNewTris  = !aDecimator->Result().IsNull() ? aDecimator->Result() : anOldTris;
+    aNbNodesOld += anOldTris->NbNodes();
+    aNbTrisOld  += anOldTris->NbTriangles();
+    aNbNodesNew += aNewTris->NbNodes();
+    aNbTrisNew  += aNewTris->NbTriangles();
+    aMaxDecimError = Max (aMaxDecimError, aDecimator->Error());
+    if (!aResFace.IsEmpty())
+    {
+      TopoDS_Face aFace;
+      aBuilder.MakeFace (aFace, aNewTris);
+      DBRep::Set (aResFace.ToCString(), aFace);
+      continue;
+    }
+    else if (aDecimator->Result().IsNull())
+    {
+      continue;
+    }
+
+    const TopoDS_Face& aFace = aFaces.Value (aDecimIter);
+    TopLoc_Location aLoc;
+    BRep_Tool::Triangulation (aFace, aLoc);
+    TopTools_MapOfShape aProcessedEdges;
+    for (TopExp_Explorer anEdgeIter (aFace, TopAbs_EDGE); anEdgeIter.More(); anEdgeIter.Next())
+    {
+      const TopoDS_Edge& anEdge = TopoDS::Edge (anEdgeIter.Current());
+      if (!aProcessedEdges.Add (anEdge))
+      {
+        continue;
+      }
+
+      if (BRep_Tool::IsClosed (anEdge, anOldTris, aLoc))
+      {
+        const TopoDS_Edge anEdgeF = TopoDS::Edge (anEdge.Oriented (TopAbs_FORWARD));
+        const TopoDS_Edge anEdgeR = TopoDS::Edge (anEdge.Oriented (TopAbs_REVERSED));
+        Handle(Poly_PolygonOnTriangulation) aPolygon1 = remapPolygon (BRep_Tool::PolygonOnTriangulation (anEdgeF, anOldTris, aLoc), aDecimator);
+        Handle(Poly_PolygonOnTriangulation) aPolygon2 = remapPolygon (BRep_Tool::PolygonOnTriangulation (anEdgeR, anOldTris, aLoc), aDecimator);
+        aBuilder.UpdateEdge (anEdge, Handle(Poly_PolygonOnTriangulation)(), Handle(Poly_PolygonOnTriangulation)(), anOldTris, aLoc);
+        aBuilder.UpdateEdge (anEdge, aPolygon1, aPolygon2, aNewTris, aLoc);
+      }
+      else
+      {
+        Handle(Poly_PolygonOnTriangulation) aPolygon = remapPolygon (BRep_Tool::PolygonOnTriangulation (anEdge, anOldTris, aLoc), aDecimator);
+        aBuilder.UpdateEdge (anEdge, Handle(Poly_PolygonOnTriangulation)(), anOldTris, aLoc);
+        aBuilder.UpdateEdge (anEdge, aPolygon, aNewTris, aLoc);
+      }
+    }
+    aBuilder.UpdateFace (aFace, aNewTris, false);
+  }
+
+  theDI << "Old, Triangles: " << aNbTrisOld << ", Nodes: " << aNbNodesOld << "\n";
+  theDI << "New, Triangles: " << aNbTrisNew << ", Nodes: " << aNbNodesNew << "\n";
+  theDI << "Max error: " << aMaxDecimError << "\n";
+  return 0;
+}
+
+//=======================================================================
+//function : sortedTriangle
+//purpose  : Returns the triangle with the nodes rotated to start from the smallest index (orientation is kept)
+//=======================================================================
+static NCollection_Vec3<Standard_Integer> sortedTriangle (const Standard_Integer theNode1,
+                                                          const Standard_Integer theNode2,
+                                                          const Standard_Integer theNode3)
+{
+  if (theNode1 <= theNode2 && theNode1 <= theNode3)
+  {
+    return NCollection_Vec3<Standard_Integer> (theNode1, theNode2, theNode3);
+  }
+  else if (theNode2 <= theNode1 && theNode2 <= theNode3)
+  {
+    return NCollection_Vec3<Standard_Integer> (theNode2, theNode3, theNode1);
+  }
+  return NCollection_Vec3<Standard_Integer> (theNode3, theNode1, theNode2);
+}
+
+//=======================================================================
+//function : isTriangleLess
+//purpose  : Compares triangles lexicographically
+//=======================================================================
+static bool isTriangleLess (const NCollection_Vec3<Standard_Integer>& theTri1,
+                            const NCollection_Vec3<Standard_Integer>& theTri2)
+{
+  for (Standard_Integer aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+  {
+    if (theTri1[aNodeIter] != theTri2[aNodeIter])
+    {
+      return theTri1[aNodeIter] < theTri2[aNodeIter];
+    }
+  }
+  return false;
+}
+
+//=======================================================================
+//function : remapPolygon
+//purpose  : Updates the node indices of the polygon after reordering of triangulation nodes
+//=======================================================================
+static void remapPolygon (const Handle(Poly_PolygonOnTriangulation)& thePolygon,
+                          const NCollection_Array1<Standard_Integer>& theNewIndices)
+{
+  if (thePolygon.IsNull())
+  {
+    return;
+  }
+
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= thePolygon->NbNodes(); ++aNodeIter)
+  {
+    thePolygon->SetNode (aNodeIter, theNewIndices.Value (thePolygon->Node (aNodeIter)));
+  }
+}
+
+//=======================================================================
+//function : TrVertexCache
+//purpose  : Reorders triangles and nodes of face triangulations for better vertex cache locality
+//=======================================================================
+static Standard_Integer TrVertexCache (Draw_Interpretor& theDI,
+                                       Standard_Integer theNbArgs,
+                                       const char** theArgVec)
+{
+  if (theNbArgs < 2)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get (theArgVec[1]);
+  if (aShape.IsNull())
+  {
+    theDI << "Syntax error: '" << theArgVec[1] << "' is not a shape";
+    return 1;
+  }
+
+  Standard_Integer aCacheSize = 32, aSimCacheSize = 16;
+  for (Standard_Integer anArgIter = 2; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase (theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgIter + 1 < theNbArgs
+     && anArgCase == "-cachesize"
+     && Draw::ParseInteger (theArgVec[anArgIter + 1], aCacheSize)
+     && aCacheSize > 0)
+    {
+      ++anArgIter;
+    }
+    else if (anArgIter + 1 < theNbArgs
+          && anArgCase == "-fifosize"
+          && Draw::ParseInteger (theArgVec[anArgIter + 1], aSimCacheSize)
+          && aSimCacheSize > 0)
+    {
+      ++anArgIter;
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  Standard_Integer aNbNodes = 0, aNbTris = 0, aNbInvalid = 0;
+  Standard_Real aNbMissesOld = 0.0, aNbMissesNew = 0.0;
+  NCollection_Map<Handle(Poly_Triangulation)> aProcessedTris;
+  TopLoc_Location aDummy;
+  for (TopExp_Explorer aFaceIter (aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (aFaceIter.Value());
+    const Handle(Poly_Triangulation)& aTris = BRep_Tool::Triangulation (aFace, aDummy);
+    if (aTris.IsNull()
+     || aTris->NbTriangles() < 1
+     || !aProcessedTris.Add (aTris))
+    {
+      continue;
+    }
+
+    // keep the original triangles and nodes to validate the result
+    const Handle(Poly_Triangulation) anOldTris = aTris->Copy();
+    aNbNodes += aTris->NbNodes();
+    aNbTris  += aTris->NbTriangles();
+    aNbMissesOld += Poly_VertexCacheOptimizer::CacheMissRatio (aTris, aSimCacheSize) * aTris->NbTriangles();
+
+    NCollection_Array1<Standard_Integer> aNewIndices;
+    if (!Poly_VertexCacheOptimizer::Perform (aTris, aNewIndices, aCacheSize))
+    {
+      aNbMissesNew += Poly_VertexCacheOptimizer::CacheMissRatio (aTris, aSimCacheSize) * aTris->NbTriangles();
+      continue;
+    }
+    aNbMissesNew += Poly_VertexCacheOptimizer::CacheMissRatio (aTris, aSimCacheSize) * aTris->NbTriangles();
+
+    // the polygons of edges refer to the nodes of triangulation;
+    // the seam edge is met twice but its polygons are to be remapped once
+    TopTools_MapOfShape aProcessedEdges;
+    for (TopExp_Explorer anEdgeIter (aFace, TopAbs_EDGE); anEdgeIter.More(); anEdgeIter.Next())
+    {
+      if (!aProcessedEdges.Add (anEdgeIter.Current()))
+      {
+        continue;
+      }
+
+      Handle(BRep_TEdge) aTEdge = Handle(BRep_TEdge)::DownCast (anEdgeIter.Current().TShape());
+      for (BRep_ListIteratorOfListOfCurveRepresentation aCurveIter (aTEdge->Curves()); aCurveIter.More(); aCurveIter.Next())
+      {
+        const Handle(BRep_CurveRepresentation)& aCurve = aCurveIter.Value();
+        if (!aCurve->IsPolygonOnTriangulation()
+          || aCurve->Triangulation() != aTris)
+        {
+          continue;
+        }
+
+        remapPolygon (aCurve->PolygonOnTriangulation(), aNewIndices);
+        if (aCurve->IsPolygonOnClosedTriangulation())
+        {
+          remapPolygon (aCurve->PolygonOnTriangulation2(), aNewIndices);
+        }
+      }
+    }
+
+    // the set of triangles and node positions should remain the same
+    Standard_Boolean isValid = anOldTris->NbNodes() == aTris->NbNodes()
+                            && anOldTris->NbTriangles() == aTris->NbTriangles();
+    for (Standard_Integer aNodeIter = 1; isValid && aNodeIter <= aTris->NbNodes(); ++aNodeIter)
+    {
+      isValid = anOldTris->Node (aNodeIter).IsEqual (aTris->Node (aNewIndices.Value (aNodeIter)), 0.0);
+    }
+    if (isValid)
+    {
+      NCollection_Array1<NCollection_Vec3<Standard_Integer>> anOldSet (1, aTris->NbTriangles());
+      NCollection_Array1<NCollection_Vec3<Standard_Integer>> aNewSet  (1, aTris->NbTriangles());
+      for (Standard_Integer aTriIter = 1; aTriIter <= aTris->NbTriangles(); ++aTriIter)
+      {
+        Standard_Integer aN1, aN2, aN3;
+        anOldTris->Triangle (aTriIter).Get (aN1, aN2, aN3);
+        anOldSet.ChangeValue (aTriIter) = sortedTriangle (aNewIndices.Value (aN1), aNewIndices.Value (aN2), aNewIndices.Value (aN3));
+        aTris->Triangle (aTriIter).Get (aN1, aN2, aN3);
+        aNewSet.ChangeValue (aTriIter) = sortedTriangle (aN1, aN2, aN3);
+      }
+      std::sort (anOldSet.begin(), anOldSet.end(), isTriangleLess);
+      std::sort (aNewSet.begin(),  aNewSet.end(),  isTriangleLess);
+      for (Standard_Integer aTriIter = 1; isValid && aTriIter <= aTris->NbTriangles(); ++aTriIter)
+      {
+        isValid = anOldSet.Value (aTriIter) == aNewSet.Value (aTriIter);
+      }
+    }
+    if (!isValid)
+    {
+      ++aNbInvalid;
+    }
+  }
+
+  theDI << "Triangles: " << aNbTris << ", Nodes: " << aNbNodes << "\n";
+  theDI << "ACMR before: " << (aNbTris > 0 ? aNbMissesOld / aNbTris : 0.0)
+        << ", after: "     << (aNbTris > 0 ? aNbMissesNew / aNbTris : 0.0) << "\n";
+  if (aNbInvalid != 0)
+  {
+    theDI << "Error: triangles of " << aNbInvalid << " triangulation(s) have been changed by reordering\n";
+  }
+  return 0;
+}
+
 //=======================================================================
 //function : correctnormals
 //purpose  : Corrects normals in shape triangulation nodes (...)
@@ -1605,11 +2202,12 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
 
   theCommands.Add("incmesh",
     "incmesh Shape LinDefl [-angular Angle]=28.64 [-prs]"
-    "\n\t\t:   [-relative {0|1}]=0 [-parallel {0|1}]=0 [-min Size]"
-    "\n\t\t:   [-algo {watson|delabella}]=watson"
+    "\n\t\t:   [-relative {0|1}]=0 [-parallel {0|1}]=0 [-parallelface {0|1}]=0 [-min Size]"
+    "\n\t\t:   [-algo {watson|delabella|structured|lawson}]=watson"
     "\n\t\t:   [-di Value] [-ai Angle]=57.29"
     "\n\t\t:   [-int_vert_off {0|1}]=0 [-surf_def_off {0|1}]=0 [-adjust_min {0|1}]=0"
-    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0"
+    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0 [-singleprec {0|1}]=0"
+    "\n\t\t:   [-modified Faces] [-history InitialShape] [-lods NbLODs]=1 [-lodratio Ratio]=2"
     "\n\t\t: Builds triangular mesh for the shape."
     "\n\t\t:  LinDefl         linear deflection to control mesh quality;"
     "\n\t\t:  -angular        angular deflection for edges in deg (~28.64 deg = 0.5 rad by default);"
@@ -1617,6 +2215,8 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:                  (20 deg angular deflection, 0.001 of bounding box linear deflection);"
     "\n\t\t:  -relative       notifies that relative deflection is used (FALSE by default);"
     "\n\t\t:  -parallel       enables parallel execution (FALSE by default);"
+    "\n\t\t:  -parallelface   enables parallel processing of the interior of large faces (FALSE by default);"
+    "\n\t\t:                  base triangulation is built by strips of the face triangulated in parallel;"
     "\n\t\t:  -algo           changes core triangulation algorithm to one with specified id (watson by default);"
     "\n\t\t:  -min            minimum size parameter limiting size of triangle's edges to prevent sinking"
     "\n\t\t:                  into amplification in case of distorted curves and surfaces;"
@@ -1629,7 +2229,14 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:  -adjust_min     enables local adjustment of min size depending on edge size (FALSE by default);"
     "\n\t\t:  -force_face_def disables usage of shape tolerances for computing face deflection (FALSE by default);"
     "\n\t\t:  -decrease       enforces the meshing of the shape even if current mesh satisfies the new criteria"
-    "\n\t\t:                  (FALSE by default).",
+    "\n\t\t:                  (FALSE by default);"
+    "\n\t\t:  -singleprec     stores the nodes of the mesh with single precision to reduce memory usage"
+    "\n\t\t:                  (FALSE by default);"
+    "\n\t\t:  -modified       re-meshes only the given faces of the shape keeping the mesh of other faces;"
+    "\n\t\t:  -history        re-meshes only the faces of the shape modified or generated from the initial shape"
+    "\n\t\t:                  according to the last history stored in the session;"
+    "\n\t\t:  -lods           number of levels of detail (triangulations per face) to be built in one pass;"
+    "\n\t\t:  -lodratio       ratio of the linear deflections of consecutive levels of detail.",
   __FILE__, incrementalmesh, g);
   theCommands.Add("tessellate","Builds triangular mesh for the surface, run w/o args for help",__FILE__, tessellate, g);
   theCommands.Add("MemLeakTest","MemLeakTest",__FILE__, MemLeakTest, g);
@@ -1669,5 +2276,35 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
                   "\n\t\t:   -tolerance linear tolerance to merge nodes; 0.0 when unspecified"
                   "\n\t\t:   -oneFace   create a new single Face with specified name for the whole triangulation",
                   __FILE__, TrMergeNodes, g);
+  theCommands.Add("watertightmesh",
+                  "watertightmesh result shape"
+                  "\n\t\t: Builds single mesh of the meshed shape with the nodes shared"
+                  "\n\t\t: between adjacent faces, and puts it into the face with specified name.",
+                  __FILE__, WatertightMesh, g);
+  theCommands.Add("trdecimate",
+                  "trdecimate shapeName"
+                  "\n\t\t:   [-ratio Ratio] [-nbTriangles Count] [-maxError Value] [-featureAngle Angle]"
+                  "\n\t\t:   [-keepBoundary {0|1}] [-keepNodes {0|1}] [-parallel {0|1}] [-oneFace Result]"
+                  "\n\t\t: Reduces the number of triangles in triangulation data by quadric error metric edge collapses."
+                  "\n\t\t:   -ratio        target number of triangles relative to initial one; 0.5 when unspecified"
+                  "\n\t\t:   -nbTriangles  target number of triangles (per face or for -oneFace result)"
+                  "\n\t\t:   -maxError     maximum error of collapses; not limited when unspecified"
+                  "\n\t\t:   -featureAngle angle in degrees between adjacent triangles to preserve feature edges;"
+                  "\n\t\t:                 0 (disabled) when unspecified"
+                  "\n\t\t:   -keepBoundary preserve the nodes on free edges (face boundaries); 1 when unspecified"
+                  "\n\t\t:   -keepNodes    collapse edges to existing nodes instead of optimal positions"
+                  "\n\t\t:                 to keep the nodes on the surfaces of the faces;"
+                  "\n\t\t:                 1 when unspecified, 0 when unspecified for -oneFace"
+                  "\n\t\t:   -parallel     decimate triangulations of faces in parallel; 0 when unspecified"
+                  "\n\t\t:   -oneFace      decimate watertight mesh of the whole shape"
+                  "\n\t\t:                 and put it into a new single Face with specified name",
+                  __FILE__, TrDecimate, g);
+  theCommands.Add("trvertexcache",
+                  "trvertexcache shapeName [-cacheSize Size] [-fifoSize Size]"
+                  "\n\t\t: Reorders triangles and nodes of face triangulations for better vertex cache locality"
+                  "\n\t\t: and prints the average cache miss ratio (ACMR) before and after reordering."
+                  "\n\t\t:   -cacheSize vertex cache size used for optimization; 32 when unspecified"
+                  "\n\t\t:   -fifoSize  FIFO cache size used for ACMR evaluation; 16 when unspecified",
+                  __FILE__, TrVertexCache, g);
   theCommands.Add("correctnormals", "correctnormals shape",__FILE__, correctnormals, g);
 }
@@ -0,0 +1,776 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Poly_Decimator.hxx>
+
+#include <NCollection_IncAllocator.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <algorithm>
+
+IMPLEMENT_STANDARD_RTTIEXT(Poly_Decimator, Standard_Transient)
+
+namespace
+{
+  //! Weight of the penalty planes keeping the free edges in place.
+  static const Standard_Real THE_BOUNDARY_WEIGHT = 10.0;
+
+  //! Minimal cosine of the angle between normals of the triangle before and after collapse.
+  static const Standard_Real THE_MIN_FLIP_COS = 0.1;
+
+  //! Symmetric 4x4 matrix of the quadric error.
+  struct Quadric
+  {
+    Standard_Real XX, XY, XZ, XW, YY, YZ, YW, ZZ, ZW, WW;
+
+    Quadric() : XX (0.0), XY (0.0), XZ (0.0), XW (0.0), YY (0.0), YZ (0.0), YW (0.0), ZZ (0.0), ZW (0.0), WW (0.0) {}
+
+    //! Adds the plane passing through the point with the given unit normal.
+    void AddPlane (const gp_XYZ& theNorm, const gp_XYZ& thePnt, const Standard_Real theWeight)
+    {
+      const Standard_Real aD = -theNorm.Dot (thePnt);
+      XX += theWeight * theNorm.X() * theNorm.X();
+      XY += theWeight * theNorm.X() * theNorm.Y();
+      XZ += theWeight * theNorm.X() * theNorm.Z();
+      XW += theWeight * theNorm.X() * aD;
+      YY += theWeight * theNorm.Y() * theNorm.Y();
+      YZ += theWeight * theNorm.Y() * theNorm.Z();
+      YW += theWeight * theNorm.Y() * aD;
+      ZZ += theWeight * theNorm.Z() * theNorm.Z();
+      ZW += theWeight * theNorm.Z() * aD;
+      WW += theWeight * aD * aD;
+    }
+
+    Quadric& operator+= (const Quadric& theOther)
+    {
+      XX += theOther.XX; XY += theOther.XY; XZ += theOther.XZ; XW += theOther.XW;
+      YY += theOther.YY; YZ += theOther.YZ; YW += theOther.YW;
+      ZZ += theOther.ZZ; ZW += theOther.ZW;
+      WW += theOther.WW;
+      return *this;
+    }
+
+    //! Returns the error of the point.
+    Standard_Real Error (const gp_XYZ& thePnt) const
+    {
+      const Standard_Real aX = thePnt.X(), aY = thePnt.Y(), aZ = thePnt.Z();
+      const Standard_Real anErr = aX * (XX * aX + 2.0 * (XY * aY + XZ * aZ + XW))
+                                + aY * (YY * aY + 2.0 * (YZ * aZ + YW))
+                                + aZ * (ZZ * aZ + 2.0 * ZW)
+                                + WW;
+      return Max (anErr, 0.0);
+    }
+
+    //! Computes the point minimizing the error.
+    //! @return FALSE if the quadric is degenerated
+    Standard_Boolean Optimum (gp_XYZ& thePnt) const
+    {
+      const Standard_Real aDet = XX * (YY * ZZ - YZ * YZ)
+                               - XY * (XY * ZZ - YZ * XZ)
+                               + XZ * (XY * YZ - YY * XZ);
+      const Standard_Real aTrace = XX + YY + ZZ;
+      if (Abs (aDet) <= 1.0e-9 * aTrace * aTrace * aTrace)
+      {
+        return Standard_False;
+      }
+
+      // Cramer's rule for A * P = -B
+      const Standard_Real aBX = -XW, aBY = -YW, aBZ = -ZW;
+      thePnt.SetX ((aBX * (YY * ZZ - YZ * YZ) - XY * (aBY * ZZ - YZ * aBZ) + XZ * (aBY * YZ - YY * aBZ)) / aDet);
+      thePnt.SetY ((XX * (aBY * ZZ - aBZ * YZ) - aBX * (XY * ZZ - YZ * XZ) + XZ * (XY * aBZ - aBY * XZ)) / aDet);
+      thePnt.SetZ ((XX * (YY * aBZ - YZ * aBY) - XY * (XY * aBZ - aBY * XZ) + aBX * (XY * YZ - YY * XZ)) / aDet);
+      return Standard_True;
+    }
+  };
+
+  //! Candidate edge collapse.
+  struct Collapse
+  {
+    Standard_Real    Cost;
+    gp_XYZ           Target;
+    Standard_Integer Keep;       //!< node remaining after collapse
+    Standard_Integer Remove;     //!< node removed by collapse
+    Standard_Integer KeepStamp;
+    Standard_Integer RemoveStamp;
+
+    //! Comparison for the heap giving the collapse with the smallest cost first.
+    bool operator< (const Collapse& theOther) const { return Cost > theOther.Cost; }
+  };
+
+  typedef NCollection_Vector<Standard_Integer> VectorOfInteger;
+
+  //! Returns TRUE if the vector contains the given index.
+  static Standard_Boolean contains (const VectorOfInteger& theIndices,
+                                    const Standard_Integer theIndex)
+  {
+    for (VectorOfInteger::Iterator anIter (theIndices); anIter.More(); anIter.Next())
+    {
+      if (anIter.Value() == theIndex)
+      {
+        return Standard_True;
+      }
+    }
+    return Standard_False;
+  }
+
+  //! Returns the number of common indices of two sorted vectors.
+  static Standard_Integer nbCommon (const VectorOfInteger& theIndices1,
+                                    const VectorOfInteger& theIndices2)
+  {
+    Standard_Integer aNbCommon = 0;
+    for (Standard_Integer anIter1 = 0, anIter2 = 0; anIter1 < theIndices1.Length() && anIter2 < theIndices2.Length();)
+    {
+      if (theIndices1.Value (anIter1) < theIndices2.Value (anIter2))
+      {
+        ++anIter1;
+      }
+      else if (theIndices2.Value (anIter2) < theIndices1.Value (anIter1))
+      {
+        ++anIter2;
+      }
+      else
+      {
+        ++aNbCommon;
+        ++anIter1;
+        ++anIter2;
+      }
+    }
+    return aNbCommon;
+  }
+
+  //! Working data structure of the decimation.
+  class DecimationMesh
+  {
+  public:
+
+    //! Fills the mesh from the triangulation.
+    DecimationMesh (const Handle(Poly_Triangulation)& theTris,
+                    const Standard_Boolean theToPreserveBoundary,
+                    const Standard_Real theFeatureAngle,
+                    const Standard_Boolean theToKeepNodes)
+    : myAllocator (new NCollection_IncAllocator()),
+      myNodes (0, theTris->NbNodes() - 1),
+      myTris (0, theTris->NbTriangles() - 1),
+      myIsAliveTri (0, theTris->NbTriangles() - 1),
+      myNbTris (0),
+      myNodeTris (0, theTris->NbNodes() - 1),
+      myQuadrics (0, theTris->NbNodes() - 1),
+      myStamps (0, theTris->NbNodes() - 1),
+      myIsAlive (0, theTris->NbNodes() - 1),
+      myIsLocked (0, theTris->NbNodes() - 1),
+      myIsBoundary (0, theTris->NbNodes() - 1),
+      myHeap (0, 3 * theTris->NbNodes() + 15),
+      myHeapSize (0),
+      myToKeepNodes (theToKeepNodes),
+      myNbAliveTris (0)
+    {
+      const Standard_Integer aNbNodes = theTris->NbNodes();
+      const Standard_Integer aNbTris  = theTris->NbTriangles();
+      const Standard_Boolean hasUV = theTris->HasUVNodes();
+
+      myStamps.Init (0);
+      myIsAlive.Init (Standard_True);
+      myIsLocked.Init (Standard_False);
+      myIsBoundary.Init (Standard_False);
+      if (hasUV)
+      {
+        myUVNodes.Resize (0, aNbNodes - 1, Standard_False);
+      }
+      for (Standard_Integer aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+      {
+        myNodes[aNodeIter] = theTris->Node (aNodeIter + 1).XYZ();
+        myNodeTris[aNodeIter].Clear (myAllocator);
+        if (hasUV)
+        {
+          myUVNodes[aNodeIter] = theTris->UVNode (aNodeIter + 1).XY();
+        }
+      }
+
+      for (Standard_Integer aTriIter = 1; aTriIter <= aNbTris; ++aTriIter)
+      {
+        Standard_Integer aNodes[3];
+        theTris->Triangle (aTriIter).Get (aNodes[0], aNodes[1], aNodes[2]);
+        if (aNodes[0] < 1 || aNodes[0] > aNbNodes
+         || aNodes[1] < 1 || aNodes[1] > aNbNodes
+         || aNodes[2] < 1 || aNodes[2] > aNbNodes
+         || aNodes[0] == aNodes[1] || aNodes[1] == aNodes[2] || aNodes[2] == aNodes[0])
+        {
+          continue;
+        }
+
+        const Standard_Integer aTriIndex = myNbTris++;
+        TriNodes aTri;
+        for (Standard_Integer aVertIter = 0; aVertIter < 3; ++aVertIter)
+        {
+          aTri.Nodes[aVertIter] = aNodes[aVertIter] - 1;
+          myNodeTris[aTri.Nodes[aVertIter]].Append (aTriIndex);
+        }
+        myTris[aTriIndex] = aTri;
+        myIsAliveTri[aTriIndex] = Standard_True;
+        ++myNbAliveTris;
+
+        // accumulate the plane of the triangle in its nodes
+        const gp_XYZ aNorm = triNormal (aTriIndex);
+        const Standard_Real aMod = aNorm.Modulus();
+        if (aMod > gp::Resolution())
+        {
+          Quadric aQuadric;
+          aQuadric.AddPlane (aNorm / aMod, myNodes[aTri.Nodes[0]], 1.0);
+          for (Standard_Integer aVertIter = 0; aVertIter < 3; ++aVertIter)
+          {
+            myQuadrics[aTri.Nodes[aVertIter]] += aQuadric;
+          }
+        }
+      }
+
+      classifyEdges (theToPreserveBoundary, theFeatureAngle);
+    }
+
+    //! Returns the number of alive triangles.
+    Standard_Integer NbTriangles() const { return myNbAliveTris; }
+
+    //! Fills the heap by the collapses of all edges.
+    void InitCollapses()
+    {
+      VectorOfInteger aNeighbors (16);
+      for (Standard_Integer aNode = myNodes.Lower(); aNode <= myNodes.Upper(); ++aNode)
+      {
+        neighbors (aNode, aNeighbors);
+        for (VectorOfInteger::Iterator aNeighIter (aNeighbors); aNeighIter.More(); aNeighIter.Next())
+        {
+          if (aNeighIter.Value() > aNode)
+          {
+            pushCollapse (aNode, aNeighIter.Value());
+          }
+        }
+      }
+    }
+
+    //! Performs the next valid collapse with the error below the limit.
+    //! @return FALSE if there is no such collapse
+    Standard_Boolean CollapseNext (const Standard_Real theMaxSqError,
+                                   Standard_Real& theError)
+    {
+      while (myHeapSize > 0)
+      {
+        Collapse* aHeap = &myHeap.ChangeFirst();
+        std::pop_heap (aHeap, aHeap + myHeapSize);
+        const Collapse aCollapse = aHeap[--myHeapSize];
+        if (!myIsAlive[aCollapse.Keep]
+         || !myIsAlive[aCollapse.Remove]
+         || myStamps[aCollapse.Keep]   != aCollapse.KeepStamp
+         || myStamps[aCollapse.Remove] != aCollapse.RemoveStamp)
+        {
+          continue; // outdated
+        }
+        if (theMaxSqError >= 0.0
+         && aCollapse.Cost > theMaxSqError)
+        {
+          myHeapSize = 0;
+          return Standard_False;
+        }
+        if (!isValid (aCollapse))
+        {
+          continue;
+        }
+
+        theError = Max (theError, Sqrt (aCollapse.Cost));
+        perform (aCollapse);
+        return Standard_True;
+      }
+      return Standard_False;
+    }
+
+    //! Creates the resulting triangulation.
+    Handle(Poly_Triangulation) Result (const Handle(Poly_Triangulation)& theInput,
+                                       NCollection_Array1<Standard_Integer>& theNodesMap) const
+    {
+      const Standard_Integer aNbNodes = myNodes.Size();
+      theNodesMap.Resize (1, aNbNodes, Standard_False);
+      Standard_Integer aNbNewNodes = 0;
+      for (Standard_Integer aNode = 0; aNode < aNbNodes; ++aNode)
+      {
+        // nodes not used by triangles of the input mesh remain alive and are kept as well
+        Standard_Integer aNewIndex = 0;
+        if (myIsAlive[aNode])
+        {
+          aNewIndex = ++aNbNewNodes;
+        }
+        theNodesMap.SetValue (aNode + 1, aNewIndex);
+      }
+
+      Handle(Poly_Triangulation) aResult = new Poly_Triangulation();
+      aResult->SetDoublePrecision (theInput->IsDoublePrecision());
+      aResult->ResizeNodes (aNbNewNodes, false);
+      aResult->ResizeTriangles (myNbAliveTris, false);
+      if (!myUVNodes.IsEmpty())
+      {
+        aResult->AddUVNodes();
+      }
+      for (Standard_Integer aNode = 0; aNode < aNbNodes; ++aNode)
+      {
+        const Standard_Integer aNewIndex = theNodesMap.Value (aNode + 1);
+        if (aNewIndex != 0)
+        {
+          aResult->SetNode (aNewIndex, myNodes[aNode]);
+          if (!myUVNodes.IsEmpty())
+          {
+            aResult->SetUVNode (aNewIndex, myUVNodes[aNode]);
+          }
+        }
+      }
+
+      Standard_Integer aNbNewTris = 0;
+      for (Standard_Integer aTriIter = 0; aTriIter < myNbTris; ++aTriIter)
+      {
+        if (myIsAliveTri[aTriIter])
+        {
+          const TriNodes& aTri = myTris[aTriIter];
+          aResult->SetTriangle (++aNbNewTris, Poly_Triangle (theNodesMap.Value (aTri.Nodes[0] + 1),
+                                                             theNodesMap.Value (aTri.Nodes[1] + 1),
+                                                             theNodesMap.Value (aTri.Nodes[2] + 1)));
+        }
+      }
+      aResult->SetMeshPurpose (theInput->MeshPurpose());
+      return aResult;
+    }
+
+  private:
+
+    //! Nodes of the triangle.
+    struct TriNodes
+    {
+      Standard_Integer Nodes[3];
+    };
+
+    //! Returns the not normalized normal of the triangle.
+    gp_XYZ triNormal (const Standard_Integer theTri) const
+    {
+      const TriNodes& aTri = myTris[theTri];
+      return (myNodes[aTri.Nodes[1]] - myNodes[aTri.Nodes[0]]).Crossed (myNodes[aTri.Nodes[2]] - myNodes[aTri.Nodes[0]]);
+    }
+
+    //! Returns the index of the node within the triangle or -1.
+    Standard_Integer nodeInTri (const Standard_Integer theTri, const Standard_Integer theNode) const
+    {
+      const TriNodes& aTri = myTris[theTri];
+      for (Standard_Integer aVertIter = 0; aVertIter < 3; ++aVertIter)
+      {
+        if (aTri.Nodes[aVertIter] == theNode)
+        {
+          return aVertIter;
+        }
+      }
+      return -1;
+    }
+
+    //! Collects the nodes connected to the given one by alive triangles.
+    void neighbors (const Standard_Integer theNode,
+                    VectorOfInteger& theNeighbors) const
+    {
+      theNeighbors.Clear();
+      for (NCollection_List<Standard_Integer>::Iterator aTriIter (myNodeTris[theNode]); aTriIter.More(); aTriIter.Next())
+      {
+        if (!myIsAliveTri[aTriIter.Value()])
+        {
+          continue;
+        }
+        const TriNodes& aTri = myTris[aTriIter.Value()];
+        for (Standard_Integer aVertIter = 0; aVertIter < 3; ++aVertIter)
+        {
+          if (aTri.Nodes[aVertIter] != theNode
+          && !contains (theNeighbors, aTri.Nodes[aVertIter]))
+          {
+            theNeighbors.Append (aTri.Nodes[aVertIter]);
+          }
+        }
+      }
+      std::sort (theNeighbors.begin(), theNeighbors.end());
+    }
+
+    //! Collects the alive triangles sharing both nodes.
+    void sharedTris (const Standard_Integer theNode1,
+                     const Standard_Integer theNode2,
+                     VectorOfInteger& theTris) const
+    {
+      theTris.Clear();
+      for (NCollection_List<Standard_Integer>::Iterator aTriIter (myNodeTris[theNode1]); aTriIter.More(); aTriIter.Next())
+      {
+        if (myIsAliveTri[aTriIter.Value()]
+         && nodeInTri (aTriIter.Value(), theNode2) != -1)
+        {
+          theTris.Append (aTriIter.Value());
+        }
+      }
+    }
+
+    //! Marks the nodes on the free, non-manifold and feature edges.
+    void classifyEdges (const Standard_Boolean theToPreserveBoundary,
+                        const Standard_Real theFeatureAngle)
+    {
+      const Standard_Real aFeatureCos = Cos (theFeatureAngle);
+      VectorOfInteger aNeighbors (16), aTris (16);
+      for (Standard_Integer aNode = myNodes.Lower(); aNode <= myNodes.Upper(); ++aNode)
+      {
+        neighbors (aNode, aNeighbors);
+        for (VectorOfInteger::Iterator aNeighIter (aNeighbors); aNeighIter.More(); aNeighIter.Next())
+        {
+          const Standard_Integer aNeighbor = aNeighIter.Value();
+          if (aNeighbor < aNode)
+          {
+            continue;
+          }
+
+          sharedTris (aNode, aNeighbor, aTris);
+          if (aTris.Length() == 1)
+          {
+            myIsBoundary[aNode] = myIsBoundary[aNeighbor] = Standard_True;
+            if (theToPreserveBoundary)
+            {
+              myIsLocked[aNode] = myIsLocked[aNeighbor] = Standard_True;
+              continue;
+            }
+
+            // penalty plane orthogonal to the triangle keeps the free edge in place
+            const gp_XYZ anEdge = myNodes[aNeighbor] - myNodes[aNode];
+            gp_XYZ aNorm = anEdge.Crossed (triNormal (aTris[0]));
+            const Standard_Real aMod = aNorm.Modulus();
+            if (aMod > gp::Resolution())
+            {
+              Quadric aQuadric;
+              aQuadric.AddPlane (aNorm / aMod, myNodes[aNode], THE_BOUNDARY_WEIGHT);
+              myQuadrics[aNode]     += aQuadric;
+              myQuadrics[aNeighbor] += aQuadric;
+            }
+          }
+          else if (aTris.Length() > 2)
+          {
+            myIsLocked[aNode] = myIsLocked[aNeighbor] = Standard_True;
+          }
+          else if (theFeatureAngle > 0.0)
+          {
+            gp_XYZ aNorm1 = triNormal (aTris[0]), aNorm2 = triNormal (aTris[1]);
+            const Standard_Real aMod1 = aNorm1.Modulus(), aMod2 = aNorm2.Modulus();
+            if (aMod1 > gp::Resolution()
+             && aMod2 > gp::Resolution()
+             && aNorm1.Dot (aNorm2) < aFeatureCos * aMod1 * aMod2)
+            {
+              myIsLocked[aNode] = myIsLocked[aNeighbor] = Standard_True;
+            }
+          }
+        }
+      }
+    }
+
+    //! Computes the collapse of the edge and pushes it to the heap.
+    void pushCollapse (const Standard_Integer theNode1,
+                       const Standard_Integer theNode2)
+    {
+      if (myIsLocked[theNode1] && myIsLocked[theNode2])
+      {
+        return;
+      }
+
+      Quadric aQuadric = myQuadrics[theNode1];
+      aQuadric += myQuadrics[theNode2];
+
+      Collapse aCollapse;
+      aCollapse.Keep   = myIsLocked[theNode2] ? theNode2 : theNode1;
+      aCollapse.Remove = myIsLocked[theNode2] ? theNode1 : theNode2;
+      aCollapse.Target = myNodes[aCollapse.Keep];
+      aCollapse.Cost   = aQuadric.Error (aCollapse.Target);
+      if (!myIsLocked[theNode1] && !myIsLocked[theNode2])
+      {
+        // the edge can be collapsed to any of its nodes
+        const Standard_Real aCost2 = aQuadric.Error (myNodes[aCollapse.Remove]);
+        if (aCost2 < aCollapse.Cost)
+        {
+          std::swap (aCollapse.Keep, aCollapse.Remove);
+          aCollapse.Target = myNodes[aCollapse.Keep];
+          aCollapse.Cost   = aCost2;
+        }
+        if (!myToKeepNodes)
+        {
+          const gp_XYZ aMid = (myNodes[theNode1] + myNodes[theNode2]) * 0.5;
+          const Standard_Real aLength = (myNodes[theNode2] - myNodes[theNode1]).Modulus();
+          gp_XYZ anOptimum;
+          if (aQuadric.Optimum (anOptimum)
+           && (anOptimum - aMid).Modulus() < aLength)
+          {
+            // optimum too far from the edge is a sign of almost degenerated quadric
+            const Standard_Real aCost = aQuadric.Error (anOptimum);
+            if (aCost < aCollapse.Cost)
+            {
+              aCollapse.Target = anOptimum;
+              aCollapse.Cost   = aCost;
+            }
+          }
+          else
+          {
+            const Standard_Real aCost = aQuadric.Error (aMid);
+            if (aCost < aCollapse.Cost)
+            {
+              aCollapse.Target = aMid;
+              aCollapse.Cost   = aCost;
+            }
+          }
+        }
+      }
+      aCollapse.KeepStamp   = myStamps[aCollapse.Keep];
+      aCollapse.RemoveStamp = myStamps[aCollapse.Remove];
+      if (myHeapSize == myHeap.Size())
+      {
+        myHeap.Resize (0, 2 * myHeapSize - 1, Standard_True);
+      }
+      Collapse* aHeap = &myHeap.ChangeFirst();
+      aHeap[myHeapSize++] = aCollapse;
+      std::push_heap (aHeap, aHeap + myHeapSize);
+    }
+
+    //! Checks that the collapse keeps the topology of the mesh and does not flip triangles.
+    Standard_Boolean isValid (const Collapse& theCollapse)
+    {
+      const Standard_Integer aKeep = theCollapse.Keep, aRemove = theCollapse.Remove;
+      VectorOfInteger& aShared = myTmpShared;
+      sharedTris (aKeep, aRemove, aShared);
+      if (aShared.IsEmpty())
+      {
+        return Standard_False;
+      }
+
+      // interior edge connecting two boundary nodes would pinch the mesh
+      if (aShared.Length() > 1
+       && myIsBoundary[aKeep]
+       && myIsBoundary[aRemove])
+      {
+        return Standard_False;
+      }
+
+      // link condition: common neighbors should be only the opposite nodes of shared triangles
+      VectorOfInteger& aNeighbors1 = myTmpNeighbors1;
+      VectorOfInteger& aNeighbors2 = myTmpNeighbors2;
+      neighbors (aKeep,   aNeighbors1);
+      neighbors (aRemove, aNeighbors2);
+      if (nbCommon (aNeighbors1, aNeighbors2) != aShared.Length())
+      {
+        return Standard_False;
+      }
+
+      // triangles changed by collapse should not be flipped or degenerated
+      for (Standard_Integer aNodeIter = 0; aNodeIter < 2; ++aNodeIter)
+      {
+        const Standard_Integer aNode = aNodeIter == 0 ? aKeep : aRemove;
+        for (NCollection_List<Standard_Integer>::Iterator aTriIter (myNodeTris[aNode]); aTriIter.More(); aTriIter.Next())
+        {
+          const Standard_Integer aTri = aTriIter.Value();
+          if (!myIsAliveTri[aTri]
+           || contains (aShared, aTri))
+          {
+            continue;
+          }
+
+          gp_XYZ aPnts[3];
+          for (Standard_Integer aVertIter = 0; aVertIter < 3; ++aVertIter)
+          {
+            const Standard_Integer aTriNode = myTris[aTri].Nodes[aVertIter];
+            aPnts[aVertIter] = aTriNode == aNode ? theCollapse.Target : myNodes[aTriNode];
+          }
+          const gp_XYZ anOldNorm = triNormal (aTri);
+          const gp_XYZ aNewNorm  = (aPnts[1] - aPnts[0]).Crossed (aPnts[2] - aPnts[0]);
+          const Standard_Real anOldMod = anOldNorm.Modulus(), aNewMod = aNewNorm.Modulus();
+          if (aNewMod <= gp::Resolution()
+           || anOldNorm.Dot (aNewNorm) < THE_MIN_FLIP_COS * anOldMod * aNewMod)
+          {
+            return Standard_False;
+          }
+        }
+      }
+      return Standard_True;
+    }
+
+    //! Performs the collapse.
+    void perform (const Collapse& theCollapse)
+    {
+      const Standard_Integer aKeep = theCollapse.Keep, aRemove = theCollapse.Remove;
+      if (!myUVNodes.IsEmpty())
+      {
+        // interpolate UV by the position of the target projected on the edge
+        const gp_XYZ anEdge = myNodes[aRemove] - myNodes[aKeep];
+        const Standard_Real aSqLength = anEdge.SquareModulus();
+        Standard_Real aParam = 0.0;
+        if (aSqLength > gp::Resolution())
+        {
+          aParam = Min (Max ((theCollapse.Target - myNodes[aKeep]).Dot (anEdge) / aSqLength, 0.0), 1.0);
+        }
+        myUVNodes[aKeep] = myUVNodes[aKeep] * (1.0 - aParam) + myUVNodes[aRemove] * aParam;
+      }
+
+      NCollection_List<Standard_Integer>& aKeepTris = myNodeTris[aKeep];
+      for (NCollection_List<Standard_Integer>::Iterator aTriIter (myNodeTris[aRemove]); aTriIter.More(); aTriIter.Next())
+      {
+        const Standard_Integer aTri = aTriIter.Value();
+        if (!myIsAliveTri[aTri])
+        {
+          continue;
+        }
+        if (nodeInTri (aTri, aKeep) != -1)
+        {
+          myIsAliveTri[aTri] = Standard_False;
+          --myNbAliveTris;
+          continue;
+        }
+        myTris[aTri].Nodes[nodeInTri (aTri, aRemove)] = aKeep;
+        aKeepTris.Append (aTri);
+      }
+      for (NCollection_List<Standard_Integer>::Iterator aTriIter (aKeepTris); aTriIter.More();)
+      {
+        if (myIsAliveTri[aTriIter.Value()])
+        {
+          aTriIter.Next();
+        }
+        else
+        {
+          aKeepTris.Remove (aTriIter);
+        }
+      }
+      myNodeTris[aRemove].Clear();
+
+      myNodes[aKeep] = theCollapse.Target;
+      myQuadrics[aKeep] += myQuadrics[aRemove];
+      myIsBoundary[aKeep] = myIsBoundary[aKeep] || myIsBoundary[aRemove];
+      myIsAlive[aRemove] = Standard_False;
+      ++myStamps[aKeep];
+
+      VectorOfInteger& aNeighbors = myTmpNeighbors1;
+      neighbors (aKeep, aNeighbors);
+      for (VectorOfInteger::Iterator aNeighIter (aNeighbors); aNeighIter.More(); aNeighIter.Next())
+      {
+        pushCollapse (aKeep, aNeighIter.Value());
+      }
+    }
+
+  private:
+
+    Handle(NCollection_IncAllocator)                        myAllocator; //!< allocator of the lists of node triangles
+    NCollection_Array1<gp_XYZ>                              myNodes;
+    NCollection_Array1<gp_XY>                               myUVNodes;
+    NCollection_Array1<TriNodes>                            myTris;
+    NCollection_Array1<Standard_Boolean>                    myIsAliveTri;
+    Standard_Integer                                        myNbTris;    //!< number of valid input triangles
+    NCollection_Array1<NCollection_List<Standard_Integer> > myNodeTris;
+    NCollection_Array1<Quadric>                             myQuadrics;
+    NCollection_Array1<Standard_Integer>                    myStamps;
+    NCollection_Array1<Standard_Boolean>                    myIsAlive;
+    NCollection_Array1<Standard_Boolean>                    myIsLocked;
+    NCollection_Array1<Standard_Boolean>                    myIsBoundary;
+    NCollection_Array1<Collapse>                            myHeap;      //!< binary heap of the collapses
+    Standard_Integer                                        myHeapSize;
+    VectorOfInteger                                         myTmpShared; //!< buffers reused by collapses
+    VectorOfInteger                                         myTmpNeighbors1;
+    VectorOfInteger                                         myTmpNeighbors2;
+    Standard_Boolean                                        myToKeepNodes;
+    Standard_Integer                                        myNbAliveTris;
+  };
+
+  //! Functor performing decimators in parallel.
+  struct DecimatorFunctor
+  {
+    DecimatorFunctor (const NCollection_Array1<Handle(Poly_Decimator)>& theDecimators)
+    : myDecimators (theDecimators) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Handle(Poly_Decimator)& aDecimator = myDecimators.Value (theIndex);
+      if (!aDecimator.IsNull())
+      {
+        aDecimator->Perform();
+      }
+    }
+
+    const NCollection_Array1<Handle(Poly_Decimator)>& myDecimators;
+  };
+}
+
+// =======================================================================
+// function : Perform
+// purpose  :
+// =======================================================================
+void Poly_Decimator::Perform (const NCollection_Array1<Handle(Poly_Decimator)>& theDecimators,
+                              const Standard_Boolean theToRunParallel)
+{
+  DecimatorFunctor aFunctor (theDecimators);
+  OSD_Parallel::For (theDecimators.Lower(), theDecimators.Upper() + 1, aFunctor, !theToRunParallel);
+}
+
+// =======================================================================
+// function : Poly_Decimator
+// purpose  :
+// =======================================================================
+Poly_Decimator::Poly_Decimator (const Handle(Poly_Triangulation)& theTris)
+: myInput (theTris),
+  myTargetNbTris (0),
+  myTargetRatio (0.5),
+  myMaxError (-1.0),
+  myFeatureAngle (0.0),
+  myError (0.0),
+  myToPreserveBoundary (Standard_True),
+  myToKeepNodes (Standard_False)
+{
+  //
+}
+
+// =======================================================================
+// function : Perform
+// purpose  :
+// =======================================================================
+Standard_Boolean Poly_Decimator::Perform()
+{
+  myResult.Nullify();
+  myNodesMap = NCollection_Array1<Standard_Integer>();
+  myError = 0.0;
+  if (myInput.IsNull()
+   || !myInput->HasGeometry()
+   || myInput->NbTriangles() < 2)
+  {
+    return Standard_False;
+  }
+
+  const Standard_Integer aTarget = myTargetNbTris > 0
+                                 ? myTargetNbTris
+                                 : (Standard_Integer )(myTargetRatio * myInput->NbTriangles());
+  if (aTarget >= myInput->NbTriangles())
+  {
+    return Standard_False;
+  }
+
+  DecimationMesh aMesh (myInput, myToPreserveBoundary, myFeatureAngle, myToKeepNodes);
+  aMesh.InitCollapses();
+  const Standard_Real aMaxSqError = myMaxError >= 0.0 ? myMaxError * myMaxError : -1.0;
+  Standard_Boolean isDone = Standard_False;
+  while (aMesh.NbTriangles() > aTarget
+      && aMesh.CollapseNext (aMaxSqError, myError))
+  {
+    isDone = Standard_True;
+  }
+  if (!isDone)
+  {
+    return Standard_False;
+  }
+
+  myResult = aMesh.Result (myInput, myNodesMap);
+  // the quadric error is not a distance bound, so the deflection is kept as is
+  myResult->Deflection (myInput->Deflection());
+  return Standard_True;
+}
@@ -0,0 +1,144 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Poly_Decimator_HeaderFile
+#define _Poly_Decimator_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <Poly_Triangulation.hxx>
+
+//! Tool reducing the number of triangles of the triangle mesh
+//! by iterative edge collapses guided by quadric error metric (M. Garland, P. Heckbert).
+//!
+//! Each node accumulates the planes of the original triangles merged into it,
+//! and the error of the node is the sum of squared distances to these planes.
+//! The edges are collapsed in the order of increasing error until the target number
+//! of triangles is reached or the error of the next collapse exceeds the maximum error.
+//! The collapses changing the topology of the mesh or flipping its triangles are rejected.
+//!
+//! By default the nodes on the free edges of the mesh (e.g. on the boundary of the face)
+//! are preserved, so that the decimated triangulation of the face remains conformal
+//! with the triangulations of adjacent faces and the polygons on triangulation
+//! of its edges can be updated using NodeIndex().
+//! Feature edges (with the angle between normals of adjacent triangles exceeding
+//! the feature angle) can be preserved in the same way.
+//! To decimate the whole shape as one mesh, the triangulations of its faces
+//! should be merged beforehand into a single triangulation with shared nodes
+//! (see BRepMesh_WatertightMesh).
+//!
+//! The optimal positions of the nodes are computed without access to the surface,
+//! so that for the triangulation of the face SetKeepNodes() should be used
+//! to keep the nodes on the surface.
+//!
+//! The result does not contain normals, UV nodes are interpolated
+//! along the collapsed edges. The deflection of the result is taken from the input
+//! triangulation, as the quadric error is not a bound of the distance between meshes.
+class Poly_Decimator : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Poly_Decimator, Standard_Transient)
+public:
+
+  //! Performs decimation by the given tools, each one working on its own triangulation.
+  //! @param[in] theDecimators    decimators to perform
+  //! @param[in] theToRunParallel flag to process the triangulations in parallel
+  Standard_EXPORT static void Perform (const NCollection_Array1<Handle(Poly_Decimator)>& theDecimators,
+                                       const Standard_Boolean theToRunParallel);
+
+public:
+
+  //! Constructor.
+  //! @param[in] theTris triangulation to decimate
+  Standard_EXPORT Poly_Decimator (const Handle(Poly_Triangulation)& theTris);
+
+  //! Returns the triangulation to decimate.
+  const Handle(Poly_Triangulation)& Triangulation() const { return myInput; }
+
+  //! Returns the target number of triangles; 0 by default (TargetRatio() is used).
+  Standard_Integer TargetNbTriangles() const { return myTargetNbTris; }
+
+  //! Sets the target number of triangles.
+  void SetTargetNbTriangles (const Standard_Integer theNbTris) { myTargetNbTris = theNbTris; }
+
+  //! Returns the target number of triangles relative to the number of input triangles; 0.5 by default.
+  //! Used when TargetNbTriangles() is not set.
+  Standard_Real TargetRatio() const { return myTargetRatio; }
+
+  //! Sets the target number of triangles relative to the number of input triangles.
+  void SetTargetRatio (const Standard_Real theRatio) { myTargetRatio = theRatio; }
+
+  //! Returns the maximum error of the collapses, as square root of the quadric error;
+  //! negative by default meaning that the error is not limited.
+  Standard_Real MaxError() const { return myMaxError; }
+
+  //! Sets the maximum error of the collapses.
+  void SetMaxError (const Standard_Real theError) { myMaxError = theError; }
+
+  //! Returns TRUE if the nodes on the free edges of the mesh are preserved; TRUE by default.
+  Standard_Boolean ToPreserveBoundary() const { return myToPreserveBoundary; }
+
+  //! Sets if the nodes on the free edges of the mesh should be preserved.
+  //! Otherwise the free edges are decimated as well, being kept in place by extra penalty planes.
+  void SetPreserveBoundary (const Standard_Boolean theToPreserve) { myToPreserveBoundary = theToPreserve; }
+
+  //! Returns the feature angle in radians; 0.0 by default meaning that feature edges are not preserved.
+  Standard_Real FeatureAngle() const { return myFeatureAngle; }
+
+  //! Sets the feature angle in radians;
+  //! the nodes on edges with larger angle between normals of adjacent triangles are preserved.
+  void SetFeatureAngle (const Standard_Real theAngle) { myFeatureAngle = theAngle; }
+
+  //! Returns TRUE if the nodes of the result are taken from the input mesh; FALSE by default.
+  Standard_Boolean ToKeepNodes() const { return myToKeepNodes; }
+
+  //! Sets if the nodes of the result should be taken from the input mesh
+  //! (the edge is collapsed to one of its nodes) instead of optimal positions.
+  //! This keeps the nodes of the triangulation of the face on its surface.
+  void SetKeepNodes (const Standard_Boolean theToKeep) { myToKeepNodes = theToKeep; }
+
+  //! Performs decimation.
+  //! @return TRUE if the number of triangles has been reduced
+  Standard_EXPORT Standard_Boolean Perform();
+
+  //! Returns the decimated triangulation or NULL if nothing has been done.
+  const Handle(Poly_Triangulation)& Result() const { return myResult; }
+
+  //! Returns the index of the node of the input triangulation in the result,
+  //! or 0 if the node has been removed.
+  Standard_Integer NodeIndex (const Standard_Integer theNode) const
+  {
+    return myNodesMap.IsEmpty() ? theNode : myNodesMap.Value (theNode);
+  }
+
+  //! Returns the maximum error of performed collapses, as square root of the quadric error.
+  //! This is a measure of the sum of squared distances to the planes of the original triangles
+  //! merged into the node, not a bound of the distance between the input and the result.
+  Standard_Real Error() const { return myError; }
+
+private:
+
+  Handle(Poly_Triangulation)           myInput;
+  Handle(Poly_Triangulation)           myResult;
+  NCollection_Array1<Standard_Integer> myNodesMap;
+  Standard_Integer                     myTargetNbTris;
+  Standard_Real                        myTargetRatio;
+  Standard_Real                        myMaxError;
+  Standard_Real                        myFeatureAngle;
+  Standard_Real                        myError;
+  Standard_Boolean                     myToPreserveBoundary;
+  Standard_Boolean                     myToKeepNodes;
+
+};
+
+DEFINE_STANDARD_HANDLE(Poly_Decimator, Standard_Transient)
+
+#endif // _Poly_Decimator_HeaderFile
@@ -0,0 +1,450 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Poly_VertexCacheOptimizer.hxx>
+
+#include <cmath>
+
+namespace
+{
+  //! Minimal cache size considered by the algorithm.
+  static const Standard_Integer THE_MIN_CACHE_SIZE = 4;
+
+  //! Compute vertex score for Forsyth algorithm.
+  //! @param[in] theCachePos    vertex position within cache or -1 if vertex is not in cache
+  //! @param[in] theNbTrisLeft  number of not yet emitted triangles using this vertex
+  //! @param[in] theCacheSize   cache size
+  static float vertexScore (const Standard_Integer theCachePos,
+                            const Standard_Integer theNbTrisLeft,
+                            const Standard_Integer theCacheSize)
+  {
+    if (theNbTrisLeft == 0)
+    {
+      return -1.0f; // no triangles left - vertex is useless
+    }
+
+    float aScore = 0.0f;
+    if (theCachePos >= 0)
+    {
+      if (theCachePos < 3)
+      {
+        // vertex has been used by the last triangle - fixed score
+        // to avoid favoring the triangles using the same edge
+        aScore = 0.75f;
+      }
+      else
+      {
+        const float aScaler = 1.0f / float(theCacheSize - 3);
+        aScore = std::pow (1.0f - float(theCachePos - 3) * aScaler, 1.5f);
+      }
+    }
+
+    // boost vertices with few triangles left to get rid of lone vertices
+    aScore += 2.0f / std::sqrt (float(theNbTrisLeft));
+    return aScore;
+  }
+
+  //! Return TRUE if all triangles refer to nodes within specified range.
+  static bool isValidRange (const NCollection_Array1<Poly_Triangle>& theTriangles,
+                            const Standard_Integer theNodeLower,
+                            const Standard_Integer theNbNodes)
+  {
+    const Standard_Integer aNodeUpper = theNodeLower + theNbNodes - 1;
+    for (NCollection_Array1<Poly_Triangle>::Iterator aTriIter (theTriangles); aTriIter.More(); aTriIter.Next())
+    {
+      const Poly_Triangle& aTri = aTriIter.Value();
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= 3; ++aNodeIter)
+      {
+        if (aTri (aNodeIter) < theNodeLower
+         || aTri (aNodeIter) > aNodeUpper)
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+}
+
+// =======================================================================
+// function : Perform
+// purpose  :
+// =======================================================================
+void Poly_VertexCacheOptimizer::Perform (const Handle(Poly_Triangulation)& theTris,
+                                         const Standard_Integer theCacheSize)
+{
+  NCollection_Array1<Standard_Integer> aNewIndices;
+  Perform (theTris, aNewIndices, theCacheSize);
+}
+
+// =======================================================================
+// function : Perform
+// purpose  :
+// =======================================================================
+Standard_Boolean Poly_VertexCacheOptimizer::Perform (const Handle(Poly_Triangulation)& theTris,
+                                                     NCollection_Array1<Standard_Integer>& theNewIndices,
+                                                     const Standard_Integer theCacheSize)
+{
+  if (theTris.IsNull()
+   || theTris->NbTriangles() < 2)
+  {
+    return Standard_False;
+  }
+
+  const Standard_Integer aNbNodes = theTris->NbNodes();
+  const Standard_Integer aNbTris  = theTris->NbTriangles();
+  NCollection_Array1<Poly_Triangle> aTris (1, aNbTris);
+  for (Standard_Integer aTriIter = 1; aTriIter <= aNbTris; ++aTriIter)
+  {
+    aTris.ChangeValue (aTriIter) = theTris->Triangle (aTriIter);
+  }
+  if (!isValidRange (aTris, 1, aNbNodes))
+  {
+    return Standard_False;
+  }
+
+  OptimizeVertexCache (aTris, 1, aNbNodes, theCacheSize);
+
+  theNewIndices.Resize (1, aNbNodes, Standard_False);
+  const NCollection_Array1<Standard_Integer>& aNewIndices = theNewIndices;
+  OptimizeVertexFetch (aTris, 1, theNewIndices);
+  for (Standard_Integer aTriIter = 1; aTriIter <= aNbTris; ++aTriIter)
+  {
+    theTris->SetTriangle (aTriIter, aTris.Value (aTriIter));
+  }
+
+  {
+    NCollection_Array1<gp_Pnt> aNodes (1, aNbNodes);
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      aNodes.ChangeValue (aNodeIter) = theTris->Node (aNodeIter);
+    }
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      theTris->SetNode (aNewIndices.Value (aNodeIter), aNodes.Value (aNodeIter));
+    }
+  }
+  if (theTris->HasUVNodes())
+  {
+    NCollection_Array1<gp_Pnt2d> aNodes (1, aNbNodes);
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      aNodes.ChangeValue (aNodeIter) = theTris->UVNode (aNodeIter);
+    }
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      theTris->SetUVNode (aNewIndices.Value (aNodeIter), aNodes.Value (aNodeIter));
+    }
+  }
+  if (theTris->HasNormals())
+  {
+    NCollection_Array1<gp_Vec3f> aNormals (1, aNbNodes);
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      theTris->Normal (aNodeIter, aNormals.ChangeValue (aNodeIter));
+    }
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      theTris->SetNormal (aNewIndices.Value (aNodeIter), aNormals.Value (aNodeIter));
+    }
+  }
+  return Standard_True;
+}
+
+// =======================================================================
+// function : OptimizeVertexCache
+// purpose  :
+// =======================================================================
+void Poly_VertexCacheOptimizer::OptimizeVertexCache (NCollection_Array1<Poly_Triangle>& theTriangles,
+                                                     const Standard_Integer theNodeLower,
+                                                     const Standard_Integer theNbNodes,
+                                                     const Standard_Integer theCacheSize)
+{
+  const Standard_Integer aNbTris = theTriangles.Size();
+  if (aNbTris < 2
+   || theNbNodes < 1
+   || !isValidRange (theTriangles, theNodeLower, theNbNodes))
+  {
+    return;
+  }
+
+  const Standard_Integer aCacheSize = Max (theCacheSize, THE_MIN_CACHE_SIZE);
+  const Standard_Integer aTriLower  = theTriangles.Lower();
+
+  // build node -> triangles adjacency
+  NCollection_Array1<Standard_Integer> aNbTrisLeft (0, theNbNodes - 1);
+  aNbTrisLeft.Init (0);
+  for (Standard_Integer aTriIter = 0; aTriIter < aNbTris; ++aTriIter)
+  {
+    const Poly_Triangle& aTri = theTriangles.Value (aTriLower + aTriIter);
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= 3; ++aNodeIter)
+    {
+      ++aNbTrisLeft.ChangeValue (aTri (aNodeIter) - theNodeLower);
+    }
+  }
+
+  NCollection_Array1<Standard_Integer> anAdjOffsets (0, theNbNodes);
+  anAdjOffsets.SetValue (0, 0);
+  for (Standard_Integer aNodeIter = 0; aNodeIter < theNbNodes; ++aNodeIter)
+  {
+    anAdjOffsets.SetValue (aNodeIter + 1, anAdjOffsets.Value (aNodeIter) + aNbTrisLeft.Value (aNodeIter));
+  }
+
+  NCollection_Array1<Standard_Integer> anAdjTris (0, aNbTris * 3 - 1);
+  {
+    NCollection_Array1<Standard_Integer> anAdjFill (0, theNbNodes - 1);
+    anAdjFill.Init (0);
+    for (Standard_Integer aTriIter = 0; aTriIter < aNbTris; ++aTriIter)
+    {
+      const Poly_Triangle& aTri = theTriangles.Value (aTriLower + aTriIter);
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= 3; ++aNodeIter)
+      {
+        const Standard_Integer aNode = aTri (aNodeIter) - theNodeLower;
+        anAdjTris.SetValue (anAdjOffsets.Value (aNode) + anAdjFill.ChangeValue (aNode)++, aTriIter);
+      }
+    }
+  }
+
+  // initial scores
+  NCollection_Array1<float> aNodeScore (0, theNbNodes - 1);
+  for (Standard_Integer aNodeIter = 0; aNodeIter < theNbNodes; ++aNodeIter)
+  {
+    aNodeScore.SetValue (aNodeIter, vertexScore (-1, aNbTrisLeft.Value (aNodeIter), aCacheSize));
+  }
+
+  NCollection_Array1<bool> anIsEmitted (0, aNbTris - 1);
+  anIsEmitted.Init (false);
+  Standard_Integer aBestTri = -1;
+  float aBestScore = -1.0f;
+  for (Standard_Integer aTriIter = 0; aTriIter < aNbTris; ++aTriIter)
+  {
+    const Poly_Triangle& aTri = theTriangles.Value (aTriLower + aTriIter);
+    const float aScore = aNodeScore.Value (aTri (1) - theNodeLower)
+                       + aNodeScore.Value (aTri (2) - theNodeLower)
+                       + aNodeScore.Value (aTri (3) - theNodeLower);
+    if (aScore > aBestScore)
+    {
+      aBestScore = aScore;
+      aBestTri   = aTriIter;
+    }
+  }
+
+  // LRU cache is extended by 3 elements to keep track of evicted nodes
+  NCollection_Array1<Standard_Integer> aCache    (0, aCacheSize + 2);
+  NCollection_Array1<Standard_Integer> aNewCache (0, aCacheSize + 2);
+  Standard_Integer aCacheLen = 0;
+
+  NCollection_Array1<Poly_Triangle> aResult (aTriLower, theTriangles.Upper());
+  Standard_Integer aNextUnemitted = 0;
+  for (Standard_Integer anOutIter = 0; anOutIter < aNbTris; ++anOutIter)
+  {
+    if (aBestTri < 0)
+    {
+      // dead end - no triangles adjacent to cached nodes; take the next one in input order
+      while (anIsEmitted.Value (aNextUnemitted))
+      {
+        ++aNextUnemitted;
+      }
+      aBestTri = aNextUnemitted;
+    }
+
+    const Poly_Triangle& aTri = theTriangles.Value (aTriLower + aBestTri);
+    aResult.SetValue (aTriLower + anOutIter, aTri);
+    anIsEmitted.SetValue (aBestTri, true);
+
+    // remove emitted triangle from adjacency lists
+    Standard_Integer aNewCacheLen = 0;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= 3; ++aNodeIter)
+    {
+      const Standard_Integer aNode    = aTri (aNodeIter) - theNodeLower;
+      const Standard_Integer anAdjBeg = anAdjOffsets.Value (aNode);
+      Standard_Integer& aNbLeft = aNbTrisLeft.ChangeValue (aNode);
+      for (Standard_Integer anAdjIter = anAdjBeg; anAdjIter < anAdjBeg + aNbLeft; ++anAdjIter)
+      {
+        if (anAdjTris.Value (anAdjIter) == aBestTri)
+        {
+          anAdjTris.SetValue (anAdjIter, anAdjTris.Value (anAdjBeg + aNbLeft - 1));
+          --aNbLeft;
+          break;
+        }
+      }
+
+      bool isDuplicate = false;
+      for (Standard_Integer aCacheIter = 0; aCacheIter < aNewCacheLen; ++aCacheIter)
+      {
+        isDuplicate = isDuplicate || aNewCache.Value (aCacheIter) == aNode;
+      }
+      if (!isDuplicate)
+      {
+        aNewCache.SetValue (aNewCacheLen++, aNode);
+      }
+    }
+
+    // push emitted nodes to the front of the cache
+    for (Standard_Integer aCacheIter = 0; aCacheIter < aCacheLen; ++aCacheIter)
+    {
+      const Standard_Integer aNode = aCache.Value (aCacheIter);
+      if (aNode != aTri (1) - theNodeLower
+       && aNode != aTri (2) - theNodeLower
+       && aNode != aTri (3) - theNodeLower)
+      {
+        aNewCache.SetValue (aNewCacheLen++, aNode);
+      }
+    }
+
+    // update scores of cached and evicted nodes
+    for (Standard_Integer aCacheIter = 0; aCacheIter < aNewCacheLen; ++aCacheIter)
+    {
+      const Standard_Integer aNode = aNewCache.Value (aCacheIter);
+      const Standard_Integer aPos  = aCacheIter < aCacheSize ? aCacheIter : -1;
+      aNodeScore.SetValue (aNode, vertexScore (aPos, aNbTrisLeft.Value (aNode), aCacheSize));
+    }
+
+    // update scores of triangles adjacent to cached and evicted nodes and find the best one
+    aBestTri   = -1;
+    aBestScore = -1.0f;
+    for (Standard_Integer aCacheIter = 0; aCacheIter < aNewCacheLen; ++aCacheIter)
+    {
+      const Standard_Integer aNode    = aNewCache.Value (aCacheIter);
+      const Standard_Integer anAdjBeg = anAdjOffsets.Value (aNode);
+      const Standard_Integer anAdjEnd = anAdjBeg + aNbTrisLeft.Value (aNode);
+      for (Standard_Integer anAdjIter = anAdjBeg; anAdjIter < anAdjEnd; ++anAdjIter)
+      {
+        const Standard_Integer anAdjTri = anAdjTris.Value (anAdjIter);
+        const Poly_Triangle& anAdj = theTriangles.Value (aTriLower + anAdjTri);
+        const float aScore = aNodeScore.Value (anAdj (1) - theNodeLower)
+                           + aNodeScore.Value (anAdj (2) - theNodeLower)
+                           + aNodeScore.Value (anAdj (3) - theNodeLower);
+        if (aScore > aBestScore)
+        {
+          aBestScore = aScore;
+          aBestTri   = anAdjTri;
+        }
+      }
+    }
+
+    aCacheLen = Min (aNewCacheLen, aCacheSize);
+    for (Standard_Integer aCacheIter = 0; aCacheIter < aCacheLen; ++aCacheIter)
+    {
+      aCache.SetValue (aCacheIter, aNewCache.Value (aCacheIter));
+    }
+  }
+
+  for (Standard_Integer aTriIter = theTriangles.Lower(); aTriIter <= theTriangles.Upper(); ++aTriIter)
+  {
+    theTriangles.SetValue (aTriIter, aResult.Value (aTriIter));
+  }
+}
+
+// =======================================================================
+// function : OptimizeVertexFetch
+// purpose  :
+// =======================================================================
+void Poly_VertexCacheOptimizer::OptimizeVertexFetch (NCollection_Array1<Poly_Triangle>& theTriangles,
+                                                     const Standard_Integer theNodeLower,
+                                                     NCollection_Array1<Standard_Integer>& theNewIndices)
+{
+  const Standard_Integer aNbNodes = theNewIndices.Size();
+  if (!isValidRange (theTriangles, theNodeLower, aNbNodes))
+  {
+    for (Standard_Integer aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+    {
+      theNewIndices.SetValue (theNewIndices.Lower() + aNodeIter, theNodeLower + aNodeIter);
+    }
+    return;
+  }
+
+  // theNewIndices is indexed by old node position relative to its lower bound
+  const Standard_Integer anIndLower = theNewIndices.Lower();
+  theNewIndices.Init (-1);
+  Standard_Integer aNextIndex = theNodeLower;
+  for (NCollection_Array1<Poly_Triangle>::Iterator aTriIter (theTriangles); aTriIter.More(); aTriIter.Next())
+  {
+    Poly_Triangle& aTri = aTriIter.ChangeValue();
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= 3; ++aNodeIter)
+    {
+      Standard_Integer& aNewIndex = theNewIndices.ChangeValue (anIndLower + aTri (aNodeIter) - theNodeLower);
+      if (aNewIndex == -1)
+      {
+        aNewIndex = aNextIndex++;
+      }
+      aTri (aNodeIter) = aNewIndex;
+    }
+  }
+
+  // keep unused nodes at the end
+  for (NCollection_Array1<Standard_Integer>::Iterator anIndIter (theNewIndices); anIndIter.More(); anIndIter.Next())
+  {
+    if (anIndIter.Value() == -1)
+    {
+      anIndIter.ChangeValue() = aNextIndex++;
+    }
+  }
+}
+
+// =======================================================================
+// function : CacheMissRatio
+// purpose  :
+// =======================================================================
+Standard_Real Poly_VertexCacheOptimizer::CacheMissRatio (const NCollection_Array1<Poly_Triangle>& theTriangles,
+                                                         const Standard_Integer theNodeLower,
+                                                         const Standard_Integer theNbNodes,
+                                                         const Standard_Integer theCacheSize)
+{
+  if (theTriangles.IsEmpty()
+   || theNbNodes < 1
+   || !isValidRange (theTriangles, theNodeLower, theNbNodes))
+  {
+    return 0.0;
+  }
+
+  // FIFO cache simulation using timestamps of node insertion
+  const Standard_Integer aCacheSize = Max (theCacheSize, 1);
+  NCollection_Array1<Standard_Integer> aTimeStamps (0, theNbNodes - 1);
+  aTimeStamps.Init (-aCacheSize - 1);
+  Standard_Integer aNbMisses = 0;
+  for (NCollection_Array1<Poly_Triangle>::Iterator aTriIter (theTriangles); aTriIter.More(); aTriIter.Next())
+  {
+    const Poly_Triangle& aTri = aTriIter.Value();
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= 3; ++aNodeIter)
+    {
+      Standard_Integer& aTimeStamp = aTimeStamps.ChangeValue (aTri (aNodeIter) - theNodeLower);
+      if (aNbMisses - aTimeStamp > aCacheSize)
+      {
+        aTimeStamp = aNbMisses++;
+      }
+    }
+  }
+  return Standard_Real(aNbMisses) / Standard_Real(theTriangles.Size());
+}
+
+// =======================================================================
+// function : CacheMissRatio
+// purpose  :
+// =======================================================================
+Standard_Real Poly_VertexCacheOptimizer::CacheMissRatio (const Handle(Poly_Triangulation)& theTris,
+                                                         const Standard_Integer theCacheSize)
+{
+  if (theTris.IsNull()
+   || theTris->NbTriangles() < 1)
+  {
+    return 0.0;
+  }
+
+  NCollection_Array1<Poly_Triangle> aTris (1, theTris->NbTriangles());
+  for (Standard_Integer aTriIter = 1; aTriIter <= theTris->NbTriangles(); ++aTriIter)
+  {
+    aTris.ChangeValue (aTriIter) = theTris->Triangle (aTriIter);
+  }
+  return CacheMissRatio (aTris, 1, theTris->NbNodes(), theCacheSize);
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Poly_VertexCacheOptimizer_HeaderFile
+#define _Poly_VertexCacheOptimizer_HeaderFile
+
+#include <Poly_Triangulation.hxx>
+
+//! Auxiliary tool reordering triangles and nodes of a triangle mesh
+//! for better locality of post-transform vertex cache and vertex fetch on GPU,
+//! which also improves memory access patterns of other consumers iterating mesh elements.
+//!
+//! Triangles are reordered using linear-speed vertex cache optimization algorithm by Tom Forsyth,
+//! nodes are then reordered by first use within the new triangle order.
+//! Optimization does not change mesh geometry nor triangles orientation.
+class Poly_VertexCacheOptimizer
+{
+public:
+
+  //! Reorder triangles and nodes of the triangulation in place (including normals and UV nodes).
+  //! @param[in] theTris      triangulation to optimize
+  //! @param[in] theCacheSize simulated vertex cache size
+  Standard_EXPORT static void Perform (const Handle(Poly_Triangulation)& theTris,
+                                       const Standard_Integer theCacheSize = 32);
+
+  //! Reorder triangles and nodes of the triangulation in place (including normals and UV nodes)
+  //! and return new node indices, so that objects referring to the nodes (like polygons on triangulation) could be updated.
+  //! @param[in] theTris      triangulation to optimize
+  //! @param[out] theNewIndices array defining new index for each old node (within [1, NbNodes] range)
+  //! @param[in] theCacheSize simulated vertex cache size
+  //! @return FALSE if triangulation has been left unchanged
+  Standard_EXPORT static Standard_Boolean Perform (const Handle(Poly_Triangulation)& theTris,
+                                                   NCollection_Array1<Standard_Integer>& theNewIndices,
+                                                   const Standard_Integer theCacheSize = 32);
+
+  //! Reorder triangles to improve post-transform vertex cache efficiency.
+  //! @param[in,out] theTriangles triangles to reorder
+  //! @param[in] theNodeLower lower index of nodes referred by triangles (1 for Poly_Triangulation)
+  //! @param[in] theNbNodes   number of nodes referred by triangles,
+  //!                         so that node indices are within [theNodeLower, theNodeLower + theNbNodes) range
+  //! @param[in] theCacheSize simulated vertex cache size
+  Standard_EXPORT static void OptimizeVertexCache (NCollection_Array1<Poly_Triangle>& theTriangles,
+                                                   const Standard_Integer theNodeLower,
+                                                   const Standard_Integer theNbNodes,
+                                                   const Standard_Integer theCacheSize = 32);
+
+  //! Compute new order of nodes by their first use within triangles (to improve vertex fetch locality)
+  //! and update triangles to refer to new node indices.
+  //! Nodes unused by triangles are moved to the end preserving their relative order.
+  //! @param[in,out] theTriangles triangles to update
+  //! @param[in] theNodeLower lower index of nodes referred by triangles (1 for Poly_Triangulation)
+  //! @param[out] theNewIndices array of size equal to number of nodes, defining new index for each old node
+  Standard_EXPORT static void OptimizeVertexFetch (NCollection_Array1<Poly_Triangle>& theTriangles,
+                                                   const Standard_Integer theNodeLower,
+                                                   NCollection_Array1<Standard_Integer>& theNewIndices);
+
+  //! Compute average cache miss ratio (ACMR) - number of transformed vertices per triangle,
+  //! simulating FIFO vertex cache of specified size.
+  //! Values close to 0.5 are optimal for regular meshes, 3.0 is the worst case.
+  //! @param[in] theTriangles triangles to evaluate
+  //! @param[in] theNodeLower lower index of nodes referred by triangles
+  //! @param[in] theNbNodes   number of nodes referred by triangles
+  //! @param[in] theCacheSize simulated FIFO cache size
+  Standard_EXPORT static Standard_Real CacheMissRatio (const NCollection_Array1<Poly_Triangle>& theTriangles,
+                                                       const Standard_Integer theNodeLower,
+                                                       const Standard_Integer theNbNodes,
+                                                       const Standard_Integer theCacheSize = 16);
+
+  //! Compute average cache miss ratio (ACMR) of the triangulation.
+  //! @param[in] theTris      triangulation to evaluate
+  //! @param[in] theCacheSize simulated FIFO cache size
+  Standard_EXPORT static Standard_Real CacheMissRatio (const Handle(Poly_Triangulation)& theTris,
+                                                       const Standard_Integer theCacheSize = 16);
+
+};
+
+#endif // _Poly_VertexCacheOptimizer_HeaderFile
@@ -24,6 +24,7 @@
 #include <OSD_Parallel.hxx>
 #include <OSD_Path.hxx>
 #include <OSD_Timer.hxx>
+#include <Poly_VertexCacheOptimizer.hxx>
 #include <RWGltf_GltfAccessorLayout.hxx>
 #include <RWGltf_GltfArrayType.hxx>
 #include <RWGltf_GltfMaterialMap.hxx>
@@ -32,6 +33,7 @@
 #include <RWGltf_GltfSceneNodeMap.hxx>
 #include <RWMesh.hxx>
 #include <RWMesh_FaceIterator.hxx>
+#include <Standard_HashUtils.hxx>
 #include <Standard_Version.hxx>
 #include <TDataStd_Name.hxx>
 #include <TDF_Tool.hxx>
@@ -92,6 +94,150 @@ namespace
     theStream.write ((const char* )theTri.GetData(), sizeof(theTri));
   }
 
+  //! Return TRUE if texture UV coordinates of the face should be exported.
+  static bool toExportTexCoords (const RWMesh_FaceIterator& theFaceIter,
+                                 const bool theIsForcedUVExport)
+  {
+    if (!theFaceIter.HasTexCoords())
+    {
+      return false;
+    }
+    if (theIsForcedUVExport)
+    {
+      return true;
+    }
+
+    const Handle(XCAFDoc_VisMaterial)& aMat = theFaceIter.FaceStyle().Material();
+    return !aMat.IsNull()
+        && (!RWGltf_GltfMaterialMap::baseColorTexture (aMat).IsNull()
+         || !aMat->PbrMaterial().MetallicRoughnessTexture.IsNull()
+         || !aMat->PbrMaterial().EmissiveTexture.IsNull()
+         || !aMat->PbrMaterial().OcclusionTexture.IsNull()
+         || !aMat->PbrMaterial().NormalTexture.IsNull());
+  }
+
+  //! Write vector data into the stream as a single block.
+  template<typename TheVec>
+  static void writeVector (std::ostream& theStream,
+                           const std::vector<TheVec>& theVec)
+  {
+    if (!theVec.empty())
+    {
+      theStream.write ((const char* )theVec.data(), std::streamsize(theVec.size() * sizeof(TheVec)));
+    }
+  }
+
+  //! Compute hash of vector content.
+  template<typename TheVec>
+  static size_t hashVector (const std::vector<TheVec>& theVec,
+                            const size_t theSeed)
+  {
+    if (theVec.empty())
+    {
+      return theSeed;
+    }
+
+    // hashBytes() takes the length as int, so that large buffers are hashed by chunks
+    const Standard_Size aMaxChunk = Standard_Size(1) << 30;
+    const char* aData = (const char* )theVec.data();
+    Standard_Size aLength = theVec.size() * sizeof(TheVec);
+    size_t aHash = opencascade::hash_combine (aLength, sizeof(Standard_Size), theSeed);
+    while (aLength > 0)
+    {
+      const Standard_Size aChunk = aLength < aMaxChunk ? aLength : aMaxChunk;
+      const size_t aChunkHash = opencascade::hashBytes (aData, int(aChunk));
+      aHash = opencascade::hash_combine (aChunkHash, sizeof(size_t), aHash);
+      aData   += aChunk;
+      aLength -= aChunk;
+    }
+    return aHash;
+  }
+
+  //! Quantize normal component into normalized signed integer.
+  template<typename TheInt>
+  static TheInt quantizeNorm (const float theValue)
+  {
+    const float aMax = float(std::numeric_limits<TheInt>::max());
+    return (TheInt )std::floor (Max (-1.0f, Min (1.0f, theValue)) * aMax + 0.5f);
+  }
+
+  //! Reorder vector elements according to new indices.
+  template<typename TheVec>
+  static void reorderVector (std::vector<TheVec>& theVec,
+                             const NCollection_Array1<Standard_Integer>& theNewIndices)
+  {
+    if (theVec.empty())
+    {
+      return;
+    }
+    std::vector<TheVec> aCopy (theVec);
+    for (size_t anIter = 0; anIter < aCopy.size(); ++anIter)
+    {
+      theVec[theNewIndices.Value ((Standard_Integer )anIter)] = aCopy[anIter];
+    }
+  }
+
+  //! Reorder triangles and nodes of the mesh for vertex cache and vertex fetch locality.
+  static void optimizeVertexCache (RWGltf_CafWriter::Mesh& theMesh)
+  {
+    const size_t aNbNodes = theMesh.NodesVec.size();
+    if (theMesh.IndicesVec.size() < 2
+     || (!theMesh.NormalsVec.empty()   && theMesh.NormalsVec.size()   != aNbNodes)
+     || (!theMesh.TexCoordsVec.empty() && theMesh.TexCoordsVec.size() != aNbNodes))
+    {
+      // inconsistent nodal attributes cannot be reordered
+      return;
+    }
+
+    // triangles refer to nodes starting from 0
+    NCollection_Array1<Poly_Triangle> aTris (theMesh.IndicesVec.front(), 0, (Standard_Integer )theMesh.IndicesVec.size() - 1);
+    Poly_VertexCacheOptimizer::OptimizeVertexCache (aTris, 0, (Standard_Integer )aNbNodes);
+
+    NCollection_Array1<Standard_Integer> aNewIndices (0, (Standard_Integer )aNbNodes - 1);
+    Poly_VertexCacheOptimizer::OptimizeVertexFetch (aTris, 0, aNewIndices);
+    reorderVector (theMesh.NodesVec,     aNewIndices);
+    reorderVector (theMesh.NormalsVec,   aNewIndices);
+    reorderVector (theMesh.TexCoordsVec, aNewIndices);
+  }
+
+  //! Primitive array data encoded for writing into binary file in pipelined mode.
+  struct RWGltf_EncodedFace
+  {
+    Handle(RWGltf_GltfFace) Face;      //!< glTF face definition
+    RWGltf_CafWriter::Mesh  Mesh;      //!< transformed nodal data and triangles
+    std::vector<uint16_t>   Indices16; //!< triangle indices packed into 16-bit integers
+    Graphic3d_BndBox3d      BndBox;    //!< bounding box of transformed nodes
+    size_t                  Hash;      //!< content hash
+    int                     SameAs;    //!< index of the preceding face with identical content, or -1
+
+    std::vector<NCollection_Vec4<uint16_t>> QuantNodes;     //!< quantized nodes (padded to 4 components)
+    std::vector<NCollection_Vec4<int8_t>>   QuantNormals8;  //!< normals quantized into normalized bytes
+    std::vector<NCollection_Vec4<int16_t>>  QuantNormals16; //!< normals quantized into normalized shorts
+    Graphic3d_BndBox3d                      QuantBndBox;    //!< bounding box of quantized nodes
+
+    RWGltf_EncodedFace() : Hash (0), SameAs (-1) {}
+
+    //! Return TRUE if content is equal to another face.
+    bool IsEqual (const RWGltf_EncodedFace& theOther) const
+    {
+      return Hash == theOther.Hash
+          && isEqualVec (Mesh.NodesVec,     theOther.Mesh.NodesVec)
+          && isEqualVec (Mesh.NormalsVec,   theOther.Mesh.NormalsVec)
+          && isEqualVec (Mesh.TexCoordsVec, theOther.Mesh.TexCoordsVec)
+          && isEqualVec (Mesh.IndicesVec,   theOther.Mesh.IndicesVec);
+    }
+
+  private:
+    template<typename TheVec>
+    static bool isEqualVec (const std::vector<TheVec>& theVec1,
+                            const std::vector<TheVec>& theVec2)
+    {
+      return theVec1.size() == theVec2.size()
+          && (theVec1.empty()
+           || memcmp (theVec1.data(), theVec2.data(), theVec1.size() * sizeof(TheVec)) == 0);
+    }
+  };
+
 #ifdef HAVE_DRACO
   //! Write nodes to Draco mesh
   static void writeNodesToDracoMesh (draco::Mesh& theMesh,
@@ -253,7 +399,10 @@ RWGltf_CafWriter::RWGltf_CafWriter (const TCollection_AsciiString& theFile,
   myToMergeFaces (false),
   myToSplitIndices16 (false),
   myBinDataLen64  (0),
-  myToParallel (false)
+  myToParallel (false),
+  myToWritePipelined (false),
+  myToMergeMeshes (false),
+  myToOptimizeVertexCache (false)
 {
   myCSTrsf.SetOutputLengthUnit (1.0); // meters
   myCSTrsf.SetOutputCoordinateSystem (RWMesh_CoordinateSystem_glTF);
@@ -398,26 +547,10 @@ void RWGltf_CafWriter::saveTextCoords (RWGltf_GltfFace& theGltfFace,
                                        Standard_Integer& theAccessorNb,
                                        const std::shared_ptr<RWGltf_CafWriter::Mesh>& theMesh) const
 {
-  if (!theFaceIter.HasTexCoords())
+  if (!toExportTexCoords (theFaceIter, myIsForcedUVExport))
   {
     return;
   }
-  if (!myIsForcedUVExport)
-  {
-    if (theFaceIter.FaceStyle().Material().IsNull())
-    {
-      return;
-    }
-
-    if (RWGltf_GltfMaterialMap::baseColorTexture (theFaceIter.FaceStyle().Material()).IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().MetallicRoughnessTexture.IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().EmissiveTexture.IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().OcclusionTexture.IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().NormalTexture.IsNull())
-    {
-      return;
-    }
-  }
 
   if (theGltfFace.NodeUV.Id == RWGltf_GltfAccessor::INVALID_ID)
   {
@@ -513,6 +646,471 @@ void RWGltf_CafWriter::saveIndices (RWGltf_GltfFace& theGltfFace,
   }
 }
 
+// =======================================================================
+// function : fillFaceMesh
+// purpose  :
+// =======================================================================
+void RWGltf_CafWriter::fillFaceMesh (RWGltf_CafWriter::Mesh& theMesh,
+                                     Graphic3d_BndBox3d& theBndBox,
+                                     const RWGltf_GltfFace& theGltfFace) const
+{
+  Standard_Integer aNbNodes = 0, aNbTris = 0;
+  for (RWMesh_FaceIterator aFaceIter (theGltfFace.Shape, theGltfFace.Style); aFaceIter.More(); aFaceIter.Next())
+  {
+    aNbNodes += aFaceIter.NbNodes();
+    aNbTris  += aFaceIter.NbTriangles();
+  }
+  theMesh.NodesVec  .reserve (aNbNodes);
+  theMesh.IndicesVec.reserve (aNbTris);
+
+  Standard_Integer aNbIndexedNodes = 0;
+  for (RWMesh_FaceIterator aFaceIter (theGltfFace.Shape, theGltfFace.Style); aFaceIter.More(); aFaceIter.Next())
+  {
+    const Standard_Integer aNodeUpper = aFaceIter.NodeUpper();
+    for (Standard_Integer aNodeIter = aFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
+    {
+      gp_XYZ aNode = aFaceIter.NodeTransformed (aNodeIter).XYZ();
+      myCSTrsf.TransformPosition (aNode);
+      theBndBox.Add (Graphic3d_Vec3d (aNode.X(), aNode.Y(), aNode.Z()));
+      theMesh.NodesVec.push_back (Graphic3d_Vec3 (float(aNode.X()), float(aNode.Y()), float(aNode.Z())));
+    }
+
+    if (aFaceIter.HasNormals())
+    {
+      for (Standard_Integer aNodeIter = aFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
+      {
+        const gp_Dir aNormal = aFaceIter.NormalTransformed (aNodeIter);
+        Graphic3d_Vec3 aVecNormal ((float )aNormal.X(), (float )aNormal.Y(), (float )aNormal.Z());
+        myCSTrsf.TransformNormal (aVecNormal);
+        theMesh.NormalsVec.push_back (aVecNormal);
+      }
+    }
+
+    if (toExportTexCoords (aFaceIter, myIsForcedUVExport))
+    {
+      for (Standard_Integer aNodeIter = aFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
+      {
+        const gp_Pnt2d aTexCoord = aFaceIter.NodeTexCoord (aNodeIter);
+        theMesh.TexCoordsVec.push_back (Graphic3d_Vec2 ((float )aTexCoord.X(), (float )(1.0 - aTexCoord.Y())));
+      }
+    }
+
+    const Standard_Integer aNodeFirst = aNbIndexedNodes - aFaceIter.ElemLower();
+    aNbIndexedNodes += aFaceIter.NbNodes();
+    const Standard_Integer anElemUpper = aFaceIter.ElemUpper();
+    for (Standard_Integer anElemIter = aFaceIter.ElemLower(); anElemIter <= anElemUpper; ++anElemIter)
+    {
+      Poly_Triangle aTri = aFaceIter.TriangleOriented (anElemIter);
+      aTri(1) += aNodeFirst;
+      aTri(2) += aNodeFirst;
+      aTri(3) += aNodeFirst;
+      theMesh.IndicesVec.push_back (aTri);
+    }
+  }
+}
+
+// =======================================================================
+// function : writeBinDataPipelined
+// purpose  :
+// =======================================================================
+bool RWGltf_CafWriter::writeBinDataPipelined (std::ostream& theBinFile,
+                                              const Message_ProgressRange& theProgress)
+{
+  Standard_STATIC_ASSERT (sizeof(Poly_Triangle) == sizeof(Graphic3d_Vec3i));
+  Message_ProgressScope aPSentry (theProgress, "Binary data", 2);
+
+  // collect primitive arrays in order of writing;
+  // faces sharing the same Shape refer to the first one
+  std::vector<RWGltf_EncodedFace> aFaces;
+  {
+    NCollection_Map<Handle(RWGltf_GltfFaceList)> aWrittenFaces;
+    NCollection_DataMap<TopoDS_Shape, int, TopTools_ShapeMapHasher> aWrittenPrimData;
+    for (ShapeToGltfFaceMap::Iterator aBinDataIter (myBinDataMap); aBinDataIter.More(); aBinDataIter.Next())
+    {
+      const Handle(RWGltf_GltfFaceList)& aGltfFaceList = aBinDataIter.Value();
+      if (!aWrittenFaces.Add (aGltfFaceList)) // skip repeating faces
+      {
+        continue;
+      }
+
+      for (RWGltf_GltfFaceList::Iterator aGltfFaceIter (*aGltfFaceList); aGltfFaceIter.More(); aGltfFaceIter.Next())
+      {
+        aFaces.push_back (RWGltf_EncodedFace());
+        RWGltf_EncodedFace& anEncFace = aFaces.back();
+        anEncFace.Face = aGltfFaceIter.Value();
+        if (const int* aFirstFace = aWrittenPrimData.Seek (anEncFace.Face->Shape))
+        {
+          anEncFace.SameAs = *aFirstFace;
+        }
+        else
+        {
+          aWrittenPrimData.Bind (anEncFace.Face->Shape, int(aFaces.size()) - 1);
+        }
+      }
+    }
+  }
+
+  //! Functor for parallel encoding of primitive arrays.
+  class FaceEncodingFunctor
+  {
+  public:
+    FaceEncodingFunctor (const RWGltf_CafWriter& theWriter,
+                         std::vector<RWGltf_EncodedFace>& theFaces,
+                         const bool theToHash,
+                         const bool theToOptimize)
+    : myWriter (&theWriter), myFaces (&theFaces), myToHash (theToHash), myToOptimize (theToOptimize) {}
+
+    void operator() (int theFaceIndex) const
+    {
+      RWGltf_EncodedFace& anEncFace = myFaces->at (theFaceIndex);
+      if (anEncFace.SameAs != -1)
+      {
+        return;
+      }
+
+      RWGltf_CafWriter::Mesh& aMesh = anEncFace.Mesh;
+      myWriter->fillFaceMesh (aMesh, anEncFace.BndBox, *anEncFace.Face);
+      if (myToOptimize)
+      {
+        optimizeVertexCache (aMesh);
+      }
+      if (aMesh.NodesVec.size() <= std::numeric_limits<uint16_t>::max())
+      {
+        anEncFace.Indices16.resize (aMesh.IndicesVec.size() * 3);
+        for (size_t aTriIter = 0; aTriIter < aMesh.IndicesVec.size(); ++aTriIter)
+        {
+          const Poly_Triangle& aTri = aMesh.IndicesVec[aTriIter];
+          anEncFace.Indices16[aTriIter * 3 + 0] = (uint16_t )aTri(1);
+          anEncFace.Indices16[aTriIter * 3 + 1] = (uint16_t )aTri(2);
+          anEncFace.Indices16[aTriIter * 3 + 2] = (uint16_t )aTri(3);
+        }
+      }
+
+      if (myToHash)
+      {
+        size_t aHash = opencascade::MurmurHash::optimalSeed();
+        aHash = hashVector (aMesh.NodesVec,     aHash);
+        aHash = hashVector (aMesh.NormalsVec,   aHash);
+        aHash = hashVector (aMesh.TexCoordsVec, aHash);
+        aHash = hashVector (aMesh.IndicesVec,   aHash);
+        anEncFace.Hash = aHash;
+      }
+    }
+
+  private:
+    const RWGltf_CafWriter*          myWriter;
+    std::vector<RWGltf_EncodedFace>* myFaces;
+    bool                             myToHash;
+    bool                             myToOptimize;
+  };
+
+  FaceEncodingFunctor aFunctor (*this, aFaces, myToMergeMeshes, myToOptimizeVertexCache);
+  OSD_Parallel::For (0, int(aFaces.size()), aFunctor, !myToParallel);
+  aPSentry.Next();
+  if (!aPSentry.More())
+  {
+    return false;
+  }
+
+  // share primitive arrays with identical content
+  if (myToMergeMeshes)
+  {
+    NCollection_DataMap<size_t, NCollection_List<int>> aHashMap;
+    for (size_t aFaceIter = 0; aFaceIter < aFaces.size(); ++aFaceIter)
+    {
+      RWGltf_EncodedFace& anEncFace = aFaces[aFaceIter];
+      if (anEncFace.SameAs != -1)
+      {
+        continue;
+      }
+
+      NCollection_List<int>* aSameHashFaces = aHashMap.ChangeSeek (anEncFace.Hash);
+      if (aSameHashFaces == NULL)
+      {
+        aSameHashFaces = aHashMap.Bound (anEncFace.Hash, NCollection_List<int>());
+      }
+      for (NCollection_List<int>::Iterator aSameIter (*aSameHashFaces); aSameIter.More(); aSameIter.Next())
+      {
+        if (aFaces[aSameIter.Value()].IsEqual (anEncFace))
+        {
+          anEncFace.SameAs = aSameIter.Value();
+          anEncFace.Mesh = RWGltf_CafWriter::Mesh();
+          anEncFace.Indices16.clear();
+          break;
+        }
+      }
+      if (anEncFace.SameAs == -1)
+      {
+        aSameHashFaces->Append (int(aFaceIter));
+      }
+    }
+  }
+
+  // quantize nodal attributes using the common grid for positions
+  if (myQuantParameters.MeshQuantization)
+  {
+    Graphic3d_BndBox3d aBox;
+    for (size_t aFaceIter = 0; aFaceIter < aFaces.size(); ++aFaceIter)
+    {
+      if (aFaces[aFaceIter].SameAs == -1)
+      {
+        aBox.Combine (aFaces[aFaceIter].BndBox);
+      }
+    }
+
+    const int aPosBits = Max (1, Min (myQuantParameters.QuantizePositionBits, 16));
+    const Standard_Real aPosRange = Standard_Real((1 << aPosBits) - 1);
+    Graphic3d_Vec3d anOffset, aScale (1.0);
+    if (aBox.IsValid())
+    {
+      const Graphic3d_Vec3d aSize = aBox.Size();
+      const Standard_Real aMaxSize = Max (aSize.x(), Max (aSize.y(), aSize.z()));
+      anOffset = aBox.CornerMin();
+      aScale = Graphic3d_Vec3d (aMaxSize > gp::Resolution() ? aMaxSize / aPosRange : 1.0);
+    }
+
+    // the same uniform scale is used for all axes to keep dequantization transformation compatible with gp_Trsf
+    myPosDequantTrsf.SetScale (gp::Origin(), aScale.x());
+    myPosDequantTrsf.SetTranslationPart (gp_Vec (anOffset.x(), anOffset.y(), anOffset.z()));
+    myBuffViewPos.ByteStride  = sizeof(NCollection_Vec4<uint16_t>);
+    myBuffViewNorm.ByteStride = myQuantParameters.QuantizeNormalBits > 8
+                              ? sizeof(NCollection_Vec4<int16_t>)
+                              : sizeof(NCollection_Vec4<int8_t>);
+
+    //! Functor for parallel quantization of primitive arrays.
+    class FaceQuantizationFunctor
+    {
+    public:
+      FaceQuantizationFunctor (std::vector<RWGltf_EncodedFace>& theFaces,
+                               const Graphic3d_Vec3d& theOffset,
+                               const Standard_Real theScale,
+                               const Standard_Real thePosRange,
+                               const bool theToUseShortNormals)
+      : myFaces (&theFaces), myOffset (theOffset), myInvScale (1.0 / theScale),
+        myPosRange (thePosRange), myToUseShortNormals (theToUseShortNormals) {}
+
+      void operator() (int theFaceIndex) const
+      {
+        RWGltf_EncodedFace& anEncFace = myFaces->at (theFaceIndex);
+        if (anEncFace.SameAs != -1)
+        {
+          return;
+        }
+
+        const RWGltf_CafWriter::Mesh& aMesh = anEncFace.Mesh;
+        anEncFace.QuantNodes.resize (aMesh.NodesVec.size());
+        for (size_t aNodeIter = 0; aNodeIter < aMesh.NodesVec.size(); ++aNodeIter)
+        {
+          const Graphic3d_Vec3d aPos = (Graphic3d_Vec3d (aMesh.NodesVec[aNodeIter]) - myOffset) * myInvScale;
+          NCollection_Vec4<uint16_t>& aQuant = anEncFace.QuantNodes[aNodeIter];
+          aQuant.x() = (uint16_t )Max (0.0, Min (myPosRange, std::floor (aPos.x() + 0.5)));
+          aQuant.y() = (uint16_t )Max (0.0, Min (myPosRange, std::floor (aPos.y() + 0.5)));
+          aQuant.z() = (uint16_t )Max (0.0, Min (myPosRange, std::floor (aPos.z() + 0.5)));
+          aQuant.w() = 0;
+          anEncFace.QuantBndBox.Add (Graphic3d_Vec3d (aQuant.x(), aQuant.y(), aQuant.z()));
+        }
+
+        if (myToUseShortNormals)
+        {
+          anEncFace.QuantNormals16.resize (aMesh.NormalsVec.size());
+          for (size_t aNodeIter = 0; aNodeIter < aMesh.NormalsVec.size(); ++aNodeIter)
+          {
+            const Graphic3d_Vec3& aNorm = aMesh.NormalsVec[aNodeIter];
+            anEncFace.QuantNormals16[aNodeIter] = NCollection_Vec4<int16_t> (quantizeNorm<int16_t> (aNorm.x()),
+                                                                             quantizeNorm<int16_t> (aNorm.y()),
+                                                                             quantizeNorm<int16_t> (aNorm.z()), 0);
+          }
+        }
+        else
+        {
+          anEncFace.QuantNormals8.resize (aMesh.NormalsVec.size());
+          for (size_t aNodeIter = 0; aNodeIter < aMesh.NormalsVec.size(); ++aNodeIter)
+          {
+            const Graphic3d_Vec3& aNorm = aMesh.NormalsVec[aNodeIter];
+            anEncFace.QuantNormals8[aNodeIter] = NCollection_Vec4<int8_t> (quantizeNorm<int8_t> (aNorm.x()),
+                                                                           quantizeNorm<int8_t> (aNorm.y()),
+                                                                           quantizeNorm<int8_t> (aNorm.z()), 0);
+          }
+        }
+      }
+
+    private:
+      std::vector<RWGltf_EncodedFace>* myFaces;
+      Graphic3d_Vec3d                  myOffset;
+      Standard_Real                    myInvScale;
+      Standard_Real                    myPosRange;
+      bool                             myToUseShortNormals;
+    };
+
+    FaceQuantizationFunctor aQuantFunctor (aFaces, anOffset, aScale.x(), aPosRange, myQuantParameters.QuantizeNormalBits > 8);
+    OSD_Parallel::For (0, int(aFaces.size()), aQuantFunctor, !myToParallel);
+  }
+
+  // assign accessors at sequential offsets and write data in the same order as serial writer
+  const RWGltf_GltfArrayType anArrTypes[4] =
+  {
+    RWGltf_GltfArrayType_Position,
+    RWGltf_GltfArrayType_Normal,
+    RWGltf_GltfArrayType_TCoord0,
+    RWGltf_GltfArrayType_Indices
+  };
+  Message_ProgressScope aPSentryWrite (aPSentry.Next(), "Writing binary data", 4);
+  Standard_Integer aNbAccessors = 0;
+  for (Standard_Integer aTypeIter = 0; aTypeIter < 4; ++aTypeIter)
+  {
+    const RWGltf_GltfArrayType anArrType = (RWGltf_GltfArrayType )anArrTypes[aTypeIter];
+    RWGltf_GltfBufferView* aBuffView = NULL;
+    switch (anArrType)
+    {
+      case RWGltf_GltfArrayType_Position: aBuffView = &myBuffViewPos;  break;
+      case RWGltf_GltfArrayType_Normal:   aBuffView = &myBuffViewNorm; break;
+      case RWGltf_GltfArrayType_TCoord0:  aBuffView = &myBuffViewTextCoord; break;
+      case RWGltf_GltfArrayType_Indices:  aBuffView = &myBuffViewInd; break;
+      default: break;
+    }
+    aBuffView->ByteOffset = theBinFile.tellp();
+    for (size_t aFaceIter = 0; aFaceIter < aFaces.size() && aPSentryWrite.More(); ++aFaceIter)
+    {
+      const RWGltf_EncodedFace& anEncFace = aFaces[aFaceIter];
+      RWGltf_GltfFace& aGltfFace = *anEncFace.Face;
+      if (anEncFace.SameAs != -1)
+      {
+        const RWGltf_GltfFace& aSameFace = *aFaces[anEncFace.SameAs].Face;
+        switch (anArrType)
+        {
+          case RWGltf_GltfArrayType_Position: aGltfFace.NodePos  = aSameFace.NodePos;  break;
+          case RWGltf_GltfArrayType_Normal:   aGltfFace.NodeNorm = aSameFace.NodeNorm; break;
+          case RWGltf_GltfArrayType_TCoord0:  aGltfFace.NodeUV   = aSameFace.NodeUV;   break;
+          case RWGltf_GltfArrayType_Indices:  aGltfFace.Indices  = aSameFace.Indices;  break;
+          default: break;
+        }
+        continue;
+      }
+
+      const int64_t aByteOffset = (int64_t )theBinFile.tellp() - aBuffView->ByteOffset;
+      const RWGltf_CafWriter::Mesh& aMesh = anEncFace.Mesh;
+      switch (anArrType)
+      {
+        case RWGltf_GltfArrayType_Position:
+        {
+          if (aMesh.NodesVec.empty())
+          {
+            break;
+          }
+          aGltfFace.NodePos.Id            = aNbAccessors++;
+          aGltfFace.NodePos.ByteOffset    = aByteOffset;
+          aGltfFace.NodePos.Type          = RWGltf_GltfAccessorLayout_Vec3;
+          aGltfFace.NodePos.Count         = (int64_t )aMesh.NodesVec.size();
+          if (myQuantParameters.MeshQuantization)
+          {
+            aGltfFace.NodePos.ComponentType = RWGltf_GltfAccessorCompType_UInt16;
+            aGltfFace.NodePos.BndBox        = anEncFace.QuantBndBox;
+            writeVector (theBinFile, anEncFace.QuantNodes);
+          }
+          else
+          {
+            aGltfFace.NodePos.ComponentType = RWGltf_GltfAccessorCompType_Float32;
+            aGltfFace.NodePos.BndBox        = anEncFace.BndBox;
+            writeVector (theBinFile, aMesh.NodesVec);
+          }
+          break;
+        }
+        case RWGltf_GltfArrayType_Normal:
+        {
+          if (aMesh.NormalsVec.empty())
+          {
+            break;
+          }
+          aGltfFace.NodeNorm.Id            = aNbAccessors++;
+          aGltfFace.NodeNorm.ByteOffset    = aByteOffset;
+          aGltfFace.NodeNorm.Type          = RWGltf_GltfAccessorLayout_Vec3;
+          aGltfFace.NodeNorm.Count         = (int64_t )aMesh.NormalsVec.size();
+          if (!myQuantParameters.MeshQuantization)
+          {
+            aGltfFace.NodeNorm.ComponentType = RWGltf_GltfAccessorCompType_Float32;
+            writeVector (theBinFile, aMesh.NormalsVec);
+          }
+          else if (!anEncFace.QuantNormals16.empty())
+          {
+            aGltfFace.NodeNorm.ComponentType = RWGltf_GltfAccessorCompType_Int16;
+            writeVector (theBinFile, anEncFace.QuantNormals16);
+          }
+          else
+          {
+            aGltfFace.NodeNorm.ComponentType = RWGltf_GltfAccessorCompType_Int8;
+            writeVector (theBinFile, anEncFace.QuantNormals8);
+          }
+          break;
+        }
+        case RWGltf_GltfArrayType_TCoord0:
+        {
+          if (aMesh.TexCoordsVec.empty())
+          {
+            break;
+          }
+          aGltfFace.NodeUV.Id            = aNbAccessors++;
+          aGltfFace.NodeUV.ByteOffset    = aByteOffset;
+          aGltfFace.NodeUV.Type          = RWGltf_GltfAccessorLayout_Vec2;
+          aGltfFace.NodeUV.ComponentType = RWGltf_GltfAccessorCompType_Float32;
+          aGltfFace.NodeUV.Count         = (int64_t )aMesh.TexCoordsVec.size();
+          writeVector (theBinFile, aMesh.TexCoordsVec);
+          break;
+        }
+        case RWGltf_GltfArrayType_Indices:
+        {
+          if (aMesh.IndicesVec.empty())
+          {
+            break;
+          }
+          const bool isIndices16 = aMesh.NodesVec.size() <= std::numeric_limits<uint16_t>::max();
+          aGltfFace.Indices.Id            = aNbAccessors++;
+          aGltfFace.Indices.ByteOffset    = aByteOffset;
+          aGltfFace.Indices.Type          = RWGltf_GltfAccessorLayout_Scalar;
+          aGltfFace.Indices.ComponentType = isIndices16
+                                          ? RWGltf_GltfAccessorCompType_UInt16
+                                          : RWGltf_GltfAccessorCompType_UInt32;
+          aGltfFace.Indices.Count         = (int64_t )aMesh.IndicesVec.size() * 3;
+          if (isIndices16)
+          {
+            writeVector (theBinFile, anEncFace.Indices16);
+          }
+          else
+          {
+            writeVector (theBinFile, aMesh.IndicesVec);
+          }
+          break;
+        }
+        default:
+        {
+          break;
+        }
+      }
+
+      // add alignment by 4 bytes (might happen on RWGltf_GltfAccessorCompType_UInt16 indices)
+      int64_t aContentLen64 = (int64_t )theBinFile.tellp();
+      while (aContentLen64 % 4 != 0)
+      {
+        theBinFile.write (" ", 1);
+        ++aContentLen64;
+      }
+
+      if (!theBinFile.good())
+      {
+        Message::SendFail (TCollection_AsciiString ("File '") + myBinFileNameFull + "' cannot be written");
+        return false;
+      }
+    }
+
+    aBuffView->ByteLength = (int64_t )theBinFile.tellp() - aBuffView->ByteOffset;
+    if (!aPSentryWrite.More())
+    {
+      return false;
+    }
+    aPSentryWrite.Next();
+  }
+  return true;
+}
+
 // =======================================================================
 // function : Perform
 // purpose  :
@@ -576,6 +1174,13 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
     return false;
   }
 #endif
+  if (myDracoParameters.DracoCompression
+   && myQuantParameters.MeshQuantization)
+  {
+    Message::SendFail ("Error: mesh quantization cannot be combined with Draco compression.");
+    return false;
+  }
+  myPosDequantTrsf = gp_Trsf();
 
   myBuffViewPos.Id               = RWGltf_GltfAccessor::INVALID_ID;
   myBuffViewPos.ByteOffset       = 0;
@@ -717,10 +1322,21 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
   }
 
   std::vector<std::shared_ptr<RWGltf_CafWriter::Mesh>> aMeshes;
+  const bool toWritePipelined = !myDracoParameters.DracoCompression
+                             && (myToWritePipelined
+                              || myToMergeMeshes
+                              || myToOptimizeVertexCache
+                              || myQuantParameters.MeshQuantization);
+  if (toWritePipelined
+  && !writeBinDataPipelined (*aBinFile, aPSentryBin.Next (4)))
+  {
+    return false;
+  }
+
   Standard_Integer aNbAccessors = 0;
   NCollection_Map<Handle(RWGltf_GltfFaceList)> aWrittenFaces;
   NCollection_DataMap<TopoDS_Shape, Handle(RWGltf_GltfFace), TopTools_ShapeMapHasher> aWrittenPrimData;
-  for (Standard_Integer aTypeIter = 0; aTypeIter < 4; ++aTypeIter)
+  for (Standard_Integer aTypeIter = 0; aTypeIter < 4 && !toWritePipelined; ++aTypeIter)
   {
     const RWGltf_GltfArrayType anArrType = (RWGltf_GltfArrayType )anArrTypes[aTypeIter];
     RWGltf_GltfBufferView* aBuffView = NULL;
@@ -1365,6 +1981,12 @@ void RWGltf_CafWriter::writeNormals (const RWGltf_GltfFace& theGltfFace)
   }
   myWriter->Key    ("componentType");
   myWriter->Int    (theGltfFace.NodeNorm.ComponentType);
+  if (theGltfFace.NodeNorm.ComponentType != RWGltf_GltfAccessorCompType_Float32)
+  {
+    // quantized normals (KHR_mesh_quantization)
+    myWriter->Key  ("normalized");
+    myWriter->Bool (true);
+  }
   myWriter->Key    ("count");
   myWriter->Int64  (theGltfFace.NodeNorm.Count);
   // min/max values are optional, and not very useful for normals - skip them
@@ -1688,6 +2310,22 @@ void RWGltf_CafWriter::writeExtensions()
     }
     myWriter->EndArray();
   }
+  else if (myQuantParameters.MeshQuantization)
+  {
+    myWriter->Key (RWGltf_GltfRootElementName (RWGltf_GltfRootElement_ExtensionsUsed));
+    myWriter->StartArray();
+    {
+      myWriter->String ("KHR_mesh_quantization");
+    }
+    myWriter->EndArray();
+
+    myWriter->Key (RWGltf_GltfRootElementName (RWGltf_GltfRootElement_ExtensionsRequired));
+    myWriter->StartArray();
+    {
+      myWriter->String ("KHR_mesh_quantization");
+    }
+    myWriter->EndArray();
+  }
 #endif
 }
 
@@ -2036,12 +2674,24 @@ void RWGltf_CafWriter::writeNodes (const Handle(TDocStd_Document)&  theDocument,
         myWriter->EndArray();
       }
     }
-    if (!aDocNode.LocalTrsf.IsIdentity())
+    // Mesh order of current node is equal to order of this node in scene nodes map
+    const Standard_Integer aMeshIdx = !aDocNode.IsAssembly ? theSceneNodeMap.FindIndex (aDocNode.Id) : 0;
+    const bool toDequantize = aMeshIdx > 0 && myPosDequantTrsf.Form() != gp_Identity;
+    if (!aDocNode.LocalTrsf.IsIdentity()
+     || toDequantize)
     {
       gp_Trsf aTrsf = aDocNode.LocalTrsf.Transformation();
       if (aTrsf.Form() != gp_Identity)
       {
         myCSTrsf.TransformTransformation (aTrsf);
+      }
+      if (toDequantize)
+      {
+        // quantized positions (KHR_mesh_quantization) are mapped back to the model space by node transformation
+        aTrsf.Multiply (myPosDequantTrsf);
+      }
+      if (aTrsf.Form() != gp_Identity)
+      {
         const gp_Quaternion aQuaternion = aTrsf.GetRotation();
         const bool hasRotation = Abs (aQuaternion.X())       > gp::Resolution()
                               || Abs (aQuaternion.Y())       > gp::Resolution()
@@ -2112,15 +2762,10 @@ void RWGltf_CafWriter::writeNodes (const Handle(TDocStd_Document)&  theDocument,
         }
       }
     }
-    if (!aDocNode.IsAssembly)
+    if (aMeshIdx > 0)
     {
-      // Mesh order of current node is equal to order of this node in scene nodes map
-      Standard_Integer aMeshIdx = theSceneNodeMap.FindIndex (aDocNode.Id);
-      if (aMeshIdx > 0)
-      {
-        myWriter->Key ("mesh");
-        myWriter->Int (aMeshIdx - 1);
-      }
+      myWriter->Key ("mesh");
+      myWriter->Int (aMeshIdx - 1);
     }
     {
       const TCollection_AsciiString aNodeName = formatName (myNodeNameFormat, aDocNode.Label, aDocNode.RefLabel);
@@ -21,6 +21,7 @@
 #include <RWGltf_DracoParameters.hxx>
 #include <RWGltf_GltfBufferView.hxx>
 #include <RWGltf_GltfFace.hxx>
+#include <RWGltf_QuantizationParameters.hxx>
 #include <RWGltf_WriterTrsfFormat.hxx>
 #include <RWMesh_CoordinateSystemConverter.hxx>
 #include <RWMesh_NameFormat.hxx>
@@ -129,14 +130,48 @@ public:
   bool ToParallel() const { return myToParallel; }
 
   //! Setup multithreaded execution.
+  //! Applies to Draco compression and to pipelined writing of binary data (see SetPipelinedWriting()).
   void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
 
+  //! Return flag to write binary data in pipelined mode; FALSE by default.
+  bool ToPipelinedWriting() const { return myToWritePipelined; }
+
+  //! Set flag to write binary data in pipelined mode (has no effect with Draco compression):
+  //! primitive arrays are encoded into memory (in parallel with ToParallel() option)
+  //! and then written at precomputed offsets.
+  //! Note that saveNodes()/saveNormals()/saveTextCoords()/saveIndices() are not used in this mode.
+  void SetPipelinedWriting (bool theToPipeline) { myToWritePipelined = theToPipeline; }
+
+  //! Return flag to share accessors between primitive arrays with identical content; FALSE by default.
+  bool ToMergeIdenticalMeshes() const { return myToMergeMeshes; }
+
+  //! Set flag to share accessors between primitive arrays with identical content
+  //! (identical nodes, normals, UV coordinates and triangles after transformation).
+  //! Duplicates are detected using content hash, which might help reducing binary data size
+  //! for documents with copied (but not instanced) parts.
+  //! Implies pipelined writing of binary data (see SetPipelinedWriting()); has no effect with Draco compression.
+  void SetMergeIdenticalMeshes (bool theToMerge) { myToMergeMeshes = theToMerge; }
+
   //! Return Draco parameters
   const RWGltf_DracoParameters& CompressionParameters() const { return myDracoParameters; }
 
   //! Set Draco parameters
   void SetCompressionParameters(const RWGltf_DracoParameters& theDracoParameters) { myDracoParameters = theDracoParameters; }
 
+  //! Return mesh quantization parameters (KHR_mesh_quantization).
+  const RWGltf_QuantizationParameters& QuantizationParameters() const { return myQuantParameters; }
+
+  //! Set mesh quantization parameters (KHR_mesh_quantization).
+  //! Quantization implies pipelined writing of binary data (see SetPipelinedWriting()) and cannot be combined with Draco compression.
+  void SetQuantizationParameters (const RWGltf_QuantizationParameters& theParameters) { myQuantParameters = theParameters; }
+
+  //! Return flag to reorder triangles and nodes of primitive arrays for better vertex cache and vertex fetch locality; FALSE by default.
+  bool ToOptimizeVertexCache() const { return myToOptimizeVertexCache; }
+
+  //! Set flag to reorder triangles and nodes of primitive arrays for better vertex cache and vertex fetch locality
+  //! (see Poly_VertexCacheOptimizer); implies pipelined writing of binary data (see SetPipelinedWriting()) and has no effect with Draco compression.
+  void SetOptimizeVertexCache (bool theToOptimize) { myToOptimizeVertexCache = theToOptimize; }
+
   //! Write glTF file and associated binary file.
   //! Triangulation data should be precomputed within shapes!
   //! @param theDocument    [in] input document
@@ -252,6 +287,24 @@ protected:
                                             Standard_Integer& theAccessorNb,
                                             const std::shared_ptr<RWGltf_CafWriter::Mesh>& theMesh);
 
+  //! Fill in nodal and triangle data of glTF face.
+  //! Unlike saveNodes()/saveNormals()/saveTextCoords()/saveIndices(), this method does not modify writer state,
+  //! so that it can be called concurrently for different faces.
+  //! @param[out] theMesh     mesh to fill in
+  //! @param[out] theBndBox   bounding box of transformed nodes
+  //! @param[in]  theGltfFace glTF face definition
+  Standard_EXPORT virtual void fillFaceMesh (RWGltf_CafWriter::Mesh& theMesh,
+                                             Graphic3d_BndBox3d& theBndBox,
+                                             const RWGltf_GltfFace& theGltfFace) const;
+
+  //! Write vertex data of dispatched faces (myBinDataMap) into binary file
+  //! using parallel encoding of primitive arrays (pipelined mode).
+  //! @param[out] theBinFile  output file to write into
+  //! @param[in]  theProgress optional progress indicator
+  //! @return FALSE on file writing failure
+  Standard_EXPORT virtual bool writeBinDataPipelined (std::ostream& theBinFile,
+                                                      const Message_ProgressRange& theProgress);
+
 protected:
 
   //! Write bufferView for vertex positions within RWGltf_GltfRootElement_Accessors section
@@ -414,6 +467,11 @@ protected:
 
   std::vector<RWGltf_GltfBufferView>            myBuffViewsDraco;    //!< vector of buffers view with compression data
   Standard_Boolean                              myToParallel;        //!< flag to use multithreading; FALSE by default
+  Standard_Boolean                              myToWritePipelined;  //!< flag to write binary data in pipelined mode; FALSE by default
+  Standard_Boolean                              myToMergeMeshes;     //!< flag to share accessors between identical primitive arrays
+  Standard_Boolean                              myToOptimizeVertexCache; //!< flag to reorder triangles and nodes for vertex cache locality
+  RWGltf_QuantizationParameters                 myQuantParameters;   //!< mesh quantization parameters
+  gp_Trsf                                       myPosDequantTrsf;    //!< dequantization transformation of quantized positions
   RWGltf_DracoParameters                        myDracoParameters;   //!< Draco parameters
 };
 
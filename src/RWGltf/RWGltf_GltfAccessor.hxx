@@ -34,6 +34,7 @@ public:
   RWGltf_GltfAccessorCompType ComponentType; //!< component type
   Graphic3d_BndBox3d          BndBox;        //!< bounding box
   bool                        IsCompressed;  //!< flag indicating KHR_draco_mesh_compression
+  bool                        IsNormalized;  //!< flag indicating normalized integer values
 
   //! Empty constructor.
   RWGltf_GltfAccessor()
@@ -43,7 +44,8 @@ public:
     ByteStride (0),
     Type (RWGltf_GltfAccessorLayout_UNKNOWN),
     ComponentType (RWGltf_GltfAccessorCompType_UNKNOWN),
-    IsCompressed (false) {}
+    IsCompressed (false),
+    IsNormalized (false) {}
 
 };
 
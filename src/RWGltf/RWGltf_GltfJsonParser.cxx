@@ -38,6 +38,7 @@ namespace
   static const char THE_KHR_materials_common[] = "KHR_materials_common";
   static const char THE_KHR_binary_glTF[]      = "KHR_binary_glTF";
   static const char THE_KHR_draco_mesh_compression[] = "KHR_draco_mesh_compression";
+  static const char THE_KHR_mesh_quantization[] = "KHR_mesh_quantization";
 
   //! Data buffer referring to a portion of another buffer.
   class RWGltf_SubBuffer : public NCollection_Buffer
@@ -245,6 +246,32 @@ bool RWGltf_GltfJsonParser::gltfParseRoots()
       return false;
     }
   }
+
+  if (const RWGltf_JsonValue* anExtsRequired = myGltfRoots[RWGltf_GltfRootElement_ExtensionsRequired].Root())
+  {
+    if (!anExtsRequired->IsArray())
+    {
+      reportGltfWarning ("Member 'extensionsRequired' is not an array.");
+      return true;
+    }
+    for (rapidjson::Value::ConstValueIterator anExtIter = anExtsRequired->Begin();
+         anExtIter != anExtsRequired->End(); ++anExtIter)
+    {
+      if (!anExtIter->IsString())
+      {
+        continue;
+      }
+
+      const TCollection_AsciiString anExtName (anExtIter->GetString());
+      if (anExtName != THE_KHR_mesh_quantization
+       && anExtName != THE_KHR_draco_mesh_compression
+       && anExtName != THE_KHR_binary_glTF
+       && anExtName != THE_KHR_materials_common)
+      {
+        reportGltfWarning ("Required extension '" + anExtName + "' is not supported.");
+      }
+    }
+  }
   return true;
 }
 
@@ -1660,6 +1687,7 @@ bool RWGltf_GltfJsonParser::gltfParseAccessor (const Handle(RWGltf_GltfLatePrimi
   const RWGltf_JsonValue* aByteStride     = findObjectMember (theAccessor, "byteStride"); // byteStride was part of bufferView in glTF 1.0
   const RWGltf_JsonValue* aCompType       = findObjectMember (theAccessor, "componentType");
   const RWGltf_JsonValue* aCount          = findObjectMember (theAccessor, "count");
+  const RWGltf_JsonValue* aNormalized     = findObjectMember (theAccessor, "normalized");
   if (aTypeStr == NULL
   || !aTypeStr->IsString())
   {
@@ -1711,6 +1739,10 @@ bool RWGltf_GltfJsonParser::gltfParseAccessor (const Handle(RWGltf_GltfLatePrimi
                      ? aByteStride->GetInt()
                      : 0;
   aStruct.Count = (int64_t )aCount->GetDouble();
+  aStruct.IsNormalized = aNormalized != NULL
+                      && aNormalized->IsBool()
+                      && aNormalized->GetBool()
+                      && aStruct.ComponentType != RWGltf_GltfAccessorCompType_Float32;
 
   if (aStruct.ByteOffset < 0)
   {
@@ -1772,6 +1804,21 @@ bool RWGltf_GltfJsonParser::gltfParseAccessor (const Handle(RWGltf_GltfLatePrimi
         }
         if (isValidMinMax)
         {
+          if (aStruct.IsNormalized)
+          {
+            // min/max values of normalized accessor are defined before normalization
+            double aNormFactor = 1.0;
+            switch (aStruct.ComponentType)
+            {
+              case RWGltf_GltfAccessorCompType_Int8:   aNormFactor = 127.0;   break;
+              case RWGltf_GltfAccessorCompType_UInt8:  aNormFactor = 255.0;   break;
+              case RWGltf_GltfAccessorCompType_Int16:  aNormFactor = 32767.0; break;
+              case RWGltf_GltfAccessorCompType_UInt16: aNormFactor = 65535.0; break;
+              default: break;
+            }
+            aMinPnt.SetXYZ (aMinPnt.XYZ() / aNormFactor);
+            aMaxPnt.SetXYZ (aMaxPnt.XYZ() / aNormFactor);
+          }
           myCSTrsf.TransformPosition (aMinPnt.ChangeCoord());
           myCSTrsf.TransformPosition (aMaxPnt.ChangeCoord());
 
@@ -0,0 +1,34 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWGltf_QuantizationParameters_HeaderFile
+#define _RWGltf_QuantizationParameters_HeaderFile
+
+//! Mesh quantization parameters (KHR_mesh_quantization extension).
+//! Positions of all primitives are quantized using the same grid (unsigned integers),
+//! which dequantization transformation is put into the nodes referring meshes;
+//! normals are stored as normalized signed integers.
+struct RWGltf_QuantizationParameters
+{
+  RWGltf_QuantizationParameters()
+  : MeshQuantization (false),
+    QuantizePositionBits (16),
+    QuantizeNormalBits (8)
+  {}
+
+  bool MeshQuantization;    //!< flag to use KHR_mesh_quantization extension (FALSE by default)
+  int QuantizePositionBits; //!< quantization bits for position attribute within [1, 16] range (16 by default)
+  int QuantizeNormalBits;   //!< quantization bits for normal attribute: 8 for bytes or 16 for shorts (8 by default)
+};
+
+#endif
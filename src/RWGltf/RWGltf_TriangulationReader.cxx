@@ -33,6 +33,87 @@ namespace
   static const Standard_Integer   THE_LOWER_NODE_INDEX = 1;
   static const Standard_ShortReal THE_NORMAL_PREC2 = 0.001f;
 
+  //! Return size of accessor component in bytes, or 0 for unsupported type.
+  static size_t componentSize (RWGltf_GltfAccessorCompType theType)
+  {
+    switch (theType)
+    {
+      case RWGltf_GltfAccessorCompType_Int8:
+      case RWGltf_GltfAccessorCompType_UInt8:   return 1;
+      case RWGltf_GltfAccessorCompType_Int16:
+      case RWGltf_GltfAccessorCompType_UInt16:  return 2;
+      case RWGltf_GltfAccessorCompType_UInt32:
+      case RWGltf_GltfAccessorCompType_Float32: return 4;
+      default:                                  return 0;
+    }
+  }
+
+  //! Convert integer vector components into floating point values.
+  //! Normalized values are mapped to [0, 1] (unsigned) or [-1, 1] (signed) range (KHR_mesh_quantization).
+  template<typename TheCompType>
+  static Graphic3d_Vec3 dequantizeVec3 (const TheCompType* theComps,
+                                        const bool theIsNormalized)
+  {
+    if (!theIsNormalized)
+    {
+      return Graphic3d_Vec3 ((float )theComps[0], (float )theComps[1], (float )theComps[2]);
+    }
+
+    const float aMaxValue = (float )std::numeric_limits<TheCompType>::max();
+    return Graphic3d_Vec3 (Max ((float )theComps[0] / aMaxValue, -1.0f),
+                           Max ((float )theComps[1] / aMaxValue, -1.0f),
+                           Max ((float )theComps[2] / aMaxValue, -1.0f));
+  }
+
+  //! Read next 3-component vector of the accessor from the buffer.
+  //! Integer components are converted into floating point values within temporary vector.
+  //! @return NULL on reading error
+  static Graphic3d_Vec3* readVec3 (Standard_ReadBuffer& theBuffer,
+                                   std::istream& theStream,
+                                   const RWGltf_GltfAccessor& theAccessor,
+                                   Graphic3d_Vec3& theTmpVec)
+  {
+    switch (theAccessor.ComponentType)
+    {
+      case RWGltf_GltfAccessorCompType_Float32:
+      {
+        return theBuffer.ReadChunk<Graphic3d_Vec3> (theStream);
+      }
+      case RWGltf_GltfAccessorCompType_Int8:
+      {
+        const int8_t* aComps = theBuffer.ReadChunk<int8_t> (theStream);
+        if (aComps == NULL) { return NULL; }
+        theTmpVec = dequantizeVec3 (aComps, theAccessor.IsNormalized);
+        return &theTmpVec;
+      }
+      case RWGltf_GltfAccessorCompType_UInt8:
+      {
+        const uint8_t* aComps = theBuffer.ReadChunk<uint8_t> (theStream);
+        if (aComps == NULL) { return NULL; }
+        theTmpVec = dequantizeVec3 (aComps, theAccessor.IsNormalized);
+        return &theTmpVec;
+      }
+      case RWGltf_GltfAccessorCompType_Int16:
+      {
+        const int16_t* aComps = theBuffer.ReadChunk<int16_t> (theStream);
+        if (aComps == NULL) { return NULL; }
+        theTmpVec = dequantizeVec3 (aComps, theAccessor.IsNormalized);
+        return &theTmpVec;
+      }
+      case RWGltf_GltfAccessorCompType_UInt16:
+      {
+        const uint16_t* aComps = theBuffer.ReadChunk<uint16_t> (theStream);
+        if (aComps == NULL) { return NULL; }
+        theTmpVec = dequantizeVec3 (aComps, theAccessor.IsNormalized);
+        return &theTmpVec;
+      }
+      default:
+      {
+        return NULL;
+      }
+    }
+  }
+
 #ifdef HAVE_DRACO
   //! Return array type from Draco attribute type.
   static RWGltf_GltfArrayType arrayTypeFromDraco (draco::GeometryAttribute::Type theType)
@@ -750,7 +831,10 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
     }
     case RWGltf_GltfArrayType_Position:
     {
-      if (theAccessor.ComponentType != RWGltf_GltfAccessorCompType_Float32
+      // integer positions are allowed by KHR_mesh_quantization extension
+      const size_t aCompSize = componentSize (theAccessor.ComponentType);
+      if (aCompSize == 0
+       || theAccessor.ComponentType == RWGltf_GltfAccessorCompType_UInt32
        || theAccessor.Type != RWGltf_GltfAccessorLayout_Vec3)
       {
         break;
@@ -761,21 +845,23 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
         return false;
       }
 
+      const size_t anElemSize = aCompSize * 3;
       const size_t aStride = theAccessor.ByteStride != 0
                            ? theAccessor.ByteStride
-                           : sizeof(Graphic3d_Vec3);
+                           : anElemSize;
       const Standard_Integer aNbNodes = (Standard_Integer )theAccessor.Count;
       if (!setNbPositionNodes (theDestMesh, aNbNodes))
       {
         return false;
       }
 
-      Standard_ReadBuffer aBuffer (theAccessor.Count * aStride - (aStride - sizeof(Graphic3d_Vec3)), aStride, true);
+      Graphic3d_Vec3 aTmpVec;
+      Standard_ReadBuffer aBuffer (theAccessor.Count * aStride - (aStride - anElemSize), aStride, true);
       if (!myCoordSysConverter.IsEmpty())
       {
         for (Standard_Integer aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
         {
-          const Graphic3d_Vec3* aVec3 = aBuffer.ReadChunk<Graphic3d_Vec3> (theStream);
+          const Graphic3d_Vec3* aVec3 = readVec3 (aBuffer, theStream, theAccessor, aTmpVec);
           if (aVec3 == NULL)
           {
             reportError (TCollection_AsciiString ("Buffer '") + aName + "' reading error.");
@@ -791,7 +877,7 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
       {
         for (Standard_Integer aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
         {
-          const Graphic3d_Vec3* aVec3 = aBuffer.ReadChunk<Graphic3d_Vec3> (theStream);
+          const Graphic3d_Vec3* aVec3 = readVec3 (aBuffer, theStream, theAccessor, aTmpVec);
           if (aVec3 == NULL)
           {
             reportError (TCollection_AsciiString ("Buffer '") + aName + "' reading error.");
@@ -804,7 +890,11 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
     }
     case RWGltf_GltfArrayType_Normal:
     {
-      if (theAccessor.ComponentType != RWGltf_GltfAccessorCompType_Float32
+      // normalized signed integer normals are allowed by KHR_mesh_quantization extension
+      const size_t aCompSize = componentSize (theAccessor.ComponentType);
+      if ((theAccessor.ComponentType != RWGltf_GltfAccessorCompType_Float32
+        && theAccessor.ComponentType != RWGltf_GltfAccessorCompType_Int8
+        && theAccessor.ComponentType != RWGltf_GltfAccessorCompType_Int16)
        || theAccessor.Type != RWGltf_GltfAccessorLayout_Vec3)
       {
         break;
@@ -815,20 +905,23 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
         return false;
       }
 
+      const size_t anElemSize = aCompSize * 3;
       const size_t aStride = theAccessor.ByteStride != 0
                            ? theAccessor.ByteStride
-                           : sizeof(Graphic3d_Vec3);
+                           : anElemSize;
       const Standard_Integer aNbNodes = (Standard_Integer )theAccessor.Count;
       if (!setNbNormalNodes (theDestMesh, aNbNodes))
       {
         return false;
       }
-      Standard_ReadBuffer aBuffer (theAccessor.Count * aStride - (aStride - sizeof(Graphic3d_Vec3)), aStride, true);
+
+      Graphic3d_Vec3 aTmpVec;
+      Standard_ReadBuffer aBuffer (theAccessor.Count * aStride - (aStride - anElemSize), aStride, true);
       if (!myCoordSysConverter.IsEmpty())
       {
         for (Standard_Integer aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
         {
-          Graphic3d_Vec3* aVec3 = aBuffer.ReadChunk<Graphic3d_Vec3> (theStream);
+          Graphic3d_Vec3* aVec3 = readVec3 (aBuffer, theStream, theAccessor, aTmpVec);
           if (aVec3 == NULL)
           {
             reportError (TCollection_AsciiString ("Buffer '") + aName + "' reading error.");
@@ -849,7 +942,7 @@ bool RWGltf_TriangulationReader::readBuffer (const Handle(RWGltf_GltfLatePrimiti
       {
         for (Standard_Integer aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
         {
-          const Graphic3d_Vec3* aVec3 = aBuffer.ReadChunk<Graphic3d_Vec3> (theStream);
+          const Graphic3d_Vec3* aVec3 = readVec3 (aBuffer, theStream, theAccessor, aTmpVec);
           if (aVec3 == NULL)
           {
             reportError (TCollection_AsciiString ("Buffer '") + aName + "' reading error.");
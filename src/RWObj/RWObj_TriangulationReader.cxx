@@ -151,7 +151,14 @@ Handle(Poly_Triangulation) RWObj_TriangulationReader::GetTriangulation()
   const Standard_Boolean hasNormals = myNodes.Length() == myNormals.Length();
   const Standard_Boolean hasUV      = myNodes.Length() == myNodesUV.Length();
 
-  Handle(Poly_Triangulation) aPoly = new Poly_Triangulation (myNodes.Length(), myTriangles.Length(), hasUV);
+  Handle(Poly_Triangulation) aPoly = new Poly_Triangulation();
+  aPoly->SetDoublePrecision (!IsSinglePrecision());
+  aPoly->ResizeNodes (myNodes.Length(), false);
+  aPoly->ResizeTriangles (myTriangles.Length(), false);
+  if (hasUV)
+  {
+    aPoly->AddUVNodes();
+  }
   for (Standard_Integer aNodeIter = 0; aNodeIter < myNodes.Size(); ++aNodeIter)
   {
     const gp_Pnt& aNode = myNodes.Value (aNodeIter);
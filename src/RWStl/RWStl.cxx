@@ -66,6 +66,12 @@ namespace
   class Reader : public RWStl_Reader
   {
   public:
+    //! Constructor
+    Reader() : myIsSinglePrecision (Standard_False) {}
+
+    //! Sets flag for creating triangulation with single precision nodes
+    void SetSinglePrecision (Standard_Boolean theIsSinglePrecision) { myIsSinglePrecision = theIsSinglePrecision; }
+
     //! Add new node
     virtual Standard_Integer AddNode (const gp_XYZ& thePnt) Standard_OVERRIDE
     {
@@ -85,7 +91,10 @@ namespace
       if (myTriangles.IsEmpty())
         return Handle(Poly_Triangulation)();
 
-      Handle(Poly_Triangulation) aPoly = new Poly_Triangulation (myNodes.Length(), myTriangles.Length(), Standard_False);
+      Handle(Poly_Triangulation) aPoly = new Poly_Triangulation();
+      aPoly->SetDoublePrecision (!myIsSinglePrecision);
+      aPoly->ResizeNodes (myNodes.Length(), false);
+      aPoly->ResizeTriangles (myTriangles.Length(), false);
       for (Standard_Integer aNodeIter = 0; aNodeIter < myNodes.Size(); ++aNodeIter)
       {
         aPoly->SetNode (aNodeIter + 1, myNodes[aNodeIter]);
@@ -109,6 +118,7 @@ namespace
   private:
     NCollection_Vector<gp_XYZ> myNodes;
     NCollection_Vector<Poly_Triangle> myTriangles;
+    Standard_Boolean myIsSinglePrecision;
   };
 
   class MultiDomainReader : public Reader
@@ -144,9 +154,22 @@ namespace
 Handle(Poly_Triangulation) RWStl::ReadFile (const Standard_CString theFile,
                                             const Standard_Real theMergeAngle,
                                             const Message_ProgressRange& theProgress)
+{
+  return ReadFile (theFile, theMergeAngle, Standard_False, theProgress);
+}
+
+//=============================================================================
+//function : ReadFile
+//purpose  :
+//=============================================================================
+Handle(Poly_Triangulation) RWStl::ReadFile (const Standard_CString theFile,
+                                            const Standard_Real theMergeAngle,
+                                            const Standard_Boolean theIsSinglePrecision,
+                                            const Message_ProgressRange& theProgress)
 {
   Reader aReader;
   aReader.SetMergeAngle (theMergeAngle);
+  aReader.SetSinglePrecision (theIsSinglePrecision);
   aReader.Read (theFile, theProgress);
   // note that returned bool value is ignored intentionally -- even if something went wrong,
   // but some data have been read, we at least will return these data
@@ -161,9 +184,23 @@ void RWStl::ReadFile(const Standard_CString theFile,
                      const Standard_Real theMergeAngle,
                      NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
                      const Message_ProgressRange& theProgress)
+{
+  ReadFile (theFile, theMergeAngle, Standard_False, theTriangList, theProgress);
+}
+
+//=============================================================================
+//function : ReadFile
+//purpose  :
+//=============================================================================
+void RWStl::ReadFile (const Standard_CString theFile,
+                      const Standard_Real theMergeAngle,
+                      const Standard_Boolean theIsSinglePrecision,
+                      NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
+                      const Message_ProgressRange& theProgress)
 {
   MultiDomainReader aReader;
   aReader.SetMergeAngle (theMergeAngle);
+  aReader.SetSinglePrecision (theIsSinglePrecision);
   aReader.Read (theFile, theProgress);
   theTriangList.Clear();
   theTriangList.Append (aReader.ChangeTriangulationList());
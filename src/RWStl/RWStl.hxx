@@ -62,6 +62,18 @@ public:
   Standard_EXPORT static Handle(Poly_Triangulation) ReadFile (const Standard_CString theFile,
                                                               const Standard_Real theMergeAngle,
                                                               const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Read specified STL file and returns its content as triangulation.
+  //! @param[in] theFile file path to read
+  //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes; M_PI/2 means ignore angle
+  //! @param[in] theIsSinglePrecision flag to store the nodes of triangulation with single precision
+  //!                                 (STL file defines the nodes with single precision, so no data is lost)
+  //! @param[in] theProgress progress indicator
+  //! @return result triangulation or NULL in case of error
+  Standard_EXPORT static Handle(Poly_Triangulation) ReadFile (const Standard_CString theFile,
+                                                              const Standard_Real theMergeAngle,
+                                                              const Standard_Boolean theIsSinglePrecision,
+                                                              const Message_ProgressRange& theProgress = Message_ProgressRange());
   
   //! Read specified STL file and fills triangulation list for multi-domain case.
   //! @param[in] theFile file path to read
@@ -72,6 +84,18 @@ public:
                                        const Standard_Real theMergeAngle,
                                        NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
                                        const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Read specified STL file and fills triangulation list for multi-domain case.
+  //! @param[in] theFile file path to read
+  //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes; M_PI/2 means ignore angle
+  //! @param[in] theIsSinglePrecision flag to store the nodes of triangulations with single precision
+  //! @param[out] theTriangList triangulation list for multi-domain case
+  //! @param[in] theProgress progress indicator
+  Standard_EXPORT static void ReadFile (const Standard_CString theFile,
+                                        const Standard_Real theMergeAngle,
+                                        const Standard_Boolean theIsSinglePrecision,
+                                        NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
+                                        const Message_ProgressRange& theProgress = Message_ProgressRange());
   
   //! Read triangulation from a binary STL file
   //! In case of error, returns Null handle.
@@ -0,0 +1,350 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWStl_CafWriter.hxx>
+
+#include <BRep_Tool.hxx>
+#include <Message.hxx>
+#include <Message_ProgressScope.hxx>
+#include <OSD_OpenFile.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_CLocaleSentry.hxx>
+#include <TDocStd_Document.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#include <XCAFPrs_DocumentExplorer.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(RWStl_CafWriter, Standard_Transient)
+
+namespace
+{
+  static const Standard_Integer THE_STL_SIZEOF_FACET = 50;
+  static const Standard_Integer THE_NB_CHUNK_FACETS  = 4096;
+  static const Standard_Integer IND_THRESHOLD = 1000; // increment the indicator every 1k triangles
+
+  //! Writing a Little Endian 32 bits float
+  inline static void convertFloat (const Standard_Real theValue,
+                                   char* theResult)
+  {
+    union
+    {
+      Standard_ShortReal f;
+      char c[4];
+    } anUnion;
+    anUnion.f = (Standard_ShortReal )theValue;
+
+    theResult[0] = anUnion.c[0];
+    theResult[1] = anUnion.c[1];
+    theResult[2] = anUnion.c[2];
+    theResult[3] = anUnion.c[3];
+  }
+
+  //! Compute normalized facet normal.
+  inline static gp_XYZ facetNormal (const gp_XYZ& theP1, const gp_XYZ& theP2, const gp_XYZ& theP3)
+  {
+    gp_XYZ aNorm = (theP2 - theP1).Crossed (theP3 - theP1);
+    const Standard_Real aMod = aNorm.Modulus();
+    if (aMod * aMod > gp::Resolution())
+    {
+      return aNorm / aMod;
+    }
+    return gp_XYZ (0.0, 0.0, 0.0);
+  }
+}
+
+//================================================================
+// Function : Constructor
+// Purpose  :
+//================================================================
+RWStl_CafWriter::RWStl_CafWriter (const TCollection_AsciiString& theFile)
+: myFile (theFile),
+  myChunk (0, THE_NB_CHUNK_FACETS * THE_STL_SIZEOF_FACET - 1),
+  myChunkFilled (0),
+  myNbWritten (0),
+  myNbFacesNoTri (0),
+  myIsASCIIMode (false)
+{
+  //
+}
+
+//================================================================
+// Function : Destructor
+// Purpose  :
+//================================================================
+RWStl_CafWriter::~RWStl_CafWriter()
+{
+  //
+}
+
+// =======================================================================
+// function : Perform
+// purpose  :
+// =======================================================================
+bool RWStl_CafWriter::Perform (const Handle(TDocStd_Document)& theDocument,
+                               const Message_ProgressRange& theProgress)
+{
+  TDF_LabelSequence aRoots;
+  Handle(XCAFDoc_ShapeTool) aShapeTool = XCAFDoc_DocumentTool::ShapeTool (theDocument->Main());
+  aShapeTool->GetFreeShapes (aRoots);
+  return Perform (theDocument, aRoots, NULL, theProgress);
+}
+
+// =======================================================================
+// function : Perform
+// purpose  :
+// =======================================================================
+bool RWStl_CafWriter::Perform (const Handle(TDocStd_Document)& theDocument,
+                               const TDF_LabelSequence& theRootLabels,
+                               const TColStd_MapOfAsciiString* theLabelFilter,
+                               const Message_ProgressRange& theProgress)
+{
+  myNbFacesNoTri = 0;
+  myNbWritten    = 0;
+  myChunkFilled  = 0;
+  if (theRootLabels.IsEmpty()
+  || (theLabelFilter != NULL && theLabelFilter->IsEmpty()))
+  {
+    Message::SendFail ("Nothing to export into STL file");
+    return false;
+  }
+
+  // first pass - count triangles of all instances;
+  // triangulations are shared between instances, so that this pass doesn't expand any data
+  Standard_Size aNbTrisAll = 0;
+  for (XCAFPrs_DocumentExplorer aDocExplorer (theDocument, theRootLabels, XCAFPrs_DocumentExplorerFlags_OnlyLeafNodes);
+       aDocExplorer.More(); aDocExplorer.Next())
+  {
+    const XCAFPrs_DocumentNode& aDocNode = aDocExplorer.Current();
+    if (theLabelFilter != NULL
+    && !theLabelFilter->Contains (aDocNode.Id))
+    {
+      continue;
+    }
+
+    const TopoDS_Shape aShape = XCAFDoc_ShapeTool::GetShape (aDocNode.RefLabel);
+    for (TopExp_Explorer aFaceIter (aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+    {
+      TopLoc_Location aLoc;
+      const Handle(Poly_Triangulation)& aTris = BRep_Tool::Triangulation (TopoDS::Face (aFaceIter.Current()), aLoc);
+      if (aTris.IsNull())
+      {
+        ++myNbFacesNoTri;
+        continue;
+      }
+      aNbTrisAll += (Standard_Size )aTris->NbTriangles();
+    }
+  }
+  if (aNbTrisAll == 0)
+  {
+    Message::SendFail ("No mesh data to save");
+    return false;
+  }
+  if (!myIsASCIIMode
+    && aNbTrisAll > (Standard_Size )UINT32_MAX)
+  {
+    Message::SendFail ("Number of triangles exceeds limit of binary STL format");
+    return false;
+  }
+
+  Standard_CLocaleSentry aLocaleSentry;
+  FILE* aFile = OSD_OpenFile (myFile, myIsASCIIMode ? "w" : "wb");
+  if (aFile == NULL)
+  {
+    Message::SendFail (TCollection_AsciiString ("Unable to create STL file\n") + myFile);
+    return false;
+  }
+
+  bool isDone = true;
+  if (myIsASCIIMode)
+  {
+    // note that space after 'solid' is necessary for many systems
+    isDone = fwrite ("solid \n", 1, 7, aFile) == 7;
+  }
+  else
+  {
+    char aHeader[80] = "STL Exported by Open CASCADE Technology [dev.opencascade.org]";
+    char aNbTrisBytes[4];
+    const uint32_t aNbTris32 = (uint32_t )aNbTrisAll;
+    aNbTrisBytes[0] = char(aNbTris32 & 0xFF);
+    aNbTrisBytes[1] = char((aNbTris32 >> 8)  & 0xFF);
+    aNbTrisBytes[2] = char((aNbTris32 >> 16) & 0xFF);
+    aNbTrisBytes[3] = char((aNbTris32 >> 24) & 0xFF);
+    isDone = fwrite (aHeader, 1, 80, aFile) == 80
+          && fwrite (aNbTrisBytes, 1, 4, aFile) == 4;
+  }
+
+  // second pass - write triangles of each face instance
+  Message_ProgressScope aPS (theProgress, "STL export", (Standard_Real )aNbTrisAll);
+  for (XCAFPrs_DocumentExplorer aDocExplorer (theDocument, theRootLabels, XCAFPrs_DocumentExplorerFlags_OnlyLeafNodes);
+       aDocExplorer.More() && isDone; aDocExplorer.Next())
+  {
+    const XCAFPrs_DocumentNode& aDocNode = aDocExplorer.Current();
+    if (theLabelFilter != NULL
+    && !theLabelFilter->Contains (aDocNode.Id))
+    {
+      continue;
+    }
+
+    // document node location already includes location of referred shape
+    TopoDS_Shape aShape = XCAFDoc_ShapeTool::GetShape (aDocNode.RefLabel);
+    aShape.Location (aDocNode.Location, false);
+    for (TopExp_Explorer aFaceIter (aShape, TopAbs_FACE); aFaceIter.More() && isDone; aFaceIter.Next())
+    {
+      isDone = writeFace (aFile, TopoDS::Face (aFaceIter.Current()), aPS);
+    }
+  }
+
+  if (isDone)
+  {
+    isDone = myIsASCIIMode
+           ? fwrite ("endsolid\n", 1, 9, aFile) == 9
+           : flushBinary (aFile);
+  }
+  const bool isClosed = ::fclose (aFile) == 0;
+  if (!isDone || !isClosed)
+  {
+    if (!aPS.UserBreak())
+    {
+      Message::SendFail (TCollection_AsciiString ("Failed to write STL file\n") + myFile);
+    }
+    return false;
+  }
+
+  if (myNbFacesNoTri > 0)
+  {
+    Message::SendWarning (TCollection_AsciiString ("Warning: ") + myNbFacesNoTri
+                        + ((myNbFacesNoTri == 1) ? " face has" : " faces have")
+                        + " been skipped due to null triangulation");
+  }
+  return true;
+}
+
+// =======================================================================
+// function : writeFace
+// purpose  :
+// =======================================================================
+bool RWStl_CafWriter::writeFace (FILE* theFile,
+                                 const TopoDS_Face& theFace,
+                                 Message_ProgressScope& thePSentry)
+{
+  TopLoc_Location aFaceLoc;
+  const Handle(Poly_Triangulation)& aTris = BRep_Tool::Triangulation (theFace, aFaceLoc);
+  if (aTris.IsNull()
+   || aTris->NbTriangles() < 1)
+  {
+    return true;
+  }
+
+  // transform nodes of this face instance into the reusable buffer
+  const gp_Trsf aTrsf = aFaceLoc.Transformation();
+  const Standard_Integer aNbNodes = aTris->NbNodes();
+  if (myNodes.Size() < aNbNodes)
+  {
+    myNodes.Resize (1, aNbNodes, false);
+  }
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+  {
+    gp_XYZ aPnt = aTris->Node (aNodeIter).XYZ();
+    aTrsf.Transforms (aPnt);
+    myNodes.ChangeValue (aNodeIter) = aPnt;
+  }
+
+  // mirroring transformation flips triangles orientation as well as reversed face
+  const bool isMirrored = aTrsf.VectorialPart().Determinant() < 0.0;
+  const bool toFlip = (theFace.Orientation() == TopAbs_REVERSED) != isMirrored;
+
+  char aBuffer[512];
+  Standard_Integer anElem[3] = { 0, 0, 0 };
+  for (Standard_Integer aTriIter = 1; aTriIter <= aTris->NbTriangles(); ++aTriIter)
+  {
+    aTris->Triangle (aTriIter).Get (anElem[0], anElem[1], anElem[2]);
+    if (toFlip)
+    {
+      std::swap (anElem[1], anElem[2]);
+    }
+
+    const gp_XYZ& aP1 = myNodes.Value (anElem[0]);
+    const gp_XYZ& aP2 = myNodes.Value (anElem[1]);
+    const gp_XYZ& aP3 = myNodes.Value (anElem[2]);
+    const gp_XYZ aNorm = facetNormal (aP1, aP2, aP3);
+    if (myIsASCIIMode)
+    {
+      Sprintf (aBuffer,
+               " facet normal % 12e % 12e % 12e\n"
+               "   outer loop\n"
+               "     vertex % 12e % 12e % 12e\n"
+               "     vertex % 12e % 12e % 12e\n"
+               "     vertex % 12e % 12e % 12e\n"
+               "   endloop\n"
+               " endfacet\n",
+               aNorm.X(), aNorm.Y(), aNorm.Z(),
+               aP1.X(), aP1.Y(), aP1.Z(),
+               aP2.X(), aP2.Y(), aP2.Z(),
+               aP3.X(), aP3.Y(), aP3.Z());
+      if (fprintf (theFile, "%s", aBuffer) < 0)
+      {
+        return false;
+      }
+    }
+    else
+    {
+      if (myChunkFilled + THE_STL_SIZEOF_FACET > (Standard_Size )myChunk.Size()
+      && !flushBinary (theFile))
+      {
+        return false;
+      }
+
+      char* aData = &myChunk.ChangeValue ((Standard_Integer )myChunkFilled);
+      const gp_XYZ* aVecs[4] = { &aNorm, &aP1, &aP2, &aP3 };
+      for (Standard_Integer aVecIter = 0; aVecIter < 4; ++aVecIter)
+      {
+        convertFloat (aVecs[aVecIter]->X(), aData); aData += 4;
+        convertFloat (aVecs[aVecIter]->Y(), aData); aData += 4;
+        convertFloat (aVecs[aVecIter]->Z(), aData); aData += 4;
+      }
+      aData[0] = 0;
+      aData[1] = 0;
+      myChunkFilled += THE_STL_SIZEOF_FACET;
+    }
+
+    // update progress only per 1k triangles
+    if ((++myNbWritten % IND_THRESHOLD) == 0)
+    {
+      if (!thePSentry.More())
+      {
+        return false;
+      }
+      thePSentry.Next (IND_THRESHOLD);
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : flushBinary
+// purpose  :
+// =======================================================================
+bool RWStl_CafWriter::flushBinary (FILE* theFile)
+{
+  if (myChunkFilled == 0)
+  {
+    return true;
+  }
+
+  const bool isDone = fwrite (&myChunk.First(), 1, myChunkFilled, theFile) == myChunkFilled;
+  myChunkFilled = 0;
+  return isDone;
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWStl_CafWriter_HeaderFile
+#define _RWStl_CafWriter_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <TColStd_MapOfAsciiString.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <gp_XYZ.hxx>
+
+class Message_ProgressScope;
+class Message_ProgressRange;
+class TDocStd_Document;
+class TopoDS_Face;
+
+//! STL writer from XCAF document.
+//!
+//! Unlike StlAPI_Writer, this tool doesn't merge triangulations into a single mesh before writing:
+//! document tree is traversed twice (to count triangles and to write them),
+//! and triangulation of each face instance is transformed on the fly and written in blocks of facets.
+//! Memory consumption is therefore bounded by the largest face triangulation,
+//! not by the size of the assembly with expanded instances.
+//! Triangulation data should be precomputed within shapes!
+class RWStl_CafWriter : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(RWStl_CafWriter, Standard_Transient)
+public:
+
+  //! Main constructor.
+  //! @param[in] theFile path to output STL file
+  Standard_EXPORT RWStl_CafWriter (const TCollection_AsciiString& theFile);
+
+  //! Destructor.
+  Standard_EXPORT virtual ~RWStl_CafWriter();
+
+  //! Return TRUE if ASCII STL should be written; FALSE by default (binary STL).
+  bool IsASCIIMode() const { return myIsASCIIMode; }
+
+  //! Set if ASCII STL should be written instead of binary.
+  void SetASCIIMode (bool theIsAscii) { myIsASCIIMode = theIsAscii; }
+
+  //! Return number of faces skipped due to missing triangulation during last export.
+  Standard_Integer NbFacesNoTriangulation() const { return myNbFacesNoTri; }
+
+  //! Write STL file.
+  //! @param[in] theDocument    input document
+  //! @param[in] theRootLabels  list of root shapes to export
+  //! @param[in] theLabelFilter optional filter with document nodes to export,
+  //!                           with keys defined by XCAFPrs_DocumentExplorer::DefineChildId() and filled recursively
+  //!                           (leaves and parent assembly nodes at all levels);
+  //!                           when not NULL, all nodes not included into the map will be ignored
+  //! @param[in] theProgress    optional progress indicator
+  //! @return FALSE on file writing failure or if there is nothing to write
+  Standard_EXPORT virtual bool Perform (const Handle(TDocStd_Document)& theDocument,
+                                        const TDF_LabelSequence& theRootLabels,
+                                        const TColStd_MapOfAsciiString* theLabelFilter,
+                                        const Message_ProgressRange& theProgress);
+
+  //! Write STL file with all free shapes of the document.
+  //! @param[in] theDocument input document
+  //! @param[in] theProgress optional progress indicator
+  //! @return FALSE on file writing failure or if there is nothing to write
+  Standard_EXPORT virtual bool Perform (const Handle(TDocStd_Document)& theDocument,
+                                        const Message_ProgressRange& theProgress);
+
+protected:
+
+  //! Write triangles of the face instance.
+  //! @param[in] theFile     output file
+  //! @param[in] theFace     face to write (with location of the document node)
+  //! @param[in,out] thePSentry progress scope with per-triangle steps
+  //! @return FALSE on writing file error or user break
+  Standard_EXPORT virtual bool writeFace (FILE* theFile,
+                                          const TopoDS_Face& theFace,
+                                          Message_ProgressScope& thePSentry);
+
+  //! Write block of buffered binary facets into the file.
+  Standard_EXPORT bool flushBinary (FILE* theFile);
+
+protected:
+
+  TCollection_AsciiString          myFile;          //!< output STL file
+  NCollection_Array1<gp_XYZ>       myNodes;         //!< transformed nodes of currently written face (grows up to the largest face)
+  NCollection_Array1<char>         myChunk;         //!< buffer for a block of binary facets
+  Standard_Size                    myChunkFilled;   //!< number of filled bytes within the buffer
+  Standard_Integer                 myNbWritten;     //!< number of written triangles (for progress indication)
+  Standard_Integer                 myNbFacesNoTri;  //!< number of faces without triangulation
+  bool                             myIsASCIIMode;   //!< flag to write ASCII STL
+
+};
+
+#endif // _RWStl_CafWriter_HeaderFile
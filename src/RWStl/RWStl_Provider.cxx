@@ -17,6 +17,7 @@
 #include <BRep_Builder.hxx>
 #include <Message.hxx>
 #include <RWStl.hxx>
+#include <RWStl_CafWriter.hxx>
 #include <RWStl_ConfigurationNode.hxx>
 #include <StlAPI.hxx>
 #include <StlAPI_Writer.hxx>
@@ -99,7 +100,6 @@ bool RWStl_Provider::Write(const TCollection_AsciiString& thePath,
                            const Handle(TDocStd_Document)& theDocument,
                            const Message_ProgressRange& theProgress)
 {
-  TopoDS_Shape aShape;
   TDF_LabelSequence aLabels;
   Handle(XCAFDoc_ShapeTool) aSTool = XCAFDoc_DocumentTool::ShapeTool(theDocument->Main());
   aSTool->GetFreeShapes(aLabels);
@@ -110,23 +110,25 @@ bool RWStl_Provider::Write(const TCollection_AsciiString& thePath,
     return false;
   }
 
-  if (aLabels.Length() == 1)
+  Message::SendWarning() << "OCCT Stl writer does not support model scaling according to custom length unit";
+  if (GetNode().IsNull() || !GetNode()->IsKind(STANDARD_TYPE(RWStl_ConfigurationNode)))
   {
-    aShape = aSTool->GetShape(aLabels.Value(1));
+    Message::SendFail() << "Error in the RWStl_Provider during writing the file " <<
+      thePath << "\t: Incorrect or empty Configuration Node";
+    return false;
   }
-  else
+  Handle(RWStl_ConfigurationNode) aNode = Handle(RWStl_ConfigurationNode)::DownCast(GetNode());
+
+  // write face triangulations of document instances on the fly instead of merging them into a single mesh
+  RWStl_CafWriter aWriter(thePath);
+  aWriter.SetASCIIMode(aNode->InternalParameters.WriteAscii);
+  if (!aWriter.Perform(theDocument, aLabels, NULL, theProgress))
   {
-    TopoDS_Compound aComp;
-    BRep_Builder aBuilder;
-    aBuilder.MakeCompound(aComp);
-    for (Standard_Integer anIndex = 1; anIndex <= aLabels.Length(); anIndex++)
-    {
-      TopoDS_Shape aS = aSTool->GetShape(aLabels.Value(anIndex));
-      aBuilder.Add(aComp, aS);
-    }
-    aShape = aComp;
+    Message::SendFail() << "Error in the RWStl_Provider during writing the file " <<
+      thePath << "\t: Mesh writing has been failed";
+    return false;
   }
-  return Write(thePath, aShape, theProgress);
+  return true;
 }
 
 //=======================================================================
@@ -313,11 +313,12 @@ static Standard_Integer WriteGltf(Draw_Interpretor& theDI,
   RWGltf_WriterTrsfFormat aTrsfFormat = RWGltf_WriterTrsfFormat_Compact;
   RWMesh_CoordinateSystem aSystemCoordSys = RWMesh_CoordinateSystem_Zup;
   bool toForceUVExport = false, toEmbedTexturesInGlb = true;
-  bool toMergeFaces = false, toSplitIndices16 = false;
-  bool isParallel = false;
+  bool toMergeFaces = false, toSplitIndices16 = false, toMergeMeshes = false, toOptimizeVertexCache = false;
+  bool isParallel = false, toWritePipelined = false;
   RWMesh_NameFormat aNodeNameFormat = RWMesh_NameFormat_InstanceOrProduct;
   RWMesh_NameFormat aMeshNameFormat = RWMesh_NameFormat_Product;
   RWGltf_DracoParameters aDracoParameters;
+  RWGltf_QuantizationParameters aQuantParameters;
   for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
   {
     TCollection_AsciiString anArgCase(theArgVec[anArgIter]);
@@ -351,6 +352,18 @@ static Standard_Integer WriteGltf(Draw_Interpretor& theDI,
         ++anArgIter;
       }
     }
+    else if (anArgCase == "-mergemeshes")
+    {
+      toMergeMeshes = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-optimizevertexcache")
+    {
+      toOptimizeVertexCache = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-pipelined")
+    {
+      toWritePipelined = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
     else if (anArgCase == "-splitindices16"
       || anArgCase == "-splitindexes16"
       || anArgCase == "-splitindices"
@@ -488,6 +501,20 @@ static Standard_Integer WriteGltf(Draw_Interpretor& theDI,
     {
       aDracoParameters.UnifiedQuantization = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
     }
+    else if (anArgCase == "-meshquantization")
+    {
+      aQuantParameters.MeshQuantization = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-meshquantizationpositionbits" && (anArgIter + 1) < theNbArgs
+      && Draw::ParseInteger(theArgVec[anArgIter + 1], aQuantParameters.QuantizePositionBits))
+    {
+      ++anArgIter;
+    }
+    else if (anArgCase == "-meshquantizationnormalbits" && (anArgIter + 1) < theNbArgs
+      && Draw::ParseInteger(theArgVec[anArgIter + 1], aQuantParameters.QuantizeNormalBits))
+    {
+      ++anArgIter;
+    }
     else if (anArgCase == "-parallel")
     {
       isParallel = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
@@ -519,7 +546,11 @@ static Standard_Integer WriteGltf(Draw_Interpretor& theDI,
   aWriter.SetToEmbedTexturesInGlb(toEmbedTexturesInGlb);
   aWriter.SetMergeFaces(toMergeFaces);
   aWriter.SetSplitIndices16(toSplitIndices16);
+  aWriter.SetMergeIdenticalMeshes(toMergeMeshes);
+  aWriter.SetOptimizeVertexCache(toOptimizeVertexCache);
+  aWriter.SetQuantizationParameters(aQuantParameters);
   aWriter.SetParallel(isParallel);
+  aWriter.SetPipelinedWriting(toWritePipelined);
   aWriter.SetCompressionParameters(aDracoParameters);
   aWriter.ChangeCoordinateSystemConverter().SetInputLengthUnit(aScaleFactorM);
   aWriter.ChangeCoordinateSystemConverter().SetInputCoordinateSystem(aSystemCoordSys);
@@ -565,16 +596,21 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
             "\n\t\t:            [-systemCoordSys {Zup|Yup}]=Zup"
             "\n\t\t:            [-comments Text] [-author Name]"
             "\n\t\t:            [-forceUVExport]=0 [-texturesSeparate]=0 [-mergeFaces]=0 [-splitIndices16]=0"
+            "\n\t\t:            [-mergeMeshes]=0 [-optimizeVertexCache]=0 [-pipelined]=0"
             "\n\t\t:            [-nodeNameFormat {empty|product|instance|instOrProd|prodOrInst|prodAndInst|verbose}]=instOrProd"
             "\n\t\t:            [-meshNameFormat {empty|product|instance|instOrProd|prodOrInst|prodAndInst|verbose}]=product"
             "\n\t\t:            [-draco]=0 [-compressionLevel {0-10}]=7 [-quantizePositionBits Value]=14 [-quantizeNormalBits Value]=10"
             "\n\t\t:            [-quantizeTexcoordBits Value]=12 [-quantizeColorBits Value]=8 [-quantizeGenericBits Value]=12"
             "\n\t\t:            [-unifiedQuantization]=0 [-parallel]=0"
+            "\n\t\t:            [-meshQuantization]=0 [-meshQuantizationPositionBits Value]=16 [-meshQuantizationNormalBits {8|16}]=8"
             "\n\t\t: Write XDE document into glTF file."
             "\n\t\t:   -trsfFormat       preferred transformation format"
             "\n\t\t:   -systemCoordSys   system coordinate system; Zup when not specified"
             "\n\t\t:   -mergeFaces       merge Faces within the same Mesh"
             "\n\t\t:   -splitIndices16   split Faces to keep 16-bit indices when -mergeFaces is enabled"
+            "\n\t\t:   -mergeMeshes      share binary data between primitive arrays with identical content"
+            "\n\t\t:   -optimizeVertexCache reorder triangles and nodes for better GPU vertex cache and vertex fetch efficiency"
+            "\n\t\t:   -pipelined        encode binary data into memory (in parallel with -parallel) and write it at precomputed offsets"
             "\n\t\t:   -forceUVExport    always export UV coordinates"
             "\n\t\t:   -texturesSeparate write textures to separate files"
             "\n\t\t:   -nodeNameFormat   name format for Nodes"
@@ -588,7 +624,12 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
             "\n\t\t:   -quantizeGenericBits  quantization bits for skinning attribute (joint indices and joint weights)"
             "\n                        and custom attributes when using Draco compression (by default 12)"
             "\n\t\t:   -unifiedQuantization  quantization is applied on each primitive separately if this option is false"
-            "\n\t\t:   -parallel             use multithreading for Draco compression",
+            "\n\t\t:   -parallel             use multithreading for Draco compression"
+            "\n\t\t:                         or for encoding of binary data in pipelined mode"
+            "\n\t\t:   -meshQuantization     store positions and normals as integers (KHR_mesh_quantization extension);"
+            "\n\t\t:                         cannot be combined with Draco compression"
+            "\n\t\t:   -meshQuantizationPositionBits quantization bits for positions within [1, 16] range (by default 16)"
+            "\n\t\t:   -meshQuantizationNormalBits   quantization bits for normals, 8 or 16 (by default 8)",
             __FILE__, WriteGltf, aGroup);
   theDI.Add("writegltf",
             "writegltf shape file",
@@ -33,12 +33,15 @@
 #include <MeshVS_TextPrsBuilder.hxx>
 #include <MeshVS_VectorPrsBuilder.hxx>
 #include <RWStl.hxx>
+#include <RWStl_CafWriter.hxx>
 #include <StlAPI.hxx>
 #include <StlAPI_Writer.hxx>
 #include <TColStd_HPackedMapOfInteger.hxx>
 #include <TDataStd_Name.hxx>
 #include <TDocStd_Application.hxx>
 #include <TopoDS_Shape.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
 #include <V3d_View.hxx>
 #include <ViewerTest.hxx>
 #include <XSControl_WorkSession.hxx>
@@ -77,6 +80,75 @@ static Standard_Integer writestl
   return 0;
 }
 
+//=============================================================================
+//function : WriteStl
+//purpose  : Writes XDE document into STL file
+//=============================================================================
+static Standard_Integer WriteStl (Draw_Interpretor& theDI,
+                                  Standard_Integer theNbArgs,
+                                  const char** theArgVec)
+{
+  TCollection_AsciiString aStlFilePath;
+  Handle(TDocStd_Document) aDoc;
+  bool isAsciiMode = false;
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase (theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-ascii")
+    {
+      isAsciiMode = Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-binary")
+    {
+      isAsciiMode = !Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aDoc.IsNull())
+    {
+      Standard_CString aNameVar = theArgVec[anArgIter];
+      DDocStd::GetDocument (aNameVar, aDoc, false);
+      if (aDoc.IsNull())
+      {
+        TopoDS_Shape aShape = DBRep::Get (aNameVar);
+        if (aShape.IsNull())
+        {
+          theDI << "Syntax error: '" << aNameVar << "' is not a shape nor document";
+          return 1;
+        }
+
+        Handle(TDocStd_Application) anApp = DDocStd::GetApplication();
+        anApp->NewDocument (TCollection_ExtendedString ("BinXCAF"), aDoc);
+        Handle(XCAFDoc_ShapeTool) aShapeTool = XCAFDoc_DocumentTool::ShapeTool (aDoc->Main());
+        aShapeTool->AddShape (aShape);
+      }
+    }
+    else if (aStlFilePath.IsEmpty())
+    {
+      aStlFilePath = theArgVec[anArgIter];
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aStlFilePath.IsEmpty())
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator (theDI, 1);
+  RWStl_CafWriter aWriter (aStlFilePath);
+  aWriter.SetASCIIMode (isAsciiMode);
+  if (!aWriter.Perform (aDoc, aProgress->Start()))
+  {
+    theDI << "Error: Mesh writing has been failed.\n";
+    return 1;
+  }
+  return 0;
+}
+
 //=============================================================================
 //function : readstl
 //purpose  : Reads stl file
@@ -88,6 +160,7 @@ static Standard_Integer readstl(Draw_Interpretor& theDI,
   TCollection_AsciiString aShapeName, aFilePath;
   bool toCreateCompOfTris = false;
   bool anIsMulti = false;
+  bool isSinglePrecision = false;
   double aMergeAngle = M_PI / 2.0;
   for (Standard_Integer anArgIter = 1; anArgIter < theArgc; ++anArgIter)
   {
@@ -119,6 +192,16 @@ static Standard_Integer readstl(Draw_Interpretor& theDI,
         ++anArgIter;
       }
     }
+    else if (anArg == "-singleprecision"
+          || anArg == "-singleprec")
+    {
+      isSinglePrecision = true;
+      if (anArgIter + 1 < theArgc
+       && Draw::ParseOnOff (theArgv[anArgIter + 1], isSinglePrecision))
+      {
+        ++anArgIter;
+      }
+    }
     else if (anArg == "-mergeangle"
           || anArg == "-smoothangle"
           || anArg == "-nomergeangle"
@@ -165,7 +248,7 @@ static Standard_Integer readstl(Draw_Interpretor& theDI,
     {
       NCollection_Sequence<Handle(Poly_Triangulation)> aTriangList;
       // Read STL file to the triangulation list.
-      RWStl::ReadFile(aFilePath.ToCString(),aMergeAngle,aTriangList,aProgress->Start());
+      RWStl::ReadFile(aFilePath.ToCString(),aMergeAngle,isSinglePrecision,aTriangList,aProgress->Start());
       BRep_Builder aB;
       TopoDS_Face aFace;
       if (aTriangList.Size() == 1)
@@ -192,7 +275,7 @@ static Standard_Integer readstl(Draw_Interpretor& theDI,
     else
     {
       // Read STL file to the triangulation.
-      Handle(Poly_Triangulation) aTriangulation = RWStl::ReadFile (aFilePath.ToCString(),aMergeAngle,aProgress->Start());
+      Handle(Poly_Triangulation) aTriangulation = RWStl::ReadFile (aFilePath.ToCString(),aMergeAngle,isSinglePrecision,aProgress->Start());
 
       TopoDS_Face aFace;
       BRep_Builder aB;
@@ -1286,13 +1369,23 @@ void XSDRAWSTL::Factory(Draw_Interpretor& theDI)
   const char* aGroup = "XSTEP-STL/VRML";  // Step transfer file commands
 
   theDI.Add("writestl", "shape file [ascii/binary (0/1) : 1 by default] [InParallel (0/1) : 0 by default]", __FILE__, writestl, aGroup);
+  theDI.Add("WriteStl",
+            "WriteStl Doc file [-ascii {on|off}]=off [-binary {on|off}]=on"
+            "\n\t\t: Write XDE document (or shape) into STL file."
+            "\n\t\t: Triangulation of each face instance is written on the fly without merging"
+            "\n\t\t: of the whole model into a single mesh, so that memory is bounded by the largest face."
+            "\n\t\t:   -ascii  write ASCII STL instead of binary one"
+            "\n\t\t:   -binary write binary STL (default); '-binary off' is the same as '-ascii'",
+            __FILE__, WriteStl, aGroup);
   theDI.Add("readstl",
-            "readstl shape file [-brep] [-mergeAngle Angle] [-multi]"
+            "readstl shape file [-brep] [-mergeAngle Angle] [-multi] [-singlePrecision]"
             "\n\t\t: Reads STL file and creates a new shape with specified name."
             "\n\t\t: When -brep is specified, creates a Compound of per-triangle Faces."
             "\n\t\t: Single triangulation-only Face is created otherwise (default)."
             "\n\t\t: -mergeAngle specifies maximum angle in degrees between triangles to merge equal nodes; disabled by default."
-            "\n\t\t: -multi creates a face per solid in multi-domain files; ignored when -brep is set.",
+            "\n\t\t: -multi creates a face per solid in multi-domain files; ignored when -brep is set;"
+            "\n\t\t: -singlePrecision stores the nodes of triangulation with single precision, without loss of data"
+            "\n\t\t:   as STL format defines the nodes with single precision; ignored when -brep is set.",
             __FILE__, readstl, aGroup);
 
   theDI.Add("meshfromstl", "creates MeshVS_Mesh from STL file", __FILE__, createmesh, aGroup);
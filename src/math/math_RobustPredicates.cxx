@@ -0,0 +1,233 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <math_RobustPredicates.hxx>
+
+#include <cmath>
+
+namespace
+{
+  //! Maximal length of the scaled expansion of at most 32 components.
+  static const int THE_MAX_SCALE_LENGTH = 64;
+
+  //! Sum of two values as a + b = x + y, requires |a| >= |b|.
+  inline void fastTwoSum (const double theA, const double theB, double& theX, double& theY)
+  {
+    theX = theA + theB;
+    theY = theB - (theX - theA);
+  }
+
+  //! Sum of two values as a + b = x + y.
+  inline void twoSum (const double theA, const double theB, double& theX, double& theY)
+  {
+    theX = theA + theB;
+    const double aBVirt = theX - theA;
+    const double anAVirt = theX - aBVirt;
+    theY = (theA - anAVirt) + (theB - aBVirt);
+  }
+
+  //! Product of two values as a * b = x + y.
+  inline void twoProduct (const double theA, const double theB, double& theX, double& theY)
+  {
+    theX = theA * theB;
+    theY = std::fma (theA, theB, -theX);
+  }
+
+  //! Computes the exact difference a - b, returns the length of the expansion.
+  inline int diff (const double theA, const double theB, double* theH)
+  {
+    const double aX = theA - theB;
+    const double aBVirt = theA - aX;
+    const double anAVirt = aX + aBVirt;
+    const double aY = (theA - anAVirt) + (aBVirt - theB);
+    int aLen = 0;
+    if (aY != 0.0)
+    {
+      theH[aLen++] = aY;
+    }
+    theH[aLen++] = aX;
+    return aLen;
+  }
+
+  //! Adds the value to the expansion in place, returns the new length of the expansion.
+  static int grow (const int theLen, double* theE, const double theB)
+  {
+    double aQ = theB;
+    int aLen = 0;
+    for (int anIter = 0; anIter < theLen; ++anIter)
+    {
+      double aQNew, anH;
+      twoSum (aQ, theE[anIter], aQNew, anH);
+      aQ = aQNew;
+      if (anH != 0.0)
+      {
+        theE[aLen++] = anH;
+      }
+    }
+    if (aQ != 0.0 || aLen == 0)
+    {
+      theE[aLen++] = aQ;
+    }
+    return aLen;
+  }
+
+  //! Adds the expansion F to the expansion H in place, returns the new length of H.
+  static int add (int theHLen, double* theH, const int theFLen, const double* theF, const bool theToNegate = false)
+  {
+    for (int anIter = 0; anIter < theFLen; ++anIter)
+    {
+      theHLen = grow (theHLen, theH, theToNegate ? -theF[anIter] : theF[anIter]);
+    }
+    return theHLen;
+  }
+
+  //! Multiplies the expansion by the value, returns the length of the result.
+  static int scale (const int theLen, const double* theE, const double theB, double* theH)
+  {
+    int aLen = 0;
+    double aQ, anH;
+    twoProduct (theE[0], theB, aQ, anH);
+    if (anH != 0.0)
+    {
+      theH[aLen++] = anH;
+    }
+    for (int anIter = 1; anIter < theLen; ++anIter)
+    {
+      double aProd1, aProd0, aSum;
+      twoProduct (theE[anIter], theB, aProd1, aProd0);
+      twoSum (aQ, aProd0, aSum, anH);
+      if (anH != 0.0)
+      {
+        theH[aLen++] = anH;
+      }
+      fastTwoSum (aProd1, aSum, aQ, anH);
+      if (anH != 0.0)
+      {
+        theH[aLen++] = anH;
+      }
+    }
+    if (aQ != 0.0 || aLen == 0)
+    {
+      theH[aLen++] = aQ;
+    }
+    return aLen;
+  }
+
+  //! Multiplies two expansions, returns the length of the result.
+  //! The expansion E should have at most THE_MAX_SCALE_LENGTH / 2 components.
+  static int product (const int theELen, const double* theE,
+                      const int theFLen, const double* theF,
+                      double* theH)
+  {
+    double aTmp[THE_MAX_SCALE_LENGTH];
+    int aLen = 0;
+    for (int anIter = 0; anIter < theFLen; ++anIter)
+    {
+      const int aTmpLen = scale (theELen, theE, theF[anIter], aTmp);
+      aLen = add (aLen, theH, aTmpLen, aTmp);
+    }
+    return aLen;
+  }
+
+  //! Computes the minor a * b - c * d of expansions of two components,
+  //! returns the length of the result (at most 16).
+  static int minor2 (const double* theA, const int theALen, const double* theB, const int theBLen,
+                     const double* theC, const int theCLen, const double* theD, const int theDLen,
+                     double* theH)
+  {
+    double aCD[8];
+    const int aCDLen = product (theCLen, theC, theDLen, theD, aCD);
+    const int aLen = product (theALen, theA, theBLen, theB, theH);
+    return add (aLen, theH, aCDLen, aCD, true);
+  }
+}
+
+//=======================================================================
+//function : Orient2dExact
+//purpose  :
+//=======================================================================
+Standard_Real math_RobustPredicates::Orient2dExact (const gp_XY& theA, const gp_XY& theB, const gp_XY& theC)
+{
+  double aACX[2], aACY[2], aBCX[2], aBCY[2], aDet[16];
+  const int aACXLen = diff (theA.X(), theC.X(), aACX), aACYLen = diff (theA.Y(), theC.Y(), aACY);
+  const int aBCXLen = diff (theB.X(), theC.X(), aBCX), aBCYLen = diff (theB.Y(), theC.Y(), aBCY);
+  const int aLen = minor2 (aACX, aACXLen, aBCY, aBCYLen, aACY, aACYLen, aBCX, aBCXLen, aDet);
+  return aDet[aLen - 1];
+}
+
+//=======================================================================
+//function : Orient3dExact
+//purpose  :
+//=======================================================================
+Standard_Real math_RobustPredicates::Orient3dExact (const gp_XYZ& theA, const gp_XYZ& theB,
+                                                    const gp_XYZ& theC, const gp_XYZ& theD)
+{
+  double aAD[3][2], aBD[3][2], aCD[3][2];
+  int aADLen[3], aBDLen[3], aCDLen[3];
+  for (int aCoord = 0; aCoord < 3; ++aCoord)
+  {
+    aADLen[aCoord] = diff (theA.Coord (aCoord + 1), theD.Coord (aCoord + 1), aAD[aCoord]);
+    aBDLen[aCoord] = diff (theB.Coord (aCoord + 1), theD.Coord (aCoord + 1), aBD[aCoord]);
+    aCDLen[aCoord] = diff (theC.Coord (aCoord + 1), theD.Coord (aCoord + 1), aCD[aCoord]);
+  }
+
+  double aBC[16], aCA[16], aAB[16];
+  const int aBCLen = minor2 (aBD[0], aBDLen[0], aCD[1], aCDLen[1], aBD[1], aBDLen[1], aCD[0], aCDLen[0], aBC);
+  const int aCALen = minor2 (aCD[0], aCDLen[0], aAD[1], aADLen[1], aCD[1], aCDLen[1], aAD[0], aADLen[0], aCA);
+  const int aABLen = minor2 (aAD[0], aADLen[0], aBD[1], aBDLen[1], aAD[1], aADLen[1], aBD[0], aBDLen[0], aAB);
+
+  double aDet[192], aTerm[64];
+  int aDetLen = product (aADLen[2], aAD[2], aBCLen, aBC, aDet);
+  int aTermLen = product (aBDLen[2], aBD[2], aCALen, aCA, aTerm);
+  aDetLen = add (aDetLen, aDet, aTermLen, aTerm);
+  aTermLen = product (aCDLen[2], aCD[2], aABLen, aAB, aTerm);
+  aDetLen = add (aDetLen, aDet, aTermLen, aTerm);
+
+  // the determinant is computed in the convention of J.R. Shewchuk (opposite to Orient3d())
+  return -aDet[aDetLen - 1];
+}
+
+//=======================================================================
+//function : InCircleExact
+//purpose  :
+//=======================================================================
+Standard_Real math_RobustPredicates::InCircleExact (const gp_XY& theA, const gp_XY& theB,
+                                                    const gp_XY& theC, const gp_XY& theD)
+{
+  double aADX[2], aADY[2], aBDX[2], aBDY[2], aCDX[2], aCDY[2];
+  const int aADXLen = diff (theA.X(), theD.X(), aADX), aADYLen = diff (theA.Y(), theD.Y(), aADY);
+  const int aBDXLen = diff (theB.X(), theD.X(), aBDX), aBDYLen = diff (theB.Y(), theD.Y(), aBDY);
+  const int aCDXLen = diff (theC.X(), theD.X(), aCDX), aCDYLen = diff (theC.Y(), theD.Y(), aCDY);
+
+  // squared distances from D (lifting to paraboloid), each of at most 16 components
+  double aALift[16], aBLift[16], aCLift[16], aSquare[8];
+  int aALiftLen = product (aADXLen, aADX, aADXLen, aADX, aALift);
+  aALiftLen = add (aALiftLen, aALift, product (aADYLen, aADY, aADYLen, aADY, aSquare), aSquare);
+  int aBLiftLen = product (aBDXLen, aBDX, aBDXLen, aBDX, aBLift);
+  aBLiftLen = add (aBLiftLen, aBLift, product (aBDYLen, aBDY, aBDYLen, aBDY, aSquare), aSquare);
+  int aCLiftLen = product (aCDXLen, aCDX, aCDXLen, aCDX, aCLift);
+  aCLiftLen = add (aCLiftLen, aCLift, product (aCDYLen, aCDY, aCDYLen, aCDY, aSquare), aSquare);
+
+  double aBC[16], aCA[16], aAB[16];
+  const int aBCLen = minor2 (aBDX, aBDXLen, aCDY, aCDYLen, aBDY, aBDYLen, aCDX, aCDXLen, aBC);
+  const int aCALen = minor2 (aCDX, aCDXLen, aADY, aADYLen, aCDY, aCDYLen, aADX, aADXLen, aCA);
+  const int aABLen = minor2 (aADX, aADXLen, aBDY, aBDYLen, aADY, aADYLen, aBDX, aBDXLen, aAB);
+
+  double aDet[1536], aTerm[512];
+  int aDetLen = product (aALiftLen, aALift, aBCLen, aBC, aDet);
+  int aTermLen = product (aBLiftLen, aBLift, aCALen, aCA, aTerm);
+  aDetLen = add (aDetLen, aDet, aTermLen, aTerm);
+  aTermLen = product (aCLiftLen, aCLift, aABLen, aAB, aTerm);
+  aDetLen = add (aDetLen, aDet, aTermLen, aTerm);
+  return aDet[aDetLen - 1];
+}
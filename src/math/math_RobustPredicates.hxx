@@ -0,0 +1,159 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _math_RobustPredicates_HeaderFile
+#define _math_RobustPredicates_HeaderFile
+
+#include <gp_XY.hxx>
+#include <gp_XYZ.hxx>
+#include <Standard_DefineAlloc.hxx>
+
+//! Robust geometric predicates with exact sign of the result
+//! (J.R. Shewchuk, "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric Predicates").
+//! The determinant is evaluated in floating-point arithmetic, and only when its sign
+//! cannot be guaranteed by the error bound it is recomputed exactly on expansions
+//! (sums of non-overlapping floating-point components).
+//! The filtered tests are inline, while the exact fallbacks are exported.
+class math_RobustPredicates
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Returns positive value if the points are in counterclockwise order,
+  //! negative value if they are in clockwise order, and zero if they are collinear.
+  //! The sign of the result is exact, the value approximates the doubled area of the triangle.
+  static Standard_Real Orient2d (const gp_XY& theA, const gp_XY& theB, const gp_XY& theC)
+  {
+    const Standard_Real aDetLeft  = (theA.X() - theC.X()) * (theB.Y() - theC.Y());
+    const Standard_Real aDetRight = (theA.Y() - theC.Y()) * (theB.X() - theC.X());
+    const Standard_Real aDet = aDetLeft - aDetRight;
+    Standard_Real aDetSum = 0.0;
+    if (aDetLeft > 0.0)
+    {
+      if (aDetRight <= 0.0)
+      {
+        return aDet;
+      }
+      aDetSum = aDetLeft + aDetRight;
+    }
+    else if (aDetLeft < 0.0)
+    {
+      if (aDetRight >= 0.0)
+      {
+        return aDet;
+      }
+      aDetSum = -aDetLeft - aDetRight;
+    }
+    else
+    {
+      return aDet;
+    }
+
+    const Standard_Real anErrBound = orient2dBound() * aDetSum;
+    if (aDet >= anErrBound || -aDet >= anErrBound)
+    {
+      return aDet;
+    }
+    return Orient2dExact (theA, theB, theC);
+  }
+
+  //! Returns positive value if the point D lies on the side of the plane of points A, B and C
+  //! pointed by the vector (B - A) ^ (C - A), negative value if it lies on the other side,
+  //! and zero if the four points are coplanar.
+  //! The sign of the result is exact, the value approximates the triple product.
+  static Standard_Real Orient3d (const gp_XYZ& theA, const gp_XYZ& theB, const gp_XYZ& theC, const gp_XYZ& theD)
+  {
+    const Standard_Real aADX = theA.X() - theD.X(), aADY = theA.Y() - theD.Y(), aADZ = theA.Z() - theD.Z();
+    const Standard_Real aBDX = theB.X() - theD.X(), aBDY = theB.Y() - theD.Y(), aBDZ = theB.Z() - theD.Z();
+    const Standard_Real aCDX = theC.X() - theD.X(), aCDY = theC.Y() - theD.Y(), aCDZ = theC.Z() - theD.Z();
+
+    const Standard_Real aBDXCDY = aBDX * aCDY, aCDXBDY = aCDX * aBDY;
+    const Standard_Real aCDXADY = aCDX * aADY, aADXCDY = aADX * aCDY;
+    const Standard_Real aADXBDY = aADX * aBDY, aBDXADY = aBDX * aADY;
+
+    const Standard_Real aDet = aADZ * (aBDXCDY - aCDXBDY)
+                             + aBDZ * (aCDXADY - aADXCDY)
+                             + aCDZ * (aADXBDY - aBDXADY);
+    const Standard_Real aPermanent = (Abs (aBDXCDY) + Abs (aCDXBDY)) * Abs (aADZ)
+                                   + (Abs (aCDXADY) + Abs (aADXCDY)) * Abs (aBDZ)
+                                   + (Abs (aADXBDY) + Abs (aBDXADY)) * Abs (aCDZ);
+    const Standard_Real anErrBound = orient3dBound() * aPermanent;
+    if (aDet > anErrBound || -aDet > anErrBound)
+    {
+      return -aDet;
+    }
+    return Orient3dExact (theA, theB, theC, theD);
+  }
+
+  //! Returns positive value if the point D lies inside the circle passing through
+  //! the points A, B and C given in counterclockwise order, negative value if it lies
+  //! outside, and zero if the four points are cocircular.
+  //! The sign of the result is exact.
+  static Standard_Real InCircle (const gp_XY& theA, const gp_XY& theB, const gp_XY& theC, const gp_XY& theD)
+  {
+    const Standard_Real aADX = theA.X() - theD.X(), aADY = theA.Y() - theD.Y();
+    const Standard_Real aBDX = theB.X() - theD.X(), aBDY = theB.Y() - theD.Y();
+    const Standard_Real aCDX = theC.X() - theD.X(), aCDY = theC.Y() - theD.Y();
+
+    const Standard_Real aBDXCDY = aBDX * aCDY, aCDXBDY = aCDX * aBDY;
+    const Standard_Real aCDXADY = aCDX * aADY, aADXCDY = aADX * aCDY;
+    const Standard_Real aADXBDY = aADX * aBDY, aBDXADY = aBDX * aADY;
+    const Standard_Real aALift = aADX * aADX + aADY * aADY;
+    const Standard_Real aBLift = aBDX * aBDX + aBDY * aBDY;
+    const Standard_Real aCLift = aCDX * aCDX + aCDY * aCDY;
+
+    const Standard_Real aDet = aALift * (aBDXCDY - aCDXBDY)
+                             + aBLift * (aCDXADY - aADXCDY)
+                             + aCLift * (aADXBDY - aBDXADY);
+    const Standard_Real aPermanent = (Abs (aBDXCDY) + Abs (aCDXBDY)) * aALift
+                                   + (Abs (aCDXADY) + Abs (aADXCDY)) * aBLift
+                                   + (Abs (aADXBDY) + Abs (aBDXADY)) * aCLift;
+    const Standard_Real anErrBound = inCircleBound() * aPermanent;
+    if (aDet > anErrBound || -aDet > anErrBound)
+    {
+      return aDet;
+    }
+    return InCircleExact (theA, theB, theC, theD);
+  }
+
+public: //! @name exact evaluation
+
+  //! Exact orientation test in 2D, see Orient2d().
+  Standard_EXPORT static Standard_Real Orient2dExact (const gp_XY& theA, const gp_XY& theB, const gp_XY& theC);
+
+  //! Exact orientation test in 3D, see Orient3d().
+  Standard_EXPORT static Standard_Real Orient3dExact (const gp_XYZ& theA, const gp_XYZ& theB,
+                                                      const gp_XYZ& theC, const gp_XYZ& theD);
+
+  //! Exact in-circle test, see InCircle().
+  Standard_EXPORT static Standard_Real InCircleExact (const gp_XY& theA, const gp_XY& theB,
+                                                      const gp_XY& theC, const gp_XY& theD);
+
+private:
+
+  //! Half of machine epsilon - the relative error of rounding.
+  static Standard_Real epsilon() { return 0.5 * RealEpsilon(); }
+
+  //! Relative error bound of the filtered Orient2d().
+  static Standard_Real orient2dBound() { return (3.0 + 16.0 * epsilon()) * epsilon(); }
+
+  //! Relative error bound of the filtered Orient3d().
+  static Standard_Real orient3dBound() { return (7.0 + 56.0 * epsilon()) * epsilon(); }
+
+  //! Relative error bound of the filtered InCircle().
+  static Standard_Real inCircleBound() { return (10.0 + 96.0 * epsilon()) * epsilon(); }
+
+};
+
+#endif // _math_RobustPredicates_HeaderFile